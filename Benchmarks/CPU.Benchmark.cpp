@@ -0,0 +1,90 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include "Core/Cartridge.hpp"
+#include "Core/Joypad.hpp"
+#include "Core/MMU.hpp"
+#include "Core/CPU.hpp"
+#include "Core/PPU.hpp"
+#include "Core/APU.hpp"
+
+namespace {
+    constexpr int defaultFrameCount = 3600;
+    constexpr Nes::CycleCount cyclesPerFrame = 29780;
+
+    // Same wiring as VirtualMachine, but with the CPU exposed so both dispatch paths can be driven directly
+    struct BenchmarkMachine {
+        Nes::Scheduler scheduler;
+        Nes::Cartridge cartridge;
+        Nes::MMU mmu{cartridge};
+        Nes::APU apu{mmu, scheduler};
+        Nes::Joypad firstJoypad{mmu, false};
+        Nes::Joypad secondJoypad{mmu, true, &apu};
+        Nes::PPU ppu{mmu, scheduler, [](const Nes::FrameBuffer&) {}};
+        Nes::CPU cpu{mmu, ppu, scheduler};
+
+        explicit BenchmarkMachine(const std::string& romPath) {
+            const auto loadResult = cartridge.loadFromFilesystem(romPath);
+            if (!loadResult.has_value()) {
+                throw std::runtime_error(loadResult.error());
+            }
+
+            mmu.rebuildPageTable();
+            cpu.loadProgramCounter();
+        }
+    };
+
+    template <typename RunFrame>
+    void benchmark(const std::string& name, const std::string& romPath, int frameCount, RunFrame runFrame) {
+        BenchmarkMachine machine(romPath);
+
+        const auto start = std::chrono::steady_clock::now();
+        for (auto i = 0; i < frameCount; i++) {
+            runFrame(machine.cpu);
+        }
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        const auto instructions = machine.cpu.instructionsExecuted();
+        std::cout << name << ": " << instructions << " instructions in " << elapsed.count() << "s ("
+                  << static_cast<std::uint64_t>(instructions / elapsed.count()) << " instructions/s, "
+                  << frameCount / elapsed.count() << " frames/s)" << std::endl;
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::string romPath = argc > 1 ? argv[1] : BENCHMARK_DEFAULT_ROM;
+    const int frameCount      = argc > 2 ? std::stoi(argv[2]) : defaultFrameCount;
+
+    benchmark("Table dispatch (CPU::tick)", romPath, frameCount, [](Nes::CPU& cpu) {
+        Nes::CycleCount cycles = 0;
+        while (cycles < cyclesPerFrame) {
+            cycles += cpu.tick();
+        }
+    });
+
+#ifdef CAIQUE_NES_COMPUTED_GOTO
+    benchmark("Computed goto dispatch (CPU::run)", romPath, frameCount, [](Nes::CPU& cpu) {
+        (void) cpu.run(cyclesPerFrame);
+    });
+#endif
+
+    return 0;
+}
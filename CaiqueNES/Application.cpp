@@ -17,7 +17,6 @@
 ***********************************************************************************************************************/
 
 #include <stdexcept>
-#include <algorithm>
 #include <iostream>
 #include <vector>
 #include "UserInterface/MainWindow.hpp"
@@ -38,10 +37,39 @@ Application::Application(int argc, char** argv) :
 
     m_romPath = args.at(0);
 
-    std::for_each(args.cbegin() + 1, args.cend(), [&](const auto& arg) {
-        // placeholder for future args..
-        Utils::log("Unknown command line argument: " + arg);
-    });
+    for (std::size_t i = 1; i < args.size(); i++) {
+        const auto& arg = args[i];
+        if (arg == "--frame-pacing") {
+            m_options.pacingMode = UserInterface::PacingMode::FramePacer;
+        } else if (arg == "--run-ahead") {
+            m_options.runAheadFrames = parseFrameCount(arg, optionValue(args, i));
+        } else if (arg == "--rom-index") {
+            m_options.romIndexPath = optionValue(args, i);
+        } else {
+            Utils::log("Unknown command line argument: " + arg);
+        }
+    }
+}
+
+const std::string& Application::optionValue(const std::vector<std::string>& args, std::size_t& optionIndex) {
+    if (optionIndex + 1 >= args.size()) {
+        throw std::invalid_argument("Missing value for " + args[optionIndex]);
+    }
+
+    return args[++optionIndex];
+}
+
+int Application::parseFrameCount(const std::string& option, const std::string& value) {
+    try {
+        std::size_t parsedLength = 0;
+
+        const auto frames = std::stoi(value, &parsedLength);
+        if (parsedLength == value.size() && frames >= 0) {
+            return frames;
+        }
+    } catch (const std::exception&) {}
+
+    throw std::invalid_argument("Expected a number of frames for " + option + ", got: " + value);
 }
 
 int Application::run() {
@@ -51,7 +79,7 @@ int Application::run() {
 
     QApplication app(m_argc, m_argv);
 
-    UserInterface::MainWindow window(m_romPath);
+    UserInterface::MainWindow window(m_romPath, m_options);
     window.show();
 
     const auto appResult = app.exec();
@@ -21,6 +21,8 @@
 
 #include <QApplication>
 #include <string>
+#include <vector>
+#include "UserInterface/GameWidget.hpp"
 
 class Application {
 public:
@@ -34,6 +36,10 @@ private:
     char** m_argv;
 
     std::string m_romPath;
+    UserInterface::GameOptions m_options;
+
+    static const std::string& optionValue(const std::vector<std::string>& args, std::size_t& optionIndex);
+    static int parseFrameCount(const std::string& option, const std::string& value);
 };
 
 #endif // CAIQUE_NES_APPLICATION_HXX
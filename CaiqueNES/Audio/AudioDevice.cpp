@@ -0,0 +1,64 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <algorithm>
+#include "AudioDevice.hpp"
+
+Audio::AudioDevice::AudioDevice(SampleQueue& samples, int sampleRate, int bufferSamples) :
+    m_samples(samples)
+{
+    SDL_AudioSpec desired{};
+    desired.freq     = sampleRate;
+    desired.format   = AUDIO_S16SYS;
+    desired.channels = 1;
+    desired.samples  = static_cast<Uint16>(bufferSamples);
+    desired.callback = &AudioDevice::fillStream;
+    desired.userdata = this;
+
+    m_deviceId = SDL_OpenAudioDevice(nullptr, 0, &desired, nullptr, 0);
+}
+
+Audio::AudioDevice::~AudioDevice() {
+    if (isValid()) {
+        SDL_CloseAudioDevice(m_deviceId);
+    }
+}
+
+bool Audio::AudioDevice::isValid() const {
+    return m_deviceId != 0;
+}
+
+void Audio::AudioDevice::setPaused(bool paused) {
+    if (isValid()) {
+        SDL_PauseAudioDevice(m_deviceId, paused ? 1 : 0);
+    }
+}
+
+void Audio::AudioDevice::fillStream(void* userData, Uint8* stream, int length) {
+    auto& device = *static_cast<AudioDevice*>(userData);
+
+    const auto output = std::span(reinterpret_cast<Utils::AudioSample*>(stream),
+                                  length / sizeof(Utils::AudioSample));
+
+    const auto received = device.m_samples.pop(output);
+    if (received > 0) {
+        device.m_lastSample = output[received - 1];
+    }
+
+    std::fill(output.begin() + static_cast<std::ptrdiff_t>(received), output.end(), device.m_lastSample);
+}
@@ -0,0 +1,54 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#ifndef CAIQUE_NES_AUDIODEVICE_HPP
+#define CAIQUE_NES_AUDIODEVICE_HPP
+
+#include <SDL2/SDL.h>
+#include "Utils/BlipBuffer.hpp"
+#include "Utils/RingBuffer.hpp"
+
+namespace Audio {
+    using SampleQueue = Utils::RingBuffer<Utils::AudioSample>;
+
+    // Mono playback device fed from a sample queue. The device pulls from its own thread and never waits for the
+    // emulator, on underrun the last sample is held so the output does not click.
+    class AudioDevice {
+    public:
+        AudioDevice(SampleQueue& samples, int sampleRate, int bufferSamples);
+        ~AudioDevice();
+
+        AudioDevice(const AudioDevice&)            = delete;
+        AudioDevice& operator=(const AudioDevice&) = delete;
+
+        bool isValid() const;
+
+        // Devices start paused
+        void setPaused(bool paused);
+
+    private:
+        SampleQueue& m_samples;
+        Utils::AudioSample m_lastSample = 0;
+
+        SDL_AudioDeviceID m_deviceId = 0;
+
+        static void fillStream(void* userData, Uint8* stream, int length);
+    };
+}
+
+#endif //CAIQUE_NES_AUDIODEVICE_HPP
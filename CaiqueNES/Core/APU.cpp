@@ -18,43 +18,248 @@
 
 #include "Core/APU.hpp"
 
-Nes::APU::APU(MMU& mmu) :
-    m_mmu(mmu)
+Nes::APU::APU(MMU& mmu, Scheduler& scheduler) :
+    m_mmu(mmu),
+    m_scheduler(scheduler),
+    m_blipBuffer(Const::Audio::cpuClockRate, Const::Audio::sampleRate, Const::Audio::blipCapacity),
+    m_mixer(m_blipBuffer),
+    m_syncedAt(scheduler.now()),
+    m_frameStart(scheduler.now()),
+    m_firstPulse(scheduler.now(), true),
+    m_secondPulse(scheduler.now(), false),
+    m_triangle(scheduler.now()),
+    m_noise(scheduler.now()),
+    m_dmc(scheduler.now(), mmu, scheduler),
+    m_frameSequenceStart(scheduler.now())
 {
-    m_mmu.addMemoryRegion(Const::AddrRange::apuRegisters,
-                          [&](MemoryRegion*, MMU*, Addr addr, Byte byte) {
-                              handleAPURegisterWrite(addr, byte);
-                          },
-                          [&](MemoryRegion*, MMU*, Addr addr) {
-                              return handleAPURegisterRead(addr);
-                          },
-                          false);
-
-    m_mmu.addMemoryRegion(Const::AddrRange::apuRegisters,
-                          [&](MemoryRegion*, MMU*, Addr addr, Byte byte) {
-                              handleAPURegisterWrite(addr, byte);
-                          },
-                          [&](MemoryRegion*, MMU*, Addr addr) {
-                              return handleAPURegisterRead(addr);
-                          },
-                          false);
-
-    m_mmu.addMemoryRegion(Const::AddrRange::apuStatus,
-                          [&](MemoryRegion*, MMU*, Addr addr, Byte byte) {
-                              handleAPURegisterWrite(addr, byte);
-                          },
-                          [&](MemoryRegion*, MMU*, Addr addr) {
-                              return handleAPURegisterRead(addr);
-                          },
-                          false);
-
-    m_registers.resize(Const::AddrRange::apuRegisters.extent(), 0x00);
+    m_mmu.addMemoryRegion(Const::AddrRange::apuRegisters, APUDevice{this});
+    m_mmu.addMemoryRegion(Const::AddrRange::apuStatus, APUDevice{this});
+
+    m_samples.reserve(Const::Audio::blipCapacity);
+    m_mixer.setFrameStart(m_frameStart);
+
+    m_scheduler.setHandler(EventType::ApuFrameCounter, [this] { clockFrameCounter(); });
+    scheduleFrameCounter();
 }
 
 void Nes::APU::handleAPURegisterWrite(Addr addr, Byte value) {
-    m_registers[addr - Const::AddrRange::apuRegisters.from] = value;
+    synchronize();
+
+    const auto now = m_scheduler.now();
+    const Addr reg = addr & 0x03;
+
+    switch (addr & 0xFC) {
+        case 0x00: m_firstPulse.write(reg, value, now, m_mixer);  break;
+        case 0x04: m_secondPulse.write(reg, value, now, m_mixer); break;
+        case 0x08: m_triangle.write(reg, value, now, m_mixer);    break;
+        case 0x0C: m_noise.write(reg, value, now, m_mixer);       break;
+        case 0x10: m_dmc.write(reg, value, now, m_mixer);         break;
+        default:
+            if (Const::AddrRange::apuStatus.isValueWithin(addr)) {
+                writeStatus(value);
+            }
+            break;
+    }
 }
 
+// Everything but the status register is write only
 Nes::Byte Nes::APU::handleAPURegisterRead(Addr addr) {
-    return m_registers[addr - Const::AddrRange::apuRegisters.from];
+    if (!Const::AddrRange::apuStatus.isValueWithin(addr)) {
+        return 0x00;
+    }
+
+    synchronize();
+    return readStatus();
+}
+
+// Acknowledged first, enabling the DMC may fetch the last byte of a sample right away and raise it again
+void Nes::APU::writeStatus(Byte value) {
+    const auto now = m_scheduler.now();
+    m_scheduler.acknowledgeIrq(IrqSource::Dmc);
+
+    m_firstPulse.lengthCounter().setEnabled(Utils::isBitSet(value, 0));
+    m_secondPulse.lengthCounter().setEnabled(Utils::isBitSet(value, 1));
+    m_triangle.lengthCounter().setEnabled(Utils::isBitSet(value, 2));
+    m_noise.lengthCounter().setEnabled(Utils::isBitSet(value, 3));
+    m_dmc.setEnabled(Utils::isBitSet(value, Const::Audio::StatusBit::dmcActive));
+
+    m_firstPulse.refresh(now, m_mixer);
+    m_secondPulse.refresh(now, m_mixer);
+    m_noise.refresh(now, m_mixer);
+}
+
+// Reading acknowledges the frame IRQ, the DMC IRQ stays until $4015 or $4010 is written
+Nes::Byte Nes::APU::readStatus() {
+    Byte status = 0;
+    status = Utils::setBitTo(status, 0, m_firstPulse.lengthCounter().isActive());
+    status = Utils::setBitTo(status, 1, m_secondPulse.lengthCounter().isActive());
+    status = Utils::setBitTo(status, 2, m_triangle.lengthCounter().isActive());
+    status = Utils::setBitTo(status, 3, m_noise.lengthCounter().isActive());
+    status = Utils::setBitTo(status, Const::Audio::StatusBit::dmcActive, m_dmc.isActive());
+    status = Utils::setBitTo(status, Const::Audio::StatusBit::frameIrq, m_scheduler.isIrqAsserted(IrqSource::FrameCounter));
+    status = Utils::setBitTo(status, Const::Audio::StatusBit::dmcIrq, m_scheduler.isIrqAsserted(IrqSource::Dmc));
+
+    m_scheduler.acknowledgeIrq(IrqSource::FrameCounter);
+    return status;
+}
+
+// Restarts the sequence, the five step mode clocks every unit right away
+void Nes::APU::handleFrameCounterWrite(Byte value) {
+    synchronize();
+
+    m_fiveStepMode    = Utils::isBitSet(value, 7);
+    m_frameIrqInhibit = Utils::isBitSet(value, 6);
+    if (m_frameIrqInhibit) {
+        m_scheduler.acknowledgeIrq(IrqSource::FrameCounter);
+    }
+
+    m_frameStep          = 0;
+    m_frameSequenceStart = m_scheduler.now();
+
+    if (m_fiveStepMode) {
+        clockQuarterFrame();
+        clockHalfFrame();
+    }
+
+    scheduleFrameCounter();
+}
+
+void Nes::APU::synchronize() {
+    const auto now = m_scheduler.now();
+    if (now == m_syncedAt) {
+        return;
+    }
+
+    m_firstPulse.run(now, m_mixer);
+    m_secondPulse.run(now, m_mixer);
+    m_triangle.run(now, m_mixer);
+    m_noise.run(now, m_mixer);
+    m_dmc.run(now, m_mixer);
+
+    m_syncedAt = now;
+}
+
+void Nes::APU::endFrame() {
+    synchronize();
+
+    const auto now = m_scheduler.now();
+    if (m_outputEnabled) {
+        m_blipBuffer.endFrame(now - m_frameStart);
+
+        m_samples.resize(m_blipBuffer.samplesAvailable());
+        m_samples.resize(m_blipBuffer.readSamples(m_samples));
+
+        if (m_audioCallback) {
+            m_audioCallback(m_samples);
+        }
+    }
+
+    m_frameStart = now;
+    m_mixer.setFrameStart(now);
+
+    // Deltas are placed relative to the frame start, changing the rate mid-frame would shift the ones already added
+    if (m_pendingSampleRateRatio != m_sampleRateRatio) {
+        m_sampleRateRatio = m_pendingSampleRateRatio;
+        m_blipBuffer.setRates(Const::Audio::cpuClockRate / m_sampleRateRatio, Const::Audio::sampleRate);
+    }
+}
+
+void Nes::APU::setAudioCallback(AudioFunction callback) {
+    m_audioCallback = std::move(callback);
+}
+
+void Nes::APU::setOutputEnabled(bool enabled) {
+    m_outputEnabled = enabled;
+    m_mixer.setEnabled(enabled);
+}
+
+void Nes::APU::setSampleRateRatio(double ratio) {
+    m_pendingSampleRateRatio = ratio;
+}
+
+void Nes::APU::clockFrameCounter() {
+    synchronize();
+
+    const auto& step = m_fiveStepMode ? Const::FrameCounter::fiveStepSequence[m_frameStep]
+                                      : Const::FrameCounter::fourStepSequence[m_frameStep];
+    if (step.quarterFrame) {
+        clockQuarterFrame();
+    }
+
+    if (step.halfFrame) {
+        clockHalfFrame();
+    }
+
+    if (step.irq && !m_frameIrqInhibit) {
+        m_scheduler.raiseIrq(IrqSource::FrameCounter);
+    }
+
+    const auto stepCount = m_fiveStepMode ? Const::FrameCounter::fiveStepSequence.size()
+                                          : Const::FrameCounter::fourStepSequence.size();
+    if (++m_frameStep == static_cast<int>(stepCount)) {
+        m_frameStep = 0;
+        m_frameSequenceStart += m_fiveStepMode ? Const::FrameCounter::fiveStepPeriod
+                                               : Const::FrameCounter::fourStepPeriod;
+    }
+
+    scheduleFrameCounter();
+}
+
+void Nes::APU::clockQuarterFrame() {
+    const auto now = m_scheduler.now();
+
+    m_firstPulse.clockQuarterFrame(now, m_mixer);
+    m_secondPulse.clockQuarterFrame(now, m_mixer);
+    m_triangle.clockQuarterFrame();
+    m_noise.clockQuarterFrame(now, m_mixer);
+}
+
+void Nes::APU::clockHalfFrame() {
+    const auto now = m_scheduler.now();
+
+    m_firstPulse.clockHalfFrame(now, m_mixer);
+    m_secondPulse.clockHalfFrame(now, m_mixer);
+    m_triangle.clockHalfFrame();
+    m_noise.clockHalfFrame(now, m_mixer);
+}
+
+void Nes::APU::scheduleFrameCounter() {
+    const auto& step = m_fiveStepMode ? Const::FrameCounter::fiveStepSequence[m_frameStep]
+                                      : Const::FrameCounter::fourStepSequence[m_frameStep];
+
+    m_scheduler.schedule(EventType::ApuFrameCounter, m_frameSequenceStart + step.at);
+}
+
+// The band-limited buffer only holds output, a restored state starts its next audio frame where it was taken
+void Nes::APU::saveState(Utils::StateWriter& writer) const {
+    writer.write(m_syncedAt);
+
+    m_firstPulse.saveState(writer);
+    m_secondPulse.saveState(writer);
+    m_triangle.saveState(writer);
+    m_noise.saveState(writer);
+    m_dmc.saveState(writer);
+
+    writer.write(m_fiveStepMode);
+    writer.write(m_frameIrqInhibit);
+    writer.write(m_frameStep);
+    writer.write(m_frameSequenceStart);
+}
+
+void Nes::APU::loadState(Utils::StateReader& reader) {
+    reader.read(m_syncedAt);
+
+    m_firstPulse.loadState(reader);
+    m_secondPulse.loadState(reader);
+    m_triangle.loadState(reader);
+    m_noise.loadState(reader);
+    m_dmc.loadState(reader);
+
+    reader.read(m_fiveStepMode);
+    reader.read(m_frameIrqInhibit);
+    reader.read(m_frameStep);
+    reader.read(m_frameSequenceStart);
+
+    m_frameStart = m_syncedAt;
+    m_mixer.setFrameStart(m_frameStart);
 }
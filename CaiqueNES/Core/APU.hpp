@@ -19,21 +19,123 @@
 #ifndef CAIQUE_NES_APU_HPP
 #define CAIQUE_NES_APU_HPP
 
+#include <array>
+#include <functional>
+#include <span>
+#include <vector>
+#include "Core/APUChannels.hpp"
 #include "Core/MMU.hpp"
+#include "Core/Scheduler.hpp"
+#include "Utils/BlipBuffer.hpp"
 #include "Utils/Types.hpp"
 
 namespace Nes {
+    namespace Const::Audio {
+        constexpr double cpuClockRate = 1789773.0;
+        constexpr int    sampleRate   = 48000;
+
+        // Room for a few frames, only one frame worth is buffered at a time
+        constexpr std::size_t blipCapacity = 4096;
+
+        namespace StatusBit {
+            constexpr int dmcActive = 4;
+            constexpr int frameIrq  = 6;
+            constexpr int dmcIrq    = 7;
+        }
+    }
+
+    namespace Const::FrameCounter {
+        struct Step {
+            CycleCount at;
+            bool quarterFrame;
+            bool halfFrame;
+            bool irq;
+        };
+
+        /* NTSC timings in CPU cycles since the sequence started */
+        constexpr std::array<Step, 4> fourStepSequence = {{
+            {7457,  true, false, false},
+            {14913, true, true,  false},
+            {22371, true, false, false},
+            {29829, true, true,  true}
+        }};
+        constexpr CycleCount fourStepPeriod = 29830;
+
+        constexpr std::array<Step, 5> fiveStepSequence = {{
+            {7457,  true,  false, false},
+            {14913, true,  true,  false},
+            {22371, true,  false, false},
+            {29829, false, false, false},
+            {37281, true,  true,  false}
+        }};
+        constexpr CycleCount fiveStepPeriod = 37282;
+    }
+
+    using AudioFunction = std::function<void(std::span<const Utils::AudioSample>)>;
+
     class APU : Module {
     public:
-        explicit APU(MMU& mmu);
+        APU(MMU& mmu, Scheduler& scheduler);
 
         void handleAPURegisterWrite(Addr addr, Byte value);
         Byte handleAPURegisterRead(Addr addr);
 
+        // $4017 is shared with the second joypad, which only owns its reads
+        void handleFrameCounterWrite(Byte value);
+
+        // Like the PPU, the channels only catch up with the scheduler's clock once their state matters: on register
+        // access, on frame counter steps and when the frame's audio is completed
+        void synchronize();
+
+        // Completes the audio of the current frame and hands its samples to the audio callback
+        void endFrame();
+
+        void setAudioCallback(AudioFunction callback);
+
+        // Disabled output keeps emulating the channels but produces no samples, for frames which are never presented
+        void setOutputEnabled(bool enabled);
+
+        // Produces `ratio` times as many samples as the nominal sample rate, applied from the next frame on
+        void setSampleRateRatio(double ratio);
+
+        void saveState(Utils::StateWriter& writer) const;
+        void loadState(Utils::StateReader& reader);
+
     private:
         MMU& m_mmu;
+        Scheduler& m_scheduler;
+
+        AudioFunction m_audioCallback{};
+        Utils::BlipBuffer m_blipBuffer;
+        AudioMixer m_mixer;
+        std::vector<Utils::AudioSample> m_samples{};
+        bool m_outputEnabled = true;
+        double m_sampleRateRatio        = 1.0;
+        double m_pendingSampleRateRatio = 1.0;
+
+        Timestamp m_syncedAt;
+        Timestamp m_frameStart;
+
+        /* Channels */
+        PulseChannel    m_firstPulse;
+        PulseChannel    m_secondPulse;
+        TriangleChannel m_triangle;
+        NoiseChannel    m_noise;
+        DmcChannel      m_dmc;
+
+        /* Frame Counter */
+        bool m_fiveStepMode    = false;
+        bool m_frameIrqInhibit = false;
+        int  m_frameStep       = 0;
+        Timestamp m_frameSequenceStart;
+
+        void writeStatus(Byte value);
+        Byte readStatus();
 
-        std::vector<Byte> m_registers{};
+        void clockFrameCounter();
+        void clockQuarterFrame();
+        void clockHalfFrame();
+        void scheduleFrameCounter();
     };
 }
 
@@ -0,0 +1,615 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <algorithm>
+#include "Core/APUChannels.hpp"
+
+Nes::AudioMixer::AudioMixer(Utils::BlipBuffer& buffer) :
+    m_buffer(buffer)
+{
+}
+
+void Nes::AudioMixer::addDelta(Timestamp time, int delta) {
+    if (m_enabled && time >= m_frameStart) {
+        m_buffer.addDelta(time - m_frameStart, delta);
+    }
+}
+
+void Nes::AudioMixer::setFrameStart(Timestamp frameStart) {
+    m_frameStart = frameStart;
+}
+
+void Nes::AudioMixer::setEnabled(bool enabled) {
+    m_enabled = enabled;
+}
+
+/* Envelope */
+void Nes::Envelope::write(Byte value) {
+    loop           = Utils::isBitSet(value, 5);
+    constantVolume = Utils::isBitSet(value, 4);
+    volume         = value & 0x0F;
+}
+
+void Nes::Envelope::clock() {
+    if (start) {
+        start   = false;
+        decay   = 15;
+        divider = volume;
+        return;
+    }
+
+    if (divider > 0) {
+        divider--;
+        return;
+    }
+
+    divider = volume;
+    if (decay > 0) {
+        decay--;
+    } else if (loop) {
+        decay = 15;
+    }
+}
+
+Nes::Byte Nes::Envelope::output() const {
+    return constantVolume ? volume : decay;
+}
+
+void Nes::Envelope::saveState(Utils::StateWriter& writer) const {
+    writer.write(start);
+    writer.write(loop);
+    writer.write(constantVolume);
+    writer.write(volume);
+    writer.write(divider);
+    writer.write(decay);
+}
+
+void Nes::Envelope::loadState(Utils::StateReader& reader) {
+    reader.read(start);
+    reader.read(loop);
+    reader.read(constantVolume);
+    reader.read(volume);
+    reader.read(divider);
+    reader.read(decay);
+}
+
+/* Length Counter */
+void Nes::LengthCounter::load(Byte index) {
+    if (enabled) {
+        counter = Const::Audio::lengthTable[index & 0x1F];
+    }
+}
+
+void Nes::LengthCounter::setEnabled(bool isEnabled) {
+    enabled = isEnabled;
+    if (!enabled) {
+        counter = 0;
+    }
+}
+
+void Nes::LengthCounter::clock() {
+    if (!halted && counter > 0) {
+        counter--;
+    }
+}
+
+bool Nes::LengthCounter::isActive() const {
+    return counter > 0;
+}
+
+void Nes::LengthCounter::saveState(Utils::StateWriter& writer) const {
+    writer.write(enabled);
+    writer.write(halted);
+    writer.write(counter);
+}
+
+void Nes::LengthCounter::loadState(Utils::StateReader& reader) {
+    reader.read(enabled);
+    reader.read(halted);
+    reader.read(counter);
+}
+
+/* Channel Base */
+Nes::ChannelBase::ChannelBase(Timestamp now) :
+    m_nextClock(now)
+{
+}
+
+Nes::LengthCounter& Nes::ChannelBase::lengthCounter() {
+    return m_length;
+}
+
+const Nes::LengthCounter& Nes::ChannelBase::lengthCounter() const {
+    return m_length;
+}
+
+void Nes::ChannelBase::setAmplitude(Timestamp time, int amplitude, AudioMixer& mixer) {
+    const auto delta = amplitude - m_amplitude;
+    if (delta != 0) {
+        mixer.addDelta(time, delta);
+        m_amplitude = amplitude;
+    }
+}
+
+// Moves the timer past `until` in one go, for channels whose output cannot change meanwhile
+void Nes::ChannelBase::skipClocks(Timestamp until, Timestamp period) {
+    if (m_nextClock < until) {
+        m_nextClock += (until - m_nextClock + period - 1) / period * period;
+    }
+}
+
+void Nes::ChannelBase::saveBaseState(Utils::StateWriter& writer) const {
+    m_length.saveState(writer);
+    writer.write(m_nextClock);
+    writer.write(m_amplitude);
+}
+
+void Nes::ChannelBase::loadBaseState(Utils::StateReader& reader) {
+    m_length.loadState(reader);
+    reader.read(m_nextClock);
+    reader.read(m_amplitude);
+}
+
+/* Pulse */
+Nes::PulseChannel::PulseChannel(Timestamp now, bool isFirstChannel) :
+    ChannelBase(now),
+    m_isFirstChannel(isFirstChannel)
+{
+}
+
+void Nes::PulseChannel::write(Addr reg, Byte value, Timestamp now, AudioMixer& mixer) {
+    switch (reg) {
+        case 0:
+            m_duty = value >> 6;
+            m_envelope.write(value);
+            m_length.halted = m_envelope.loop;
+            break;
+
+        case 1:
+            m_sweepEnabled = Utils::isBitSet(value, 7);
+            m_sweepPeriod  = (value >> 4) & 0x07;
+            m_sweepNegate  = Utils::isBitSet(value, 3);
+            m_sweepShift   = value & 0x07;
+            m_sweepReload  = true;
+            break;
+
+        case 2:
+            m_period = (m_period & 0x0700) | value;
+            break;
+
+        default:
+            m_period = (m_period & 0x00FF) | ((value & 0x07) << 8);
+            m_length.load(value >> 3);
+            m_dutyStep = 0;
+            m_envelope.start = true;
+            break;
+    }
+
+    setAmplitude(now, currentAmplitude(), mixer);
+}
+
+void Nes::PulseChannel::run(Timestamp until, AudioMixer& mixer) {
+    const Timestamp period = (m_period + 1) * 2;
+
+    if (isMuted()) {
+        const auto clocksBefore = m_nextClock;
+        skipClocks(until, period);
+        m_dutyStep = (m_dutyStep + (m_nextClock - clocksBefore) / period) & 0x07;
+        return;
+    }
+
+    while (m_nextClock < until) {
+        m_dutyStep = (m_dutyStep + 1) & 0x07;
+        setAmplitude(m_nextClock, currentAmplitude(), mixer);
+        m_nextClock += period;
+    }
+}
+
+void Nes::PulseChannel::clockQuarterFrame(Timestamp now, AudioMixer& mixer) {
+    m_envelope.clock();
+    setAmplitude(now, currentAmplitude(), mixer);
+}
+
+void Nes::PulseChannel::clockHalfFrame(Timestamp now, AudioMixer& mixer) {
+    m_length.clock();
+
+    const auto target = sweepTargetPeriod();
+    if (m_sweepDivider == 0 && m_sweepEnabled && m_sweepShift > 0 &&
+        m_period >= Const::Audio::pulseMinimumPeriod && target <= Const::Audio::pulseMaximumPeriod)
+    {
+        m_period = target;
+    }
+
+    if (m_sweepDivider == 0 || m_sweepReload) {
+        m_sweepDivider = m_sweepPeriod;
+        m_sweepReload  = false;
+    } else {
+        m_sweepDivider--;
+    }
+
+    setAmplitude(now, currentAmplitude(), mixer);
+}
+
+void Nes::PulseChannel::refresh(Timestamp now, AudioMixer& mixer) {
+    setAmplitude(now, currentAmplitude(), mixer);
+}
+
+// The first pulse negates with the ones' complement, so it sweeps down one further than the second
+Nes::Word Nes::PulseChannel::sweepTargetPeriod() const {
+    const int change = m_period >> m_sweepShift;
+    if (!m_sweepNegate) {
+        return static_cast<Word>(m_period + change);
+    }
+
+    return static_cast<Word>(std::max(m_period - change - (m_isFirstChannel ? 1 : 0), 0));
+}
+
+bool Nes::PulseChannel::isMuted() const {
+    return !m_length.isActive() || m_envelope.output() == 0 || m_period < Const::Audio::pulseMinimumPeriod ||
+           sweepTargetPeriod() > Const::Audio::pulseMaximumPeriod;
+}
+
+int Nes::PulseChannel::currentAmplitude() const {
+    if (isMuted()) {
+        return 0;
+    }
+
+    return Const::Audio::dutyTable[m_duty][m_dutyStep] * m_envelope.output() * Const::Audio::pulseWeight;
+}
+
+void Nes::PulseChannel::saveState(Utils::StateWriter& writer) const {
+    saveBaseState(writer);
+    m_envelope.saveState(writer);
+
+    writer.write(m_duty);
+    writer.write(m_dutyStep);
+    writer.write(m_period);
+    writer.write(m_sweepEnabled);
+    writer.write(m_sweepNegate);
+    writer.write(m_sweepReload);
+    writer.write(m_sweepPeriod);
+    writer.write(m_sweepShift);
+    writer.write(m_sweepDivider);
+}
+
+void Nes::PulseChannel::loadState(Utils::StateReader& reader) {
+    loadBaseState(reader);
+    m_envelope.loadState(reader);
+
+    reader.read(m_duty);
+    reader.read(m_dutyStep);
+    reader.read(m_period);
+    reader.read(m_sweepEnabled);
+    reader.read(m_sweepNegate);
+    reader.read(m_sweepReload);
+    reader.read(m_sweepPeriod);
+    reader.read(m_sweepShift);
+    reader.read(m_sweepDivider);
+}
+
+/* Triangle */
+Nes::TriangleChannel::TriangleChannel(Timestamp now) :
+    ChannelBase(now)
+{
+}
+
+// The level only moves with the sequencer, so a write never changes the output right away
+void Nes::TriangleChannel::write(Addr reg, Byte value, Timestamp, AudioMixer&) {
+    switch (reg) {
+        case 0:
+            m_control       = Utils::isBitSet(value, 7);
+            m_length.halted = m_control;
+            m_linearPeriod  = value & 0x7F;
+            break;
+
+        case 2:
+            m_period = (m_period & 0x0700) | value;
+            break;
+
+        case 3:
+            m_period = (m_period & 0x00FF) | ((value & 0x07) << 8);
+            m_length.load(value >> 3);
+            m_linearReload = true;
+            break;
+
+        default: /* Unused */ break;
+    }
+}
+
+// A halted triangle holds its last level instead of dropping to zero, which avoids a pop
+void Nes::TriangleChannel::run(Timestamp until, AudioMixer& mixer) {
+    const Timestamp period = m_period + 1;
+
+    if (!isSequencerRunning()) {
+        skipClocks(until, period);
+        return;
+    }
+
+    while (m_nextClock < until) {
+        m_step = (m_step + 1) & 0x1F;
+        setAmplitude(m_nextClock, Const::Audio::triangleSequence[m_step] * Const::Audio::triangleWeight, mixer);
+        m_nextClock += period;
+    }
+}
+
+void Nes::TriangleChannel::clockQuarterFrame() {
+    if (m_linearReload) {
+        m_linearCounter = m_linearPeriod;
+    } else if (m_linearCounter > 0) {
+        m_linearCounter--;
+    }
+
+    if (!m_control) {
+        m_linearReload = false;
+    }
+}
+
+void Nes::TriangleChannel::clockHalfFrame() {
+    m_length.clock();
+}
+
+// Ultrasonic periods are left out as well, real hardware plays them but they are only audible as a click
+bool Nes::TriangleChannel::isSequencerRunning() const {
+    return m_length.isActive() && m_linearCounter > 0 && m_period >= Const::Audio::triangleMinimumPeriod;
+}
+
+void Nes::TriangleChannel::saveState(Utils::StateWriter& writer) const {
+    saveBaseState(writer);
+
+    writer.write(m_control);
+    writer.write(m_linearReload);
+    writer.write(m_linearPeriod);
+    writer.write(m_linearCounter);
+    writer.write(m_step);
+    writer.write(m_period);
+}
+
+void Nes::TriangleChannel::loadState(Utils::StateReader& reader) {
+    loadBaseState(reader);
+
+    reader.read(m_control);
+    reader.read(m_linearReload);
+    reader.read(m_linearPeriod);
+    reader.read(m_linearCounter);
+    reader.read(m_step);
+    reader.read(m_period);
+}
+
+/* Noise */
+Nes::NoiseChannel::NoiseChannel(Timestamp now) :
+    ChannelBase(now)
+{
+}
+
+void Nes::NoiseChannel::write(Addr reg, Byte value, Timestamp now, AudioMixer& mixer) {
+    switch (reg) {
+        case 0:
+            m_envelope.write(value);
+            m_length.halted = m_envelope.loop;
+            break;
+
+        case 2:
+            m_shortMode = Utils::isBitSet(value, 7);
+            m_period    = Const::Audio::noisePeriods[value & 0x0F];
+            break;
+
+        case 3:
+            m_length.load(value >> 3);
+            m_envelope.start = true;
+            break;
+
+        default: /* Unused */ break;
+    }
+
+    setAmplitude(now, currentAmplitude(), mixer);
+}
+
+void Nes::NoiseChannel::run(Timestamp until, AudioMixer& mixer) {
+    const int feedbackTap = m_shortMode ? 6 : 1;
+
+    while (m_nextClock < until) {
+        const Word feedback = (m_shiftRegister ^ (m_shiftRegister >> feedbackTap)) & 0x01;
+        m_shiftRegister = (m_shiftRegister >> 1) | (feedback << 14);
+
+        setAmplitude(m_nextClock, currentAmplitude(), mixer);
+        m_nextClock += m_period;
+    }
+}
+
+void Nes::NoiseChannel::clockQuarterFrame(Timestamp now, AudioMixer& mixer) {
+    m_envelope.clock();
+    setAmplitude(now, currentAmplitude(), mixer);
+}
+
+void Nes::NoiseChannel::clockHalfFrame(Timestamp now, AudioMixer& mixer) {
+    m_length.clock();
+    setAmplitude(now, currentAmplitude(), mixer);
+}
+
+void Nes::NoiseChannel::refresh(Timestamp now, AudioMixer& mixer) {
+    setAmplitude(now, currentAmplitude(), mixer);
+}
+
+int Nes::NoiseChannel::currentAmplitude() const {
+    if (!m_length.isActive() || (m_shiftRegister & 0x01) != 0) {
+        return 0;
+    }
+
+    return m_envelope.output() * Const::Audio::noiseWeight;
+}
+
+void Nes::NoiseChannel::saveState(Utils::StateWriter& writer) const {
+    saveBaseState(writer);
+    m_envelope.saveState(writer);
+
+    writer.write(m_shortMode);
+    writer.write(m_period);
+    writer.write(m_shiftRegister);
+}
+
+void Nes::NoiseChannel::loadState(Utils::StateReader& reader) {
+    loadBaseState(reader);
+    m_envelope.loadState(reader);
+
+    reader.read(m_shortMode);
+    reader.read(m_period);
+    reader.read(m_shiftRegister);
+}
+
+/* DMC */
+Nes::DmcChannel::DmcChannel(Timestamp now, MMU& mmu, Scheduler& scheduler) :
+    ChannelBase(now),
+    m_mmu(mmu),
+    m_scheduler(scheduler)
+{
+}
+
+void Nes::DmcChannel::write(Addr reg, Byte value, Timestamp now, AudioMixer& mixer) {
+    switch (reg) {
+        case 0:
+            m_irqEnabled = Utils::isBitSet(value, 7);
+            m_loop       = Utils::isBitSet(value, 6);
+            m_rate       = Const::Audio::dmcRates[value & 0x0F];
+
+            if (!m_irqEnabled) {
+                m_scheduler.acknowledgeIrq(IrqSource::Dmc);
+            }
+            break;
+
+        case 1:
+            m_level = value & Const::Audio::dmcLevelMask;
+            setAmplitude(now, m_level * Const::Audio::dmcWeight, mixer);
+            break;
+
+        case 2:
+            m_sampleAddress = Const::Audio::dmcSampleBase + value * Const::Audio::dmcAddressUnit;
+            break;
+
+        default:
+            m_sampleLength = value * Const::Audio::dmcLengthUnit + 1;
+            break;
+    }
+}
+
+void Nes::DmcChannel::run(Timestamp until, AudioMixer& mixer) {
+    while (m_nextClock < until) {
+        clockOutput(m_nextClock, mixer);
+        m_nextClock += m_rate;
+    }
+}
+
+void Nes::DmcChannel::clockOutput(Timestamp time, AudioMixer& mixer) {
+    if (!m_silence) {
+        if (Utils::isBitSet(m_shiftRegister, 0)) {
+            if (m_level <= Const::Audio::dmcMaximumLevel - 2) {
+                m_level += 2;
+            }
+        } else if (m_level >= 2) {
+            m_level -= 2;
+        }
+
+        setAmplitude(time, m_level * Const::Audio::dmcWeight, mixer);
+    }
+
+    m_shiftRegister >>= 1;
+    if (--m_bitsRemaining > 0) {
+        return;
+    }
+
+    m_bitsRemaining = 8;
+    m_silence = m_sampleBufferEmpty;
+    if (!m_sampleBufferEmpty) {
+        m_shiftRegister     = m_sampleBuffer;
+        m_sampleBufferEmpty = true;
+        fetchSample();
+    }
+}
+
+void Nes::DmcChannel::setEnabled(bool enabled) {
+    if (!enabled) {
+        m_bytesRemaining = 0;
+    } else if (m_bytesRemaining == 0) {
+        restartSample();
+        fetchSample();
+    }
+}
+
+bool Nes::DmcChannel::isActive() const {
+    return m_bytesRemaining > 0;
+}
+
+void Nes::DmcChannel::restartSample() {
+    m_currentAddress = m_sampleAddress;
+    m_bytesRemaining = m_sampleLength;
+}
+
+void Nes::DmcChannel::fetchSample() {
+    if (!m_sampleBufferEmpty || m_bytesRemaining == 0) {
+        return;
+    }
+
+    m_sampleBuffer      = m_mmu.read(m_currentAddress);
+    m_sampleBufferEmpty = false;
+    m_currentAddress    = m_currentAddress == 0xFFFF ? Const::Audio::dmcAddressWrap : m_currentAddress + 1;
+
+    if (--m_bytesRemaining > 0) {
+        return;
+    }
+
+    if (m_loop) {
+        restartSample();
+    } else if (m_irqEnabled) {
+        m_scheduler.raiseIrq(IrqSource::Dmc);
+    }
+}
+
+void Nes::DmcChannel::saveState(Utils::StateWriter& writer) const {
+    saveBaseState(writer);
+
+    writer.write(m_irqEnabled);
+    writer.write(m_loop);
+    writer.write(m_rate);
+    writer.write(m_level);
+    writer.write(m_sampleAddress);
+    writer.write(m_sampleLength);
+    writer.write(m_currentAddress);
+    writer.write(m_bytesRemaining);
+    writer.write(m_sampleBuffer);
+    writer.write(m_sampleBufferEmpty);
+    writer.write(m_shiftRegister);
+    writer.write(m_bitsRemaining);
+    writer.write(m_silence);
+}
+
+void Nes::DmcChannel::loadState(Utils::StateReader& reader) {
+    loadBaseState(reader);
+
+    reader.read(m_irqEnabled);
+    reader.read(m_loop);
+    reader.read(m_rate);
+    reader.read(m_level);
+    reader.read(m_sampleAddress);
+    reader.read(m_sampleLength);
+    reader.read(m_currentAddress);
+    reader.read(m_bytesRemaining);
+    reader.read(m_sampleBuffer);
+    reader.read(m_sampleBufferEmpty);
+    reader.read(m_shiftRegister);
+    reader.read(m_bitsRemaining);
+    reader.read(m_silence);
+}
@@ -0,0 +1,271 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#ifndef CAIQUE_NES_APUCHANNELS_HPP
+#define CAIQUE_NES_APUCHANNELS_HPP
+
+#include <array>
+#include "Core/MMU.hpp"
+#include "Core/Scheduler.hpp"
+#include "Utils/BlipBuffer.hpp"
+#include "Utils/StateStream.hpp"
+#include "Utils/Types.hpp"
+
+namespace Nes {
+    namespace Const::Audio {
+        constexpr double fullScale = 32767.0;
+
+        // Linear approximation of the mixer, amplitude contributed per output level of each channel
+        constexpr int pulseWeight    = static_cast<int>(0.00752 * fullScale);
+        constexpr int triangleWeight = static_cast<int>(0.00851 * fullScale);
+        constexpr int noiseWeight    = static_cast<int>(0.00494 * fullScale);
+        constexpr int dmcWeight      = static_cast<int>(0.00335 * fullScale);
+
+        constexpr std::array<Byte, 32> lengthTable = {
+            10, 254, 20,  2, 40,  4, 80,  6, 160,  8, 60, 10, 14, 12, 26, 14,
+            12,  16, 24, 18, 48, 20, 96, 22, 192, 24, 72, 26, 16, 28, 32, 30
+        };
+
+        constexpr std::array<std::array<Byte, 8>, 4> dutyTable = {{
+            {0, 1, 0, 0, 0, 0, 0, 0},
+            {0, 1, 1, 0, 0, 0, 0, 0},
+            {0, 1, 1, 1, 1, 0, 0, 0},
+            {1, 0, 0, 1, 1, 1, 1, 1}
+        }};
+
+        constexpr std::array<Byte, 32> triangleSequence = {
+            15, 14, 13, 12, 11, 10,  9,  8,  7,  6,  5,  4,  3,  2,  1,  0,
+             0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15
+        };
+
+        /* NTSC timer periods in CPU cycles */
+        constexpr std::array<Word, 16> noisePeriods = {
+            4, 8, 16, 32, 64, 96, 128, 160, 202, 254, 380, 508, 762, 1016, 2034, 4068
+        };
+        constexpr std::array<Word, 16> dmcRates = {
+            428, 380, 340, 320, 286, 254, 226, 214, 190, 160, 142, 128, 106, 84, 72, 54
+        };
+
+        constexpr Word pulseMinimumPeriod    = 8;
+        constexpr Word pulseMaximumPeriod    = 0x7FF;
+        constexpr Word triangleMinimumPeriod = 2;
+
+        constexpr Addr dmcSampleBase   = 0xC000;
+        constexpr Addr dmcAddressWrap  = 0x8000;
+        constexpr int  dmcAddressUnit  = 64;
+        constexpr int  dmcLengthUnit   = 16;
+        constexpr Byte dmcLevelMask    = 0x7F;
+        constexpr Byte dmcMaximumLevel = 127;
+    }
+
+    // Hands the amplitude changes of all channels to the band-limited buffer. While disabled the channels keep
+    // running, only their output is dropped, which is how frames emulated ahead stay silent.
+    class AudioMixer {
+    public:
+        explicit AudioMixer(Utils::BlipBuffer& buffer);
+
+        void addDelta(Timestamp time, int delta);
+
+        void setFrameStart(Timestamp frameStart);
+        void setEnabled(bool enabled);
+
+    private:
+        Utils::BlipBuffer& m_buffer;
+        Timestamp m_frameStart = 0;
+        bool m_enabled = true;
+    };
+
+    struct Envelope {
+        bool start          = false;
+        bool loop           = false;
+        bool constantVolume = false;
+        Byte volume  = 0;
+        Byte divider = 0;
+        Byte decay   = 0;
+
+        void write(Byte value);
+        void clock();
+        Byte output() const;
+
+        void saveState(Utils::StateWriter& writer) const;
+        void loadState(Utils::StateReader& reader);
+    };
+
+    struct LengthCounter {
+        bool enabled = false;
+        bool halted  = false;
+        Byte counter = 0;
+
+        void load(Byte index);
+        void setEnabled(bool isEnabled);
+        void clock();
+        bool isActive() const;
+
+        void saveState(Utils::StateWriter& writer) const;
+        void loadState(Utils::StateReader& reader);
+    };
+
+    // Timers are kept as the absolute timestamp of their next clock, running a channel jumps from one clock to the
+    // next and only reports the moments its output actually changes
+    class ChannelBase {
+    public:
+        explicit ChannelBase(Timestamp now);
+
+        LengthCounter& lengthCounter();
+        const LengthCounter& lengthCounter() const;
+
+    protected:
+        LengthCounter m_length{};
+        Timestamp m_nextClock;
+        int m_amplitude = 0;
+
+        void setAmplitude(Timestamp time, int amplitude, AudioMixer& mixer);
+        void skipClocks(Timestamp until, Timestamp period);
+
+        void saveBaseState(Utils::StateWriter& writer) const;
+        void loadBaseState(Utils::StateReader& reader);
+    };
+
+    class PulseChannel : public ChannelBase {
+    public:
+        PulseChannel(Timestamp now, bool isFirstChannel);
+
+        void write(Addr reg, Byte value, Timestamp now, AudioMixer& mixer);
+        void run(Timestamp until, AudioMixer& mixer);
+
+        void clockQuarterFrame(Timestamp now, AudioMixer& mixer);
+        void clockHalfFrame(Timestamp now, AudioMixer& mixer);
+
+        // Re-evaluates the output after the length counter was changed from outside
+        void refresh(Timestamp now, AudioMixer& mixer);
+
+        void saveState(Utils::StateWriter& writer) const;
+        void loadState(Utils::StateReader& reader);
+
+    private:
+        bool m_isFirstChannel;
+
+        Envelope m_envelope{};
+        Byte m_duty     = 0;
+        Byte m_dutyStep = 0;
+        Word m_period   = 0;
+
+        bool m_sweepEnabled = false;
+        bool m_sweepNegate  = false;
+        bool m_sweepReload  = false;
+        Byte m_sweepPeriod  = 0;
+        Byte m_sweepShift   = 0;
+        Byte m_sweepDivider = 0;
+
+        Word sweepTargetPeriod() const;
+        bool isMuted() const;
+        int currentAmplitude() const;
+    };
+
+    class TriangleChannel : public ChannelBase {
+    public:
+        explicit TriangleChannel(Timestamp now);
+
+        void write(Addr reg, Byte value, Timestamp now, AudioMixer& mixer);
+        void run(Timestamp until, AudioMixer& mixer);
+
+        void clockQuarterFrame();
+        void clockHalfFrame();
+
+        void saveState(Utils::StateWriter& writer) const;
+        void loadState(Utils::StateReader& reader);
+
+    private:
+        bool m_control       = false;
+        bool m_linearReload  = false;
+        Byte m_linearPeriod  = 0;
+        Byte m_linearCounter = 0;
+        Byte m_step          = 0;
+        Word m_period        = 0;
+
+        bool isSequencerRunning() const;
+    };
+
+    class NoiseChannel : public ChannelBase {
+    public:
+        explicit NoiseChannel(Timestamp now);
+
+        void write(Addr reg, Byte value, Timestamp now, AudioMixer& mixer);
+        void run(Timestamp until, AudioMixer& mixer);
+
+        void clockQuarterFrame(Timestamp now, AudioMixer& mixer);
+        void clockHalfFrame(Timestamp now, AudioMixer& mixer);
+
+        // Re-evaluates the output after the length counter was changed from outside
+        void refresh(Timestamp now, AudioMixer& mixer);
+
+        void saveState(Utils::StateWriter& writer) const;
+        void loadState(Utils::StateReader& reader);
+
+    private:
+        Envelope m_envelope{};
+        bool m_shortMode     = false;
+        Word m_period        = Const::Audio::noisePeriods[0];
+        Word m_shiftRegister = 1;
+
+        int currentAmplitude() const;
+    };
+
+    // Plays 1-bit delta encoded samples straight from the CPU address space and raises its IRQ once a non-looping
+    // sample has been fully read
+    class DmcChannel : public ChannelBase {
+    public:
+        DmcChannel(Timestamp now, MMU& mmu, Scheduler& scheduler);
+
+        void write(Addr reg, Byte value, Timestamp now, AudioMixer& mixer);
+        void run(Timestamp until, AudioMixer& mixer);
+
+        void setEnabled(bool enabled);
+        bool isActive() const;
+
+        void saveState(Utils::StateWriter& writer) const;
+        void loadState(Utils::StateReader& reader);
+
+    private:
+        MMU& m_mmu;
+        Scheduler& m_scheduler;
+
+        bool m_irqEnabled = false;
+        bool m_loop       = false;
+        Word m_rate       = Const::Audio::dmcRates[0];
+        Byte m_level      = 0;
+
+        Addr m_sampleAddress  = Const::Audio::dmcSampleBase;
+        Word m_sampleLength   = 1;
+        Addr m_currentAddress = Const::Audio::dmcSampleBase;
+        Word m_bytesRemaining = 0;
+
+        Byte m_sampleBuffer      = 0;
+        bool m_sampleBufferEmpty = true;
+
+        Byte m_shiftRegister = 0;
+        Byte m_bitsRemaining = 8;
+        bool m_silence       = true;
+
+        void clockOutput(Timestamp time, AudioMixer& mixer);
+        void restartSample();
+        void fetchSample();
+    };
+}
+
+#endif //CAIQUE_NES_APUCHANNELS_HPP
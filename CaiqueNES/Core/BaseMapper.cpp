@@ -16,22 +16,201 @@
 *
 ***********************************************************************************************************************/
 
+
+#include <algorithm>
+#include "Core/Cartridge.hpp"
+#include "Mappers/CNROM.hpp"
+#include "Mappers/MMC1.hpp"
+#include "Mappers/MMC3.hpp"
 #include "Mappers/NROM.hpp"
+#include "Mappers/UxROM.hpp"
+#include "Utils/Log.hpp"
+
+static_assert(Nes::Const::Banking::chrWindowTiles * Nes::Const::tileSize == Nes::Const::Banking::chrWindowSize);
 
-std::unique_ptr<Nes::BaseMapper> Nes::BaseMapper::createFromID(Cartridge& cartridge, Byte id, std::size_t sizeOfPRG,
-                                                               std::size_t sizeOfCHR)
+std::unique_ptr<Nes::BaseMapper> Nes::BaseMapper::createFromID(Cartridge& cartridge, std::uint16_t id,
+                                                               std::size_t sizeOfPRG, std::size_t sizeOfCHR)
 {
     switch (static_cast<Mapper>(id)) {
-        case Mapper::NROM: return std::make_unique<NROM>(cartridge, sizeOfPRG, sizeOfCHR);
+        case Mapper::NROM:  return std::make_unique<NROM>(cartridge, sizeOfPRG, sizeOfCHR);
+        case Mapper::MMC1:  return std::make_unique<MMC1>(cartridge, sizeOfPRG, sizeOfCHR);
+        case Mapper::UxROM: return std::make_unique<UxROM>(cartridge, sizeOfPRG, sizeOfCHR);
+        case Mapper::CNROM: return std::make_unique<CNROM>(cartridge, sizeOfPRG, sizeOfCHR);
+        case Mapper::MMC3:  return std::make_unique<MMC3>(cartridge, sizeOfPRG, sizeOfCHR);
         default: return nullptr;
     }
 }
 
+bool Nes::BaseMapper::isImplemented(std::uint16_t id) {
+    switch (static_cast<Mapper>(id)) {
+        case Mapper::NROM:
+        case Mapper::MMC1:
+        case Mapper::UxROM:
+        case Mapper::CNROM:
+        case Mapper::MMC3:  return true;
+        default: return false;
+    }
+}
+
+bool Nes::BaseMapper::isSupported(std::uint16_t id, std::size_t prgSizeInBytes, std::size_t chrSizeInBytes) {
+    // NES 2.0 exponent sizes can be anything, but every window of the bank tables has to be backed by data
+    if (prgSizeInBytes % Const::Banking::prgWindowSize != 0 || chrSizeInBytes % Const::Banking::chrWindowSize != 0) {
+        return false;
+    }
+
+    const auto sizeOfPRG = static_cast<int>(prgSizeInBytes / Utils::kilobytesToBytes(1));
+    const auto sizeOfCHR = static_cast<int>(chrSizeInBytes / Utils::kilobytesToBytes(1));
+
+    switch (static_cast<Mapper>(id)) {
+        case Mapper::NROM:  return NROM::validate(sizeOfPRG, sizeOfCHR);
+        case Mapper::MMC1:  return MMC1::validate(sizeOfPRG, sizeOfCHR);
+        case Mapper::UxROM: return UxROM::validate(sizeOfPRG, sizeOfCHR);
+        case Mapper::CNROM: return CNROM::validate(sizeOfPRG, sizeOfCHR);
+        case Mapper::MMC3:  return MMC3::validate(sizeOfPRG, sizeOfCHR);
+        default: return false;
+    }
+}
+
 Nes::BaseMapper::BaseMapper(Cartridge& cartridge, std::size_t sizeOfPRG, std::size_t sizeOfCHR, Byte mapperId,
                             const MapperValidationFunction& validationFn) :
-    m_cartridge(cartridge)
+    m_cartridge(cartridge),
+    m_chrWritable(sizeOfCHR == 0)
 {
     if (!validationFn(sizeOfPRG, sizeOfCHR)) {
         throw std::invalid_argument("Sanity check failed for mapper with ID " + std::to_string(mapperId));
     }
 }
+
+Nes::Byte Nes::BaseMapper::readPRG(Addr addr) const {
+    return m_prgBanks[addr >> Const::Banking::prgWindowShift][addr & (Const::Banking::prgWindowSize - 1)];
+}
+
+const Nes::Byte* Nes::BaseMapper::readPRGPointer(Addr addr) const {
+    return &m_prgBanks[addr >> Const::Banking::prgWindowShift][addr & (Const::Banking::prgWindowSize - 1)];
+}
+
+std::uint32_t Nes::BaseMapper::prgMappingVersion() const {
+    return m_prgMappingVersion;
+}
+
+Nes::Byte Nes::BaseMapper::readCHR(Addr addr) const {
+    return m_chrBanks[addr >> Const::Banking::chrWindowShift][addr & (Const::Banking::chrWindowSize - 1)];
+}
+
+void Nes::BaseMapper::writeCHR(Addr addr, Byte value) {
+    if (!m_chrWritable) {
+        Utils::log("Attempted to write to cartridge CHR ROM");
+        return;
+    }
+
+    // The tables only hold read-only pointers, the write goes through the same offset into the cartridge's CHR RAM
+    const auto chrRam    = m_cartridge.accessCHRRam();
+    const auto* bank     = m_chrBanks[addr >> Const::Banking::chrWindowShift];
+    const auto  inWindow = addr & (Const::Banking::chrWindowSize - 1);
+
+    chrRam[(bank - chrRam.data()) + inWindow] = value;
+
+    // The same bank may be mapped into several windows, the tile changed in every one of them
+    const auto tileInWindow = static_cast<int>(inWindow) / Const::tileSize;
+    for (auto window = 0; window < Const::Banking::chrWindowCount; window++) {
+        if (m_chrBanks[window] == bank) {
+            m_cartridge.invalidatePatternTiles(window * Const::Banking::chrWindowTiles + tileInWindow, 1);
+        }
+    }
+}
+
+void Nes::BaseMapper::rebase(const Byte* previousPRG, const Byte* currentPRG, const Byte* previousCHR,
+                             const Byte* currentCHR)
+{
+    for (auto& bank : m_prgBanks) {
+        if (bank != nullptr) {
+            bank = currentPRG + (bank - previousPRG);
+        }
+    }
+
+    if (!m_chrWritable) {
+        for (auto& bank : m_chrBanks) {
+            if (bank != nullptr) {
+                bank = currentCHR + (bank - previousCHR);
+            }
+        }
+    }
+
+    m_prgMappingVersion++;
+}
+
+void Nes::BaseMapper::handleA12Rise() {
+}
+
+std::optional<int> Nes::BaseMapper::a12RisesUntilIrq() const {
+    return std::nullopt;
+}
+
+void Nes::BaseMapper::saveState(Utils::StateWriter&) const {
+}
+
+void Nes::BaseMapper::loadState(Utils::StateReader&) {
+}
+
+void Nes::BaseMapper::mapPRG(int firstWindow, std::size_t bankSize, int bank) {
+    const auto prg = m_cartridge.accessPRG();
+    if (prg.empty()) {
+        return;
+    }
+
+    // Data smaller than the bank, such as 16 KB of PRG seen through 32 KB, is repeated by wrapping around
+    const auto offset = bankOffset(prg.size(), bankSize, bank);
+    for (std::size_t i = 0; i < bankSize / Const::Banking::prgWindowSize; i++) {
+        m_prgBanks[firstWindow + i] = prg.data() + (offset + i * Const::Banking::prgWindowSize) % prg.size();
+    }
+
+    m_prgMappingVersion++;
+}
+
+void Nes::BaseMapper::mapCHR(int firstWindow, std::size_t bankSize, int bank) {
+    const auto chr = m_cartridge.accessCHR();
+    if (chr.empty()) {
+        return;
+    }
+
+    const auto offset = bankOffset(chr.size(), bankSize, bank);
+    for (std::size_t i = 0; i < bankSize / Const::Banking::chrWindowSize; i++) {
+        const auto  window      = firstWindow + static_cast<int>(i);
+        const auto* bankPointer = chr.data() + (offset + i * Const::Banking::chrWindowSize) % chr.size();
+        if (m_chrBanks[window] != bankPointer) {
+            m_chrBanks[window] = bankPointer;
+            invalidatePatternWindow(window);
+        }
+    }
+}
+
+void Nes::BaseMapper::invalidatePatternWindow(int window) {
+    m_cartridge.invalidatePatternTiles(window * Const::Banking::chrWindowTiles, Const::Banking::chrWindowTiles);
+}
+
+void Nes::BaseMapper::setMirroring(Mirroring mirroring) {
+    m_cartridge.setMirroring(mirroring);
+}
+
+void Nes::BaseMapper::raiseIrq() {
+    m_cartridge.setIrqAsserted(true);
+}
+
+void Nes::BaseMapper::acknowledgeIrq() {
+    m_cartridge.setIrqAsserted(false);
+}
+
+void Nes::BaseMapper::synchronizePPU() {
+    m_cartridge.synchronizePPU();
+}
+
+bool Nes::BaseMapper::isWholeBanks(int sizeInKilobytes, std::size_t bankSize) {
+    return Utils::kilobytesToBytes(sizeInKilobytes) % bankSize == 0;
+}
+
+std::size_t Nes::BaseMapper::bankOffset(std::size_t dataSize, std::size_t bankSize, int bank) {
+    const auto bankCount = static_cast<int>(std::max<std::size_t>(dataSize / bankSize, 1));
+    const auto wrapped   = ((bank % bankCount) + bankCount) % bankCount;
+
+    return (static_cast<std::size_t>(wrapped) * bankSize) % dataSize;
+}
@@ -19,38 +19,118 @@
 #ifndef CAIQUE_NES_BASEMAPPER_HPP
 #define CAIQUE_NES_BASEMAPPER_HPP
 
+#include <array>
+#include <cstdint>
 #include <functional>
 #include <expected>
 #include <memory>
+#include <optional>
+#include "Utils/StateStream.hpp"
 #include "Utils/Types.hpp"
 #include "Utils/Data.hpp"
 
 namespace Nes {
     class Cartridge;
+    enum class Mirroring;
 
     using MapperValidationFunction = std::function<bool(std::size_t, std::size_t)>;
 
+    namespace Const::Banking {
+        // $8000-$FFFF is seen through four 8 KB windows and the pattern tables through eight 1 KB windows, which is the
+        // finest granularity any supported mapper switches at
+        constexpr std::size_t prgWindowSize  = Utils::kilobytesToBytes(8);
+        constexpr int         prgWindowShift = 13;
+        constexpr int         prgWindowCount = 4;
+
+        constexpr std::size_t chrWindowSize  = Utils::kilobytesToBytes(1);
+        constexpr int         chrWindowShift = 10;
+        constexpr int         chrWindowCount = 8;
+        constexpr int         chrWindowTiles = 64;
+    }
+
     enum class Mapper {
-        NROM
+        NROM,
+        MMC1,
+        UxROM,
+        CNROM,
+        MMC3
     };
 
+    // Mappers only decide which banks are visible, reads go through the bank pointer tables without any virtual
+    // call. The tables change only when a mapper switches banks, which bumps prgMappingVersion for PRG so that
+    // the MMU knows to refresh its cartridge pages.
     class BaseMapper {
     public:
-        static std::unique_ptr<BaseMapper> createFromID(Cartridge& cartridge, Byte id, std::size_t sizeOfPRG,
+        static std::unique_ptr<BaseMapper> createFromID(Cartridge& cartridge, std::uint16_t id, std::size_t sizeOfPRG,
                                                         std::size_t sizeOfCHR);
 
+        static bool isImplemented(std::uint16_t id);
+
+        // Whether createFromID would succeed, sizes are given in bytes
+        static bool isSupported(std::uint16_t id, std::size_t prgSizeInBytes, std::size_t chrSizeInBytes);
+
         BaseMapper(Cartridge& cartridge, std::size_t sizeOfPRG, std::size_t sizeOfCHR, Byte mapperId,
                    const MapperValidationFunction& validationFn);
         virtual ~BaseMapper() = default;
 
-        virtual Byte readPRG(Addr addr) const = 0;
+        Byte readPRG(Addr addr) const;
+        const Byte* readPRGPointer(Addr addr) const;
+        std::uint32_t prgMappingVersion() const;
+
+        // Cartridge writes usually land in bank registers, which is all that is left for the mappers to implement
         virtual void writePRG(Addr addr, Byte value) = 0;
 
-        virtual Byte readCHR(Addr addr) const = 0;
-        virtual void writeCHR(Addr addr, Byte value) = 0;
+        Byte readCHR(Addr addr) const;
+        void writeCHR(Addr addr, Byte value);
+
+        // Moves the bank tables over to a copy of the ROM data, keeping the same banks mapped
+        void rebase(const Byte* previousPRG, const Byte* currentPRG, const Byte* previousCHR, const Byte* currentCHR);
+
+        // Called by the PPU for every rendered scanline on which PPU address line A12 rises, which is what scanline
+        // counters count. Mappers without one ignore it and never expect an IRQ.
+        virtual void handleA12Rise();
+        virtual std::optional<int> a12RisesUntilIrq() const;
+
+        // Bank registers and other mutable mapper state, stateless mappers keep the empty defaults. Restoring the
+        // state has to map the banks again.
+        virtual void saveState(Utils::StateWriter& writer) const;
+        virtual void loadState(Utils::StateReader& reader);
 
     protected:
         Cartridge& m_cartridge;
+
+        // Cartridges without CHR ROM are given RAM instead, which can be written through the cartridge's CHR RAM
+        bool m_chrWritable = false;
+
+        // Maps bank number `bank` of `bankSize` bytes to the windows starting at `firstWindow`. Bank numbers wrap
+        // around the available data and negative ones count from the last bank.
+        void mapPRG(int firstWindow, std::size_t bankSize, int bank);
+        void mapCHR(int firstWindow, std::size_t bankSize, int bank);
+
+        // Has to be called whenever a different CHR bank is mapped into a window, mapCHR does so for the windows it
+        // actually changes
+        void invalidatePatternWindow(int window);
+
+        void setMirroring(Mirroring mirroring);
+
+        // The mapper's IRQ line, shared with the other sources on the CPU
+        void raiseIrq();
+        void acknowledgeIrq();
+
+        // Brings the PPU up to the CPU's clock, the scanline counter must not change while the PPU lags behind
+        void synchronizePPU();
+
+        // Whether data of `sizeInKilobytes` splits into whole banks of `bankSize` bytes. Mappers have to reject any
+        // other size, a partial bank would let the bank tables point past the end of the data.
+        static bool isWholeBanks(int sizeInKilobytes, std::size_t bankSize);
+
+    private:
+        std::array<const Byte*, Const::Banking::prgWindowCount> m_prgBanks{};
+        std::array<const Byte*, Const::Banking::chrWindowCount> m_chrBanks{};
+
+        std::uint32_t m_prgMappingVersion = 0;
+
+        static std::size_t bankOffset(std::size_t dataSize, std::size_t bankSize, int bank);
     };
 }
 
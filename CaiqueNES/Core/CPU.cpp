@@ -28,13 +28,40 @@ Nes::Registers::Registers() :
 {
 }
 
-Nes::CPU::CPU(MMU& mmu, PPU& ppu) :
+Nes::CPU::CPU(MMU& mmu, PPU& ppu, Scheduler& scheduler) :
     m_mmu(mmu),
-    m_ppu(ppu)
+    m_ppu(ppu),
+    m_scheduler(scheduler)
 {
+    m_scheduler.setHandler(EventType::Nmi, [this] {
+        if (m_ppu.nmiStatus()) {
+            handleNMI();
+        }
+    });
+
+    // A masked IRQ is dropped here and picked up again by pollIrq once the interrupt disable flag is cleared
+    m_scheduler.setHandler(EventType::Irq, [this] {
+        if (m_scheduler.isIrqAsserted() && !m_registers.status.isBitSet(CPUFlag::InterruptDisable)) {
+            handleIRQ();
+        }
+    });
 }
 
 void Nes::CPU::handleNMI() {
+    pushInterruptFrame();
+
+    m_scheduler.advance(Const::nmiTicks);
+    m_registers.programCounter = readVector(Const::VectorAddr::interrupt);
+}
+
+void Nes::CPU::handleIRQ() {
+    pushInterruptFrame();
+
+    m_scheduler.advance(Const::irqTicks);
+    m_registers.programCounter = readVector(Const::VectorAddr::irq);
+}
+
+void Nes::CPU::pushInterruptFrame() {
     pushWordToStack(m_registers.programCounter);
 
     Byte statusCopy = m_registers.status.getCombinedValue();
@@ -44,27 +71,43 @@ void Nes::CPU::handleNMI() {
     pushToStack(statusCopy);
 
     m_registers.status.setBit(CPUFlag::InterruptDisable);
+}
 
-    m_ppu.tick(Const::nmiTicks);
-    m_registers.programCounter = readVector(Const::VectorAddr::interrupt);
+// The IRQ line is level triggered, an IRQ which was masked while it got asserted is still pending
+void Nes::CPU::pollIrq() {
+    if (m_scheduler.isIrqAsserted() && !m_registers.status.isBitSet(CPUFlag::InterruptDisable)) {
+        m_scheduler.schedule(EventType::Irq, m_scheduler.now());
+    }
 }
 
 void Nes::CPU::loadProgramCounter() {
     m_registers.programCounter = readVector(Const::VectorAddr::reset);
 }
 
-Nes::CycleCount Nes::CPU::tick() {
-    if (m_ppu.nmiStatus()) {
-        handleNMI();
-    }
+void Nes::CPU::saveState(Utils::StateWriter& writer) const {
+    writer.write(m_registers.accumulator);
+    writer.write(m_registers.xIndex);
+    writer.write(m_registers.yIndex);
+    writer.write(m_registers.status.getCombinedValue());
+    writer.write(m_registers.stackPointer);
+    writer.write(m_registers.programCounter);
 
-    const auto opcode = readOpcode();
-    const auto cyclesTaken = executeOpcode(opcode);
-    m_cycles += cyclesTaken;
+    writer.write(m_cycles);
+    writer.write(m_pageBoundaryCrossed);
+    writer.write(m_instructionsExecuted);
+}
 
-    m_ppu.tick(cyclesTaken);
+void Nes::CPU::loadState(Utils::StateReader& reader) {
+    reader.read(m_registers.accumulator);
+    reader.read(m_registers.xIndex);
+    reader.read(m_registers.yIndex);
+    m_registers.status.setCombinedValue(reader.read<Byte>());
+    reader.read(m_registers.stackPointer);
+    reader.read(m_registers.programCounter);
 
-    return cyclesTaken;
+    reader.read(m_cycles);
+    reader.read(m_pageBoundaryCrossed);
+    reader.read(m_instructionsExecuted);
 }
 
 Nes::Addr Nes::CPU::normalizeForZeroPage(Addr addr) {
@@ -75,22 +118,6 @@ bool Nes::CPU::didPageCrossHappen(Addr firstAddr, Addr secondAddr) {
     return Utils::getUpperByte(firstAddr) != Utils::getUpperByte(secondAddr);
 }
 
-int Nes::CPU::howMuchWasProgramCounterIncremented(AddressingMode addressingMode) {
-    switch (addressingMode) {
-        case AddressingMode::Absolute:
-        case AddressingMode::AbsoluteY:
-        case AddressingMode::AbsoluteX:
-            return 2;
-
-        case AddressingMode::JumpIndirect:
-        case AddressingMode::Implicit:
-            throw std::logic_error("Attempting to see how much was PC incremented in implicit/jump addressing mode");
-
-        default:
-            return 1;
-    }
-}
-
 Nes::CycleCount Nes::CPU::cyclesAccountingForPageCross(CycleCount baseCycles) const {
     return m_pageBoundaryCrossed ? baseCycles + 1 : baseCycles;
 }
@@ -103,98 +130,6 @@ Nes::Addr Nes::CPU::readVector(Addr vectorAddr) const {
     return m_mmu.readWord(vectorAddr);
 }
 
-Nes::Addr Nes::CPU::readAddressOperand(AddressingMode addressingMode) {
-    switch (addressingMode) {
-        case AddressingMode::Implicit:
-            throw std::logic_error("Attempting to fetch operand address in implicit addressing mode");
-
-        case AddressingMode::Relative:
-        case AddressingMode::Immediate:
-            return m_registers.programCounter++;
-
-        case AddressingMode::Absolute: {
-            const auto addr = m_registers.programCounter;
-            m_registers.programCounter += 2;
-
-            return m_mmu.readWord(addr);
-        }
-
-        case AddressingMode::AbsoluteX: {
-            const auto ptr      = readAddressOperand(AddressingMode::Absolute);
-            const Addr finalPtr = ptr + m_registers.xIndex;
-
-            m_pageBoundaryCrossed = didPageCrossHappen(ptr, finalPtr);
-            return finalPtr;
-        }
-
-        case AddressingMode::AbsoluteY: {
-            const auto ptr      = readAddressOperand(AddressingMode::Absolute);
-            const Addr finalPtr = ptr + m_registers.yIndex;
-
-            m_pageBoundaryCrossed = didPageCrossHappen(ptr, finalPtr);
-            return finalPtr;
-        }
-
-        case AddressingMode::ZeroPage: {
-            const auto addr = m_mmu.read(m_registers.programCounter++);
-            return normalizeForZeroPage(addr);
-        }
-
-        case AddressingMode::ZeroPageX: {
-            const auto ptr = readAddressOperand(AddressingMode::ZeroPage);
-            return normalizeForZeroPage(ptr + m_registers.xIndex);
-        }
-
-        case AddressingMode::ZeroPageY: {
-            const auto ptr = readAddressOperand(AddressingMode::ZeroPage);
-            return normalizeForZeroPage(ptr + m_registers.yIndex);
-        }
-
-        case AddressingMode::IndirectX: {
-            const Byte zpPtrLower = m_mmu.read(m_registers.programCounter++) + m_registers.xIndex;
-            const Byte zpPtrUpper = zpPtrLower + 1;
-            return Utils::combineBytes(m_mmu.read(normalizeForZeroPage(zpPtrUpper)), m_mmu.read(normalizeForZeroPage(zpPtrLower)));
-        }
-
-        case AddressingMode::IndirectY: {
-            const Byte zpPtrLower = m_mmu.read(m_registers.programCounter++);
-            const Byte zpPtrUpper = zpPtrLower + 1;
-
-            const auto ptr = Utils::combineBytes(m_mmu.read(normalizeForZeroPage(zpPtrUpper)), m_mmu.read(normalizeForZeroPage(zpPtrLower)));
-            const Addr finalPtr = ptr + m_registers.yIndex;
-
-            m_pageBoundaryCrossed = didPageCrossHappen(ptr, finalPtr);
-            return finalPtr;
-        }
-
-        case AddressingMode::JumpIndirect: {
-            const auto address = readAddressOperand(AddressingMode::Absolute);
-
-            if (Utils::getLowerByte(address) == Const::AddrRange::zeroPage.to) {
-                const Addr upperByteAddr = Utils::combineBytes(Utils::getUpperByte(address), 0x00);
-                const Byte upperByte     = m_mmu.read(upperByteAddr);
-                const Byte lowerByte     = m_mmu.read(address);
-
-                return Utils::combineBytes(upperByte, lowerByte);
-            } else {
-                return m_mmu.readWord(address);
-            }
-        }
-
-        default:
-            throw std::logic_error("Unhandled addressing mode: " + std::to_string(static_cast<int>(addressingMode)));
-    }
-}
-
-Nes::Byte Nes::CPU::readOperand(AddressingMode addressingMode) {
-    if (addressingMode == AddressingMode::Accumulator) {
-        return m_registers.accumulator;
-    }
-
-    const auto addr = readAddressOperand(addressingMode);
-    return m_mmu.read(addr);
-}
-
 void Nes::CPU::pushToStack(Byte value) {
     m_mmu.write(m_registers.stackPointer + Const::stackAddr, value);
     m_registers.stackPointer--;
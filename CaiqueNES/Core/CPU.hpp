@@ -19,10 +19,13 @@
 #ifndef CAIQUE_NES_CPU_HPP
 #define CAIQUE_NES_CPU_HPP
 
-#include <optional>
+#include <array>
+#include <concepts>
+#include <cstdint>
 #include <utility>
 #include "Core/PPU.hpp"
 #include "Core/MMU.hpp"
+#include "Core/Scheduler.hpp"
 #include "Utils/Types.hpp"
 
 #ifdef TESTING_ENVIRONMENT_6502
@@ -55,7 +58,9 @@ namespace Nes {
         constexpr bool logCpuJam  = true;
         constexpr bool logIllegal = true;
 #endif
-        constexpr int nmiTicks = 2;
+        constexpr int nmiTicks    = 2;
+        constexpr int irqTicks    = 7;
+        constexpr int opcodeCount = 256;
 
         namespace DefaultValue {
             constexpr Byte accumulator    = 0;
@@ -67,20 +72,79 @@ namespace Nes {
         }
     }
 
-    enum class AddressingMode {
-        Implicit,
-        Immediate,
-        ZeroPage,
-        ZeroPageX,
-        ZeroPageY,
-        Absolute,
-        AbsoluteX,
-        AbsoluteY,
-        IndirectX,
-        IndirectY,
-        Relative,
-        Accumulator,
-        JumpIndirect
+    // Addressing modes are compile-time policies, instruction helpers are instantiated once per mode so that the operand
+    // fetch and the page cross check are resolved without branching on the mode at runtime
+    namespace AddressingMode {
+        struct Implicit {
+            static constexpr int operandSize   = 0;
+            static constexpr bool canCrossPage = false;
+        };
+
+        struct Accumulator {
+            static constexpr int operandSize   = 0;
+            static constexpr bool canCrossPage = false;
+        };
+
+        struct Immediate {
+            static constexpr int operandSize   = 1;
+            static constexpr bool canCrossPage = false;
+        };
+
+        struct Relative {
+            static constexpr int operandSize   = 1;
+            static constexpr bool canCrossPage = false;
+        };
+
+        struct ZeroPage {
+            static constexpr int operandSize   = 1;
+            static constexpr bool canCrossPage = false;
+        };
+
+        struct ZeroPageX {
+            static constexpr int operandSize   = 1;
+            static constexpr bool canCrossPage = false;
+        };
+
+        struct ZeroPageY {
+            static constexpr int operandSize   = 1;
+            static constexpr bool canCrossPage = false;
+        };
+
+        struct Absolute {
+            static constexpr int operandSize   = 2;
+            static constexpr bool canCrossPage = false;
+        };
+
+        struct AbsoluteX {
+            static constexpr int operandSize   = 2;
+            static constexpr bool canCrossPage = true;
+        };
+
+        struct AbsoluteY {
+            static constexpr int operandSize   = 2;
+            static constexpr bool canCrossPage = true;
+        };
+
+        struct IndirectX {
+            static constexpr int operandSize   = 1;
+            static constexpr bool canCrossPage = false;
+        };
+
+        struct IndirectY {
+            static constexpr int operandSize   = 1;
+            static constexpr bool canCrossPage = true;
+        };
+
+        struct JumpIndirect {
+            static constexpr int operandSize   = 2;
+            static constexpr bool canCrossPage = false;
+        };
+    }
+
+    template <typename T>
+    concept AddressingModePolicy = requires {
+        { T::operandSize } -> std::convertible_to<int>;
+        { T::canCrossPage } -> std::convertible_to<bool>;
     };
 
     enum class CPUFlag {
@@ -112,92 +176,122 @@ namespace Nes {
 
     class CPU {
     public:
-        CPU(MMU& mmu, PPU& ppu);
+        CPU(MMU& mmu, PPU& ppu, Scheduler& scheduler);
 
         void loadProgramCounter();
 
+        // Both return the cycles the scheduler's clock advanced by, including interrupt handling and DMA stalls
         [[nodiscard]] CycleCount tick();
+        CycleCount run(CycleCount cycleBudget);
+
+        [[nodiscard]] std::uint64_t instructionsExecuted() const;
+
+        void saveState(Utils::StateWriter& writer) const;
+        void loadState(Utils::StateReader& reader);
 
     private:
+        using OpcodeHandler      = CycleCount (*)(CPU&);
+        using InstructionHandler = void (CPU::*)();
+        using OpcodeTable        = std::array<OpcodeHandler, Const::opcodeCount>;
+
         MMU& m_mmu;
         PPU& m_ppu;
+        Scheduler& m_scheduler;
 
         Registers m_registers{};
 
         CycleCount m_cycles = Const::cpuInitialCycles;
         bool m_pageBoundaryCrossed = false;
 
+        std::uint64_t m_instructionsExecuted = 0;
+
         void handleNMI();
+        void handleIRQ();
+        void pushInterruptFrame();
+        void pollIrq();
+        void finishInstruction(CycleCount cyclesTaken);
 
         /* Utils */
         static Addr normalizeForZeroPage(Addr addr);
         static bool didPageCrossHappen(Addr firstAddr, Addr secondAddr);
-        static int howMuchWasProgramCounterIncremented(AddressingMode addressingMode);
         CycleCount cyclesAccountingForPageCross(CycleCount baseCycles) const;
 
         /* Memory Helpers */
         Byte readOpcode();
         Addr readVector(Addr vectorAddr) const;
-        Addr readAddressOperand(AddressingMode addressingMode);
-        Byte readOperand(AddressingMode addressingMode);
+        template <AddressingModePolicy Mode> Addr readAddressOperand();
+        template <AddressingModePolicy Mode> Byte readOperand();
         void pushToStack(Byte value);
         void pushWordToStack(Word value);
         Byte popFromStack();
         Word popWordFromStack();
 
-        /* Official Instruction Helpers */
+        /* Dispatch */
+        static consteval OpcodeTable buildOpcodeTable();
         CycleCount executeOpcode(Byte opcode);
+        template <Byte opcode> CycleCount executeOpcode();
+        template <InstructionHandler instruction, CycleCount cycles> static CycleCount execute(CPU& cpu);
+        template <InstructionHandler instruction, CycleCount cycles> static CycleCount executeWithPageCross(CPU& cpu);
+        template <CPUFlag flag, bool expectedValue> static CycleCount branchOn(CPU& cpu);
+        template <Byte opcode> static CycleCount invalidOpcode(CPU& cpu);
+
+        /* Official Instruction Helpers */
         CycleCount branch(bool condition);
-        void storeValue(Byte value, AddressingMode addressingMode);
-        void loadValue(Byte& target, AddressingMode addressingMode);
-        void addWithCarry(AddressingMode addressingMode);
-        void subWithCarry(AddressingMode addressingMode);
-        void bitwiseAnd(AddressingMode addressingMode);
-        void bitwiseOr(AddressingMode addressingMode);
-        void bitwiseXor(AddressingMode addressingMode);
-        void arithmeticShiftLeft(AddressingMode addressingMode);
-        void logicalShiftRight(AddressingMode addressingMode);
-        void rotateLeft(AddressingMode addressingMode);
-        void rotateRight(AddressingMode addressingMode);
-        void testBit(AddressingMode addressingMode);
-        void compare(Byte compareWith, AddressingMode addressingMode);
-        void increment(Byte& target);
-        void decrement(Byte& target);
-        void incrementMemory(AddressingMode addressingMode);
-        void decrementMemory(AddressingMode addressingMode);
-        void jump(AddressingMode addressingMode);
-        void call(AddressingMode addressingMode);
+        template <Byte Registers::* source, AddressingModePolicy Mode> void storeValue();
+        template <Byte Registers::* destination, AddressingModePolicy Mode> void loadValue();
+        template <AddressingModePolicy Mode> void addWithCarry();
+        template <AddressingModePolicy Mode> void subWithCarry();
+        template <AddressingModePolicy Mode> void bitwiseAnd();
+        template <AddressingModePolicy Mode> void bitwiseOr();
+        template <AddressingModePolicy Mode> void bitwiseXor();
+        template <AddressingModePolicy Mode> void arithmeticShiftLeft();
+        template <AddressingModePolicy Mode> void logicalShiftRight();
+        template <AddressingModePolicy Mode> void rotateLeft();
+        template <AddressingModePolicy Mode> void rotateRight();
+        template <AddressingModePolicy Mode> void testBit();
+        template <Byte Registers::* source, AddressingModePolicy Mode> void compare();
+        template <Byte Registers::* destination> void increment();
+        template <Byte Registers::* destination> void decrement();
+        template <AddressingModePolicy Mode> void incrementMemory();
+        template <AddressingModePolicy Mode> void decrementMemory();
+        template <AddressingModePolicy Mode> void jump();
+        template <AddressingModePolicy Mode> void call();
+        template <CPUFlag flag> void setFlag();
+        template <CPUFlag flag> void clearFlag();
+        void clearInterruptDisable();
         void fnReturn();
         void interruptReturn();
-        void transfer(Byte from, Byte& to);
+        template <Byte Registers::* source, Byte Registers::* destination> void transfer();
         void pushStatus();
         void popStatus();
+        void pushAccumulatorToStack();
         void popAccumulatorFromStack();
+        void setStackPointerToX();
         void setXToStackPointer();
         void instructionBreak();
 
         /* Illegal Instruction Helpers */
-        void shx(AddressingMode addressingMode);
-        void shy(AddressingMode addressingMode);
-        void sha(AddressingMode addressingMode);
-        void sax(AddressingMode addressingMode);
-        void lax(AddressingMode addressingMode);
-        void dcp(AddressingMode addressingMode);
-        void las(AddressingMode addressingMode);
-        void isc(AddressingMode addressingMode);
-        void rra(AddressingMode addressingMode);
-        void rla(AddressingMode addressingMode);
-        void sre(AddressingMode addressingMode);
-        void slo(AddressingMode addressingMode);
-        void anc(AddressingMode addressingMode);
-        void sbx(AddressingMode addressingMode);
-        void ane(AddressingMode addressingMode);
-        void alr(AddressingMode addressingMode);
+        template <AddressingModePolicy Mode> void shx();
+        template <AddressingModePolicy Mode> void shy();
+        template <AddressingModePolicy Mode> void sha();
+        template <AddressingModePolicy Mode> void sax();
+        template <AddressingModePolicy Mode> void lax();
+        template <AddressingModePolicy Mode> void dcp();
+        template <AddressingModePolicy Mode> void las();
+        template <AddressingModePolicy Mode> void isc();
+        template <AddressingModePolicy Mode> void rra();
+        template <AddressingModePolicy Mode> void rla();
+        template <AddressingModePolicy Mode> void sre();
+        template <AddressingModePolicy Mode> void slo();
+        template <AddressingModePolicy Mode> void anc();
+        template <AddressingModePolicy Mode> void sbx();
+        template <AddressingModePolicy Mode> void ane();
+        template <AddressingModePolicy Mode> void alr();
 
         /* Other instruction Helpers */
         void jam();
-        void nop(std::size_t instructionSize, std::optional<AddressingMode> addressingMode = std::nullopt);
-        void unhandledInstruction(Byte opcode, AddressingMode addressingMode);
+        template <AddressingModePolicy Mode> void nop();
+        template <Byte opcode, AddressingModePolicy Mode> void unhandledInstruction();
 
 #ifdef TESTING_ENVIRONMENT_BLARGG
     public:
@@ -317,4 +411,6 @@ namespace Nes {
     };
 }
 
+#include "Core/CPU.tpp"
+
 #endif //CAIQUE_NES_CPU_HPP
@@ -0,0 +1,97 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#ifndef CAIQUE_NES_CPU_TPP
+#define CAIQUE_NES_CPU_TPP
+
+#include "Core/CPU.hpp"
+
+template <Nes::AddressingModePolicy Mode>
+Nes::Addr Nes::CPU::readAddressOperand() {
+    using namespace AddressingMode;
+
+    if constexpr (std::same_as<Mode, Relative> || std::same_as<Mode, Immediate>) {
+        return m_registers.programCounter++;
+    } else if constexpr (std::same_as<Mode, Absolute>) {
+        const auto addr = m_registers.programCounter;
+        m_registers.programCounter += 2;
+
+        return m_mmu.readWord(addr);
+    } else if constexpr (std::same_as<Mode, AbsoluteX>) {
+        const auto ptr      = readAddressOperand<Absolute>();
+        const Addr finalPtr = ptr + m_registers.xIndex;
+
+        m_pageBoundaryCrossed = didPageCrossHappen(ptr, finalPtr);
+        return finalPtr;
+    } else if constexpr (std::same_as<Mode, AbsoluteY>) {
+        const auto ptr      = readAddressOperand<Absolute>();
+        const Addr finalPtr = ptr + m_registers.yIndex;
+
+        m_pageBoundaryCrossed = didPageCrossHappen(ptr, finalPtr);
+        return finalPtr;
+    } else if constexpr (std::same_as<Mode, ZeroPage>) {
+        const auto addr = m_mmu.read(m_registers.programCounter++);
+        return normalizeForZeroPage(addr);
+    } else if constexpr (std::same_as<Mode, ZeroPageX>) {
+        const auto ptr = readAddressOperand<ZeroPage>();
+        return normalizeForZeroPage(ptr + m_registers.xIndex);
+    } else if constexpr (std::same_as<Mode, ZeroPageY>) {
+        const auto ptr = readAddressOperand<ZeroPage>();
+        return normalizeForZeroPage(ptr + m_registers.yIndex);
+    } else if constexpr (std::same_as<Mode, IndirectX>) {
+        const Byte zpPtrLower = m_mmu.read(m_registers.programCounter++) + m_registers.xIndex;
+        const Byte zpPtrUpper = zpPtrLower + 1;
+        return Utils::combineBytes(m_mmu.read(normalizeForZeroPage(zpPtrUpper)), m_mmu.read(normalizeForZeroPage(zpPtrLower)));
+    } else if constexpr (std::same_as<Mode, IndirectY>) {
+        const Byte zpPtrLower = m_mmu.read(m_registers.programCounter++);
+        const Byte zpPtrUpper = zpPtrLower + 1;
+
+        const auto ptr = Utils::combineBytes(m_mmu.read(normalizeForZeroPage(zpPtrUpper)), m_mmu.read(normalizeForZeroPage(zpPtrLower)));
+        const Addr finalPtr = ptr + m_registers.yIndex;
+
+        m_pageBoundaryCrossed = didPageCrossHappen(ptr, finalPtr);
+        return finalPtr;
+    } else if constexpr (std::same_as<Mode, JumpIndirect>) {
+        const auto address = readAddressOperand<Absolute>();
+
+        if (Utils::getLowerByte(address) == Const::AddrRange::zeroPage.to) {
+            const Addr upperByteAddr = Utils::combineBytes(Utils::getUpperByte(address), 0x00);
+            const Byte upperByte     = m_mmu.read(upperByteAddr);
+            const Byte lowerByte     = m_mmu.read(address);
+
+            return Utils::combineBytes(upperByte, lowerByte);
+        } else {
+            return m_mmu.readWord(address);
+        }
+    } else {
+        static_assert(!std::same_as<Mode, Implicit> && !std::same_as<Mode, Accumulator>,
+                      "Attempting to fetch operand address in implicit/accumulator addressing mode");
+    }
+}
+
+template <Nes::AddressingModePolicy Mode>
+Nes::Byte Nes::CPU::readOperand() {
+    if constexpr (std::same_as<Mode, AddressingMode::Accumulator>) {
+        return m_registers.accumulator;
+    } else {
+        const auto addr = readAddressOperand<Mode>();
+        return m_mmu.read(addr);
+    }
+}
+
+#endif //CAIQUE_NES_CPU_TPP
@@ -17,13 +17,24 @@
 ***********************************************************************************************************************/
 
 #include <stdexcept>
-#include <cstring>
+#include <algorithm>
 #include "Core/Cartridge.hpp"
 #include "Utils/String.hpp"
-#include "Utils/Host.hpp"
+
+namespace {
+    // std::span has no bounds checked access, the direct accessors keep vector::at's behaviour
+    Nes::Addr checkedIndex(std::span<const Nes::Byte> data, Nes::Addr addr, const char* name) {
+        if (addr >= data.size()) {
+            throw std::out_of_range(std::string(name) + " address out of range: " +
+                                    Utils::convertToHexString(addr, true));
+        }
+
+        return addr;
+    }
+}
 
 std::expected<void, Utils::ErrorString> Nes::Cartridge::loadRawBytes(const std::vector<Byte>& bytes) {
-    const auto parseResult = parseBytes(bytes);
+    const auto parseResult = parseBytes(bytes, nullptr);
     if (!parseResult.has_value()) {
         return std::unexpected("Unable to parse ROM: " + parseResult.error());
     }
@@ -32,12 +43,13 @@ std::expected<void, Utils::ErrorString> Nes::Cartridge::loadRawBytes(const std::
 }
 
 std::expected<void, Utils::ErrorString> Nes::Cartridge::loadFromFilesystem(const std::string& path) {
-    const auto fileLoadResult = Utils::loadExternalFileToVector(path);
-    if (!fileLoadResult.has_value()) {
-        return std::unexpected("Unable to create Cartridge module due to: " + fileLoadResult.error());
+    auto imageLoadResult = RomImageCache::global().load(path);
+    if (!imageLoadResult.has_value()) {
+        return std::unexpected("Unable to create Cartridge module due to: " + imageLoadResult.error());
     }
 
-    const auto parseResult = parseBytes(fileLoadResult.value());
+    const auto image       = std::move(imageLoadResult.value());
+    const auto parseResult = parseBytes(image->bytes(), image);
     if (!parseResult.has_value()) {
         return std::unexpected("Unable to parse ROM: " + parseResult.error());
     }
@@ -45,12 +57,40 @@ std::expected<void, Utils::ErrorString> Nes::Cartridge::loadFromFilesystem(const
     return {};
 }
 
+void Nes::Cartridge::setRomIndex(std::shared_ptr<const RomIndex> romIndex) {
+    m_romIndex = std::move(romIndex);
+}
+
+bool Nes::Cartridge::isSharingImage() const {
+    return m_image != nullptr;
+}
+
+const Nes::RomHeader& Nes::Cartridge::header() const {
+    return m_header;
+}
+
+std::span<const Nes::Byte> Nes::Cartridge::trainer() const {
+    return m_trainer;
+}
+
 Nes::Mirroring Nes::Cartridge::mirroring() const {
     return m_mirroring;
 }
 
+void Nes::Cartridge::setMirroring(Mirroring mirroring) {
+    m_mirroring = mirroring;
+}
+
+bool Nes::Cartridge::hasCHRRam() const {
+    return m_hasCHRRam;
+}
+
+std::uint32_t Nes::Cartridge::checksum() const {
+    return m_checksum;
+}
+
 Nes::Byte Nes::Cartridge::directReadPRG(Addr addr) const {
-    return m_prg.at(addr);
+    return m_prg[checkedIndex(m_prg, addr, "PRG")];
 }
 
 Nes::Byte Nes::Cartridge::mappedReadPRG(Addr addr) const {
@@ -58,15 +98,59 @@ Nes::Byte Nes::Cartridge::mappedReadPRG(Addr addr) const {
 }
 
 Nes::Byte Nes::Cartridge::directReadCHR(Addr addr) const {
-    return m_chr.at(addr);
+    return m_chr[checkedIndex(m_chr, addr, "CHR")];
 }
 
 Nes::Byte Nes::Cartridge::mappedReadCHR(Addr addr) const {
     return m_mapper->readCHR(addr);
 }
 
+const Nes::PatternRow& Nes::Cartridge::mappedReadPatternRow(int tileIndex, int fineY) const {
+    if (!m_patternCache.isTileDecoded(tileIndex)) {
+        const Addr startingAddr = tileIndex * Const::tileSize;
+
+        std::array<Byte, Const::tileSize> tileBytes{0};
+        for (auto i = 0; i < Const::tileSize; i++) {
+            tileBytes[i] = mappedReadCHR(startingAddr + i);
+        }
+
+        m_patternCache.decodeTile(tileIndex, tileBytes);
+    }
+
+    return m_patternCache.getRow(tileIndex, fineY);
+}
+
+const Nes::Byte* Nes::Cartridge::directPRGPointer(Addr addr) const {
+    return &m_prg[checkedIndex(m_prg, addr, "PRG")];
+}
+
+const Nes::Byte* Nes::Cartridge::mappedPRGPointer(Addr addr) const {
+    if (m_mapper == nullptr) {
+        return nullptr;
+    }
+
+    return m_mapper->readPRGPointer(addr);
+}
+
+std::uint32_t Nes::Cartridge::prgMappingVersion() const {
+    return m_mapper != nullptr ? m_mapper->prgMappingVersion() : 0;
+}
+
+std::span<const Nes::Byte> Nes::Cartridge::accessPRG() const {
+    return m_prg;
+}
+
+std::span<const Nes::Byte> Nes::Cartridge::accessCHR() const {
+    return m_chr;
+}
+
+std::span<Nes::Byte> Nes::Cartridge::accessCHRRam() {
+    return m_chrRam;
+}
+
 void Nes::Cartridge::directWritePRG(Addr addr, Byte value) {
-    m_prg.at(addr) = value;
+    detachFromImage();
+    m_privateRom[m_trainer.size() + checkedIndex(m_prg, addr, "PRG")] = value;
 }
 
 void Nes::Cartridge::mappedWritePRG(Addr addr, Byte value) {
@@ -74,102 +158,173 @@ void Nes::Cartridge::mappedWritePRG(Addr addr, Byte value) {
 }
 
 void Nes::Cartridge::directWriteCHR(Addr addr, Byte value) {
-    m_chr.at(addr) = value;
+    if (m_hasCHRRam) {
+        m_chrRam.at(addr) = value;
+        return;
+    }
+
+    detachFromImage();
+    m_privateRom[m_trainer.size() + m_prg.size() + checkedIndex(m_chr, addr, "CHR")] = value;
 }
 
 void Nes::Cartridge::mappedWriteCHR(Addr addr, Byte value) {
     m_mapper->writeCHR(addr, value);
 }
 
-std::expected<void, Utils::ErrorString> Nes::Cartridge::parseBytes(const std::vector<Byte>& rawRomBytes) {
-    for (std::size_t i = Const::AddressOf::headerConstant; i < std::strlen(Const::headerConstant); i++) {
-        if (rawRomBytes[i] != Const::headerConstant[i]) {
-            return std::unexpected("Header constant check failed");
-        }
+void Nes::Cartridge::invalidatePatternCache() {
+    m_patternCache.invalidate();
+}
+
+void Nes::Cartridge::invalidatePatternTiles(int firstTile, int count) {
+    m_patternCache.invalidateTiles(firstTile, count);
+}
+
+void Nes::Cartridge::connectPPU(Scheduler& scheduler, EventHandler synchronizePPU) {
+    m_scheduler      = &scheduler;
+    m_synchronizePPU = std::move(synchronizePPU);
+}
+
+void Nes::Cartridge::synchronizePPU() {
+    if (m_synchronizePPU) {
+        m_synchronizePPU();
+    }
+}
+
+void Nes::Cartridge::setIrqAsserted(bool asserted) {
+    if (m_scheduler == nullptr) {
+        return;
     }
 
-    const std::size_t sizeOfPRG = rawRomBytes[Const::AddressOf::sizeOfPRG] * Const::prgSizeMultiplier;
-    const std::size_t sizeOfCHR = rawRomBytes[Const::AddressOf::sizeOfCHR] * Const::chrSizeMultiplier;
+    if (asserted) {
+        m_scheduler->raiseIrq(IrqSource::Mapper);
+    } else {
+        m_scheduler->acknowledgeIrq(IrqSource::Mapper);
+    }
+}
+
+void Nes::Cartridge::handleA12Rise() {
+    if (m_mapper != nullptr) {
+        m_mapper->handleA12Rise();
+    }
+}
 
-    Byte mapperUpperNibble = 0;
-    Byte mapperLowerNibble = 0;
-    for (auto currentFlag = Const::AddressOf::firstFlag; currentFlag <= Const::AddressOf::lastFlag; currentFlag++) {
-        parseFlagByte(rawRomBytes[currentFlag], currentFlag, mapperLowerNibble, mapperUpperNibble);
+std::optional<int> Nes::Cartridge::a12RisesUntilIrq() const {
+    if (m_mapper == nullptr) {
+        return std::nullopt;
     }
 
-    if (m_hasTrainer) {
-        return std::unexpected("ROMs with trainers are not supported");
+    return m_mapper->a12RisesUntilIrq();
+}
+
+// CHR ROM is part of the loaded file and left out, CHR RAM is as much machine state as the work RAM
+void Nes::Cartridge::saveState(Utils::StateWriter& writer) const {
+    m_mapper->saveState(writer);
+    if (m_hasCHRRam) {
+        writer.writeBytes(m_chrRam);
     }
+}
 
-    if (m_isNes2) {
-        return std::unexpected("NES 2.0 ROMs are not supported");
+void Nes::Cartridge::loadState(Utils::StateReader& reader) {
+    m_mapper->loadState(reader);
+    if (m_hasCHRRam) {
+        reader.readBytes(m_chrRam);
     }
 
-    try {
-        const Byte mapperId = (mapperUpperNibble << 4) | mapperLowerNibble;
-        m_mapper = BaseMapper::createFromID(*this, mapperId, sizeOfPRG, sizeOfCHR);
-        if (m_mapper == nullptr) {
-            return std::unexpected("Unsupported mapper with ID " + std::to_string(mapperId));
+    m_patternCache.invalidate();
+}
+
+std::expected<void, Utils::ErrorString> Nes::Cartridge::parseBytes(std::span<const Byte> rawRomBytes,
+                                                                   std::shared_ptr<const RomImage> image)
+{
+    const auto headerResult = RomHeader::parse(rawRomBytes);
+    if (!headerResult.has_value()) {
+        return std::unexpected(describeRomHeaderError(headerResult.error()));
+    }
+
+    auto header = headerResult.value();
+
+    // Shared images computed it when they were loaded
+    const auto checksum = image != nullptr && image->checksum().has_value() ? image->checksum().value() :
+                                                                               header.checksum(rawRomBytes);
+    if (m_romIndex != nullptr) {
+        if (const auto entry = m_romIndex->find(checksum); entry.has_value() && entry->isCorrected()) {
+            header.mapperId  = entry->mapperId;
+            header.submapper = entry->submapper;
+            header.mirroring = entry->mirroring;
+        }
+    }
+
+    // Everything that can reject the ROM is checked before any member changes, a failed load keeps the previous
+    // ROM running with its mapper and the MMU's pages intact
+    if (const auto supported = header.checkSupported(); !supported.has_value()) {
+        if (supported.error() == RomHeaderError::UnsupportedMapper) {
+            return std::unexpected("Unsupported mapper with ID " + std::to_string(header.mapperId));
         }
 
-    } catch (const std::invalid_argument& e) {
-        return std::unexpected(e.what());
+        return std::unexpected("Sanity check failed for mapper with ID " + std::to_string(header.mapperId));
     }
 
-    const std::size_t prgSizeInBytes = Utils::kilobytesToBytes(sizeOfPRG);
-    const std::size_t chrSizeInBytes = Utils::kilobytesToBytes(sizeOfCHR);
+    // The previous mapper's bank tables point into the data about to be replaced
+    m_mapper.reset();
 
-    m_prg.resize(prgSizeInBytes, 0x00);
-    m_chr.resize(chrSizeInBytes, 0x00);
+    m_header    = header;
+    m_mirroring = header.mirroring;
+    m_hasCHRRam = header.chrRomSize == 0;
 
-    std::copy(rawRomBytes.begin() + Const::headerSize,
-              rawRomBytes.begin() + Const::headerSize + prgSizeInBytes,
-              m_prg.begin());
+    // Sections follow each other in the file and are kept that way, detaching from the image is a single copy
+    auto romSections = header.romSections(rawRomBytes);
+    if (image == nullptr) {
+        m_privateRom.assign(romSections.begin(), romSections.end());
+        romSections = m_privateRom;
+    } else {
+        m_privateRom.clear();
+    }
 
-    std::copy(rawRomBytes.begin() + Const::headerSize + prgSizeInBytes,
-              rawRomBytes.begin() + Const::headerSize + prgSizeInBytes + chrSizeInBytes,
-              m_chr.begin());
+    m_image = std::move(image);
 
-    return {};
-}
+    // NES 2.0 headers give the CHR RAM size, older ones leave it to the common 8 KB
+    const auto chrRamSize = header.chrRamSize + header.chrNvRamSize;
+    m_chrRam.assign(m_hasCHRRam ? std::max(chrRamSize, Utils::kilobytesToBytes(Const::chrRamSize)) : 0, 0x00);
 
-void Nes::Cartridge::parseFlagByte(Byte flagByte, int flagIndex, Byte& mapperLowerNibble, Byte& mapperUpperNibble) {
-    switch (flagIndex) {
-        case 6:
-            if (Utils::isBitSet(flagByte, Const::BitIndex::Flag6::fourScreen)) {
-                m_mirroring = Mirroring::FourScreen;
-            } else {
-                m_mirroring = static_cast<Mirroring>(Utils::isBitSet(flagByte, Const::BitIndex::Flag6::mirroring));
-            }
+    sliceRomSections(romSections);
 
-            m_hasTrainer = Utils::isBitSet(flagByte, Const::BitIndex::Flag6::hasTrainer);
+    m_checksum = checksum;
 
-            mapperLowerNibble = flagByte >> 4;
-            break;
+    m_patternCache.invalidate();
 
-        case 7: {
-            const auto firstBit  = Utils::isBitSet(flagByte, Const::BitIndex::Flag7::ines2FirstBit);
-            const auto secondBit = Utils::isBitSet(flagByte, Const::BitIndex::Flag7::ines2SecondBit);
+    // Created last, mappers point their bank tables into the loaded data straight away. The sizes were accepted by
+    // checkSupported, which runs the same validation as the mapper's constructor.
+    const auto sizeOfPRG = header.prgRomSize / Utils::kilobytesToBytes(1);
+    const auto sizeOfCHR = header.chrRomSize / Utils::kilobytesToBytes(1);
 
-            m_isNes2 = ((secondBit << 1) | firstBit) == Const::ines2Value;
+    m_mapper = BaseMapper::createFromID(*this, header.mapperId, sizeOfPRG, sizeOfCHR);
 
-            mapperUpperNibble = flagByte >> 4;
-            break;
-        }
+    return {};
+}
 
-        case 8:
-            /* Ignore */
-            break;
+void Nes::Cartridge::detachFromImage() {
+    if (m_image == nullptr) {
+        return;
+    }
 
-        case 9:
-            m_tvSystem = static_cast<TVSystem>(Utils::isBitSet(flagByte, Const::BitIndex::Flag9::tvSystem));
-            break;
+    const Byte* previousPRG = m_prg.data();
+    const Byte* previousCHR = m_chr.data();
 
-        case 10:
-            m_isPRGRamPresent = Utils::isBitSet(flagByte, Const::BitIndex::Flag10::PRGRamPresent);
-            break;
+    const auto romSections = m_header.romSections(m_image->bytes());
+    m_privateRom.assign(romSections.begin(), romSections.end());
+    sliceRomSections(m_privateRom);
 
-        default:
-            throw std::invalid_argument("Invalid flag index: " + Utils::convertToHexString(flagIndex, true));
+    if (m_mapper != nullptr) {
+        m_mapper->rebase(previousPRG, m_prg.data(), previousCHR, m_chr.data());
     }
+
+    m_image.reset();
+}
+
+void Nes::Cartridge::sliceRomSections(std::span<const Byte> romSections) {
+    const auto trainerSize = m_header.hasTrainer ? Const::trainerSize : 0;
+
+    m_trainer = romSections.first(trainerSize);
+    m_prg     = romSections.subspan(trainerSize, m_header.prgRomSize);
+    m_chr     = m_hasCHRRam ? std::span<const Byte>(m_chrRam) : romSections.subspan(trainerSize + m_header.prgRomSize);
 }
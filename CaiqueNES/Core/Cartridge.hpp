@@ -20,93 +20,118 @@
 #define CAIQUE_NES_CARTRIDGE_HPP
 
 #include <expected>
+#include <span>
 #include <vector>
 #include <string>
 #include "Core/BaseMapper.hpp"
+#include "Core/PatternCache.hpp"
+#include "Core/RomHeader.hpp"
+#include "Core/RomImage.hpp"
+#include "Core/RomIndex.hpp"
+#include "Core/Scheduler.hpp"
 #include "Utils/Types.hpp"
 
 namespace Nes {
     namespace Const {
-        constexpr const char* headerConstant = "NES";
-        constexpr int headerSize             = 16;
-        constexpr int prgSizeMultiplier      = 16;
-        constexpr int chrSizeMultiplier      = 8;
-        constexpr int ines2Value             = 0x2;
-
-        namespace AddressOf {
-            constexpr Addr headerConstant = 0x0;
-            constexpr Addr sizeOfPRG      = 0x4;
-            constexpr Addr sizeOfCHR      = 0x5;
-
-            constexpr Addr firstFlag = 0x6;
-            constexpr Addr lastFlag  = 0xA;
-        }
-
-        namespace BitIndex {
-            namespace Flag6 {
-                constexpr int mirroring  = 0;
-                constexpr int hasTrainer = 2;
-                constexpr int fourScreen = 3;
-            }
-
-            namespace Flag7 {
-                constexpr int ines2FirstBit  = 2;
-                constexpr int ines2SecondBit = 3;
-            }
-
-            namespace Flag9 {
-                constexpr int tvSystem = 0;
-            }
-
-            namespace Flag10 {
-                constexpr int PRGRamPresent = 4;
-            }
-        }
+        constexpr int chrRamSize = 8;
     }
 
-    enum class Mirroring {
-        Horizontal,
-        Vertical,
-        FourScreen
-    };
-
-    enum class TVSystem {
-        NTSC,
-        PAL
-    };
-
     class Cartridge : Module {
     public:
+        // Raw bytes are copied into the cartridge, files are shared read-only through the global RomImageCache
         std::expected<void, Utils::ErrorString> loadRawBytes(const std::vector<Byte>& bytes);
         std::expected<void, Utils::ErrorString> loadFromFilesystem(const std::string& path);
 
+        // Corrections from the index replace the mapper and mirroring of matching ROMs on every following load
+        void setRomIndex(std::shared_ptr<const RomIndex> romIndex);
+
+        // Whether the ROM data is still the shared image, direct writes give the cartridge its own copy
+        bool isSharingImage() const;
+
+        const RomHeader& header() const;
+
+        // 512 bytes the header asks to be placed at $7000 before the game starts, empty for most ROMs
+        std::span<const Byte> trainer() const;
+
         Mirroring mirroring() const;
+        void setMirroring(Mirroring mirroring);
+
+        // Cartridges without CHR ROM come with CHR RAM instead
+        bool hasCHRRam() const;
+
+        // CRC-32 of the PRG and CHR ROM, identifies the loaded ROM
+        std::uint32_t checksum() const;
 
         Byte directReadPRG(Addr addr) const;
         Byte mappedReadPRG(Addr addr) const;
         Byte directReadCHR(Addr addr) const;
         Byte mappedReadCHR(Addr addr) const;
+        const PatternRow& mappedReadPatternRow(int tileIndex, int fineY) const;
+
+        const Byte* directPRGPointer(Addr addr) const;
+        const Byte* mappedPRGPointer(Addr addr) const;
+
+        // Changes whenever the mapper switches PRG banks, pointers from mappedPRGPointer are stale after that
+        std::uint32_t prgMappingVersion() const;
+
+        // Whole PRG and CHR data, which the mapper's bank tables point into
+        std::span<const Byte> accessPRG() const;
+        std::span<const Byte> accessCHR() const;
+
+        // Writable view of CHR RAM, empty for cartridges with CHR ROM
+        std::span<Byte> accessCHRRam();
 
         void directWritePRG(Addr addr, Byte value);
         void mappedWritePRG(Addr addr, Byte value);
         void directWriteCHR(Addr addr, Byte value);
         void mappedWriteCHR(Addr addr, Byte value);
 
+        void invalidatePatternCache();
+        void invalidatePatternTiles(int firstTile, int count);
+
+        // Wires the mapper's IRQ line to the CPU and lets it bring the PPU up to date, done by the PPU it is attached to
+        void connectPPU(Scheduler& scheduler, EventHandler synchronizePPU);
+        void synchronizePPU();
+        void setIrqAsserted(bool asserted);
+
+        void handleA12Rise();
+        std::optional<int> a12RisesUntilIrq() const;
+
+        void saveState(Utils::StateWriter& writer) const;
+        void loadState(Utils::StateReader& reader);
+
     private:
         std::unique_ptr<BaseMapper> m_mapper;
 
-        std::vector<Byte> m_prg;
-        std::vector<Byte> m_chr;
+        // Trainer, PRG and CHR ROM live either in the shared image or, for raw bytes and after direct writes, in m_privateRom.
+        // CHR RAM is always private to the cartridge.
+        std::shared_ptr<const RomImage> m_image;
+        std::vector<Byte> m_privateRom;
+        std::vector<Byte> m_chrRam;
+
+        std::span<const Byte> m_trainer;
+        std::span<const Byte> m_prg;
+        std::span<const Byte> m_chr;
+
+        RomHeader m_header;
+
+        mutable PatternCache m_patternCache;
+
+        std::uint32_t m_checksum = 0;
+
+        std::shared_ptr<const RomIndex> m_romIndex;
+
+        Scheduler*   m_scheduler = nullptr;
+        EventHandler m_synchronizePPU;
 
-        Mirroring m_mirroring;
-        TVSystem  m_tvSystem;
+        Mirroring m_mirroring = Mirroring::Horizontal;
 
-        bool m_hasTrainer;
-        bool m_isNes2;
-        bool m_isPRGRamPresent;
+        bool m_hasCHRRam = false;
 
-        std::expected<void, Utils::ErrorString> parseBytes(const std::vector<Byte>& rawRomBytes);
-        void parseFlagByte(Byte flagByte, int flagIndex, Byte& mapperLowerNibble, Byte& mapperUpperNibble);
+        std::expected<void, Utils::ErrorString> parseBytes(std::span<const Byte> rawRomBytes,
+                                                           std::shared_ptr<const RomImage> image);
+        void detachFromImage();
+        void sliceRomSections(std::span<const Byte> romSections);
 
 #ifdef TESTING_ENVIRONMENT_PPU
     public:
@@ -21,316 +21,445 @@
 #include "Utils/String.hpp"
 #include "Utils/Log.hpp"
 
+#if defined(CAIQUE_NES_COMPUTED_GOTO) && !defined(__GNUC__)
+#undef CAIQUE_NES_COMPUTED_GOTO
+#endif
+
+#ifdef CAIQUE_NES_COMPUTED_GOTO
+#define CAIQUE_NES_FOR_EACH_OPCODE(X) \
+    X(0x00) X(0x01) X(0x02) X(0x03) X(0x04) X(0x05) X(0x06) X(0x07) X(0x08) X(0x09) X(0x0A) X(0x0B) X(0x0C) X(0x0D) X(0x0E) X(0x0F) \
+    X(0x10) X(0x11) X(0x12) X(0x13) X(0x14) X(0x15) X(0x16) X(0x17) X(0x18) X(0x19) X(0x1A) X(0x1B) X(0x1C) X(0x1D) X(0x1E) X(0x1F) \
+    X(0x20) X(0x21) X(0x22) X(0x23) X(0x24) X(0x25) X(0x26) X(0x27) X(0x28) X(0x29) X(0x2A) X(0x2B) X(0x2C) X(0x2D) X(0x2E) X(0x2F) \
+    X(0x30) X(0x31) X(0x32) X(0x33) X(0x34) X(0x35) X(0x36) X(0x37) X(0x38) X(0x39) X(0x3A) X(0x3B) X(0x3C) X(0x3D) X(0x3E) X(0x3F) \
+    X(0x40) X(0x41) X(0x42) X(0x43) X(0x44) X(0x45) X(0x46) X(0x47) X(0x48) X(0x49) X(0x4A) X(0x4B) X(0x4C) X(0x4D) X(0x4E) X(0x4F) \
+    X(0x50) X(0x51) X(0x52) X(0x53) X(0x54) X(0x55) X(0x56) X(0x57) X(0x58) X(0x59) X(0x5A) X(0x5B) X(0x5C) X(0x5D) X(0x5E) X(0x5F) \
+    X(0x60) X(0x61) X(0x62) X(0x63) X(0x64) X(0x65) X(0x66) X(0x67) X(0x68) X(0x69) X(0x6A) X(0x6B) X(0x6C) X(0x6D) X(0x6E) X(0x6F) \
+    X(0x70) X(0x71) X(0x72) X(0x73) X(0x74) X(0x75) X(0x76) X(0x77) X(0x78) X(0x79) X(0x7A) X(0x7B) X(0x7C) X(0x7D) X(0x7E) X(0x7F) \
+    X(0x80) X(0x81) X(0x82) X(0x83) X(0x84) X(0x85) X(0x86) X(0x87) X(0x88) X(0x89) X(0x8A) X(0x8B) X(0x8C) X(0x8D) X(0x8E) X(0x8F) \
+    X(0x90) X(0x91) X(0x92) X(0x93) X(0x94) X(0x95) X(0x96) X(0x97) X(0x98) X(0x99) X(0x9A) X(0x9B) X(0x9C) X(0x9D) X(0x9E) X(0x9F) \
+    X(0xA0) X(0xA1) X(0xA2) X(0xA3) X(0xA4) X(0xA5) X(0xA6) X(0xA7) X(0xA8) X(0xA9) X(0xAA) X(0xAB) X(0xAC) X(0xAD) X(0xAE) X(0xAF) \
+    X(0xB0) X(0xB1) X(0xB2) X(0xB3) X(0xB4) X(0xB5) X(0xB6) X(0xB7) X(0xB8) X(0xB9) X(0xBA) X(0xBB) X(0xBC) X(0xBD) X(0xBE) X(0xBF) \
+    X(0xC0) X(0xC1) X(0xC2) X(0xC3) X(0xC4) X(0xC5) X(0xC6) X(0xC7) X(0xC8) X(0xC9) X(0xCA) X(0xCB) X(0xCC) X(0xCD) X(0xCE) X(0xCF) \
+    X(0xD0) X(0xD1) X(0xD2) X(0xD3) X(0xD4) X(0xD5) X(0xD6) X(0xD7) X(0xD8) X(0xD9) X(0xDA) X(0xDB) X(0xDC) X(0xDD) X(0xDE) X(0xDF) \
+    X(0xE0) X(0xE1) X(0xE2) X(0xE3) X(0xE4) X(0xE5) X(0xE6) X(0xE7) X(0xE8) X(0xE9) X(0xEA) X(0xEB) X(0xEC) X(0xED) X(0xEE) X(0xEF) \
+    X(0xF0) X(0xF1) X(0xF2) X(0xF3) X(0xF4) X(0xF5) X(0xF6) X(0xF7) X(0xF8) X(0xF9) X(0xFA) X(0xFB) X(0xFC) X(0xFD) X(0xFE) X(0xFF)
+#endif
+
+consteval Nes::CPU::OpcodeTable Nes::CPU::buildOpcodeTable() {
+    using namespace AddressingMode;
+
+    OpcodeTable table{};
+
+    table[0x02] = &CPU::execute<&CPU::jam, 2>;
+    table[0x12] = &CPU::execute<&CPU::jam, 2>;
+    table[0x22] = &CPU::execute<&CPU::jam, 2>;
+    table[0x32] = &CPU::execute<&CPU::jam, 2>;
+    table[0x42] = &CPU::execute<&CPU::jam, 2>;
+    table[0x52] = &CPU::execute<&CPU::jam, 2>;
+    table[0x62] = &CPU::execute<&CPU::jam, 2>;
+    table[0x72] = &CPU::execute<&CPU::jam, 2>;
+    table[0x92] = &CPU::execute<&CPU::jam, 2>;
+    table[0xB2] = &CPU::execute<&CPU::jam, 2>;
+    table[0xD2] = &CPU::execute<&CPU::jam, 2>;
+    table[0xF2] = &CPU::execute<&CPU::jam, 2>;
+
+    table[0x1A] = &CPU::execute<&CPU::nop<Implicit>, 2>;
+    table[0x3A] = &CPU::execute<&CPU::nop<Implicit>, 2>;
+    table[0x5A] = &CPU::execute<&CPU::nop<Implicit>, 2>;
+    table[0x7A] = &CPU::execute<&CPU::nop<Implicit>, 2>;
+    table[0xDA] = &CPU::execute<&CPU::nop<Implicit>, 2>;
+    table[0xFA] = &CPU::execute<&CPU::nop<Implicit>, 2>;
+    table[0xEA] = &CPU::execute<&CPU::nop<Implicit>, 2>;
+    table[0x80] = &CPU::execute<&CPU::nop<Immediate>, 2>;
+    table[0x82] = &CPU::execute<&CPU::nop<Immediate>, 2>;
+    table[0x89] = &CPU::execute<&CPU::nop<Immediate>, 2>;
+    table[0xC2] = &CPU::execute<&CPU::nop<Immediate>, 2>;
+    table[0xE2] = &CPU::execute<&CPU::nop<Immediate>, 2>;
+    table[0x04] = &CPU::execute<&CPU::nop<ZeroPage>, 3>;
+    table[0x44] = &CPU::execute<&CPU::nop<ZeroPage>, 3>;
+    table[0x64] = &CPU::execute<&CPU::nop<ZeroPage>, 3>;
+    table[0x14] = &CPU::execute<&CPU::nop<ZeroPageX>, 4>;
+    table[0x34] = &CPU::execute<&CPU::nop<ZeroPageX>, 4>;
+    table[0x54] = &CPU::execute<&CPU::nop<ZeroPageX>, 4>;
+    table[0x74] = &CPU::execute<&CPU::nop<ZeroPageX>, 4>;
+    table[0xD4] = &CPU::execute<&CPU::nop<ZeroPageX>, 4>;
+    table[0xF4] = &CPU::execute<&CPU::nop<ZeroPageX>, 4>;
+    table[0x0C] = &CPU::execute<&CPU::nop<Absolute>, 4>;
+    table[0x1C] = &CPU::executeWithPageCross<&CPU::nop<AbsoluteX>, 4>;
+    table[0x3C] = &CPU::executeWithPageCross<&CPU::nop<AbsoluteX>, 4>;
+    table[0x5C] = &CPU::executeWithPageCross<&CPU::nop<AbsoluteX>, 4>;
+    table[0x7C] = &CPU::executeWithPageCross<&CPU::nop<AbsoluteX>, 4>;
+    table[0xDC] = &CPU::executeWithPageCross<&CPU::nop<AbsoluteX>, 4>;
+    table[0xFC] = &CPU::executeWithPageCross<&CPU::nop<AbsoluteX>, 4>;
+
+    table[0x6B] = &CPU::execute<&CPU::unhandledInstruction<0x6B, Immediate>, 2>;
+    table[0xAB] = &CPU::execute<&CPU::unhandledInstruction<0xAB, Immediate>, 2>;
+
+    table[0x87] = &CPU::execute<&CPU::sax<ZeroPage>, 3>;
+    table[0x97] = &CPU::execute<&CPU::sax<ZeroPageY>, 4>;
+    table[0x8F] = &CPU::execute<&CPU::sax<Absolute>, 4>;
+    table[0x83] = &CPU::execute<&CPU::sax<IndirectX>, 6>;
+
+    table[0xA7] = &CPU::execute<&CPU::lax<ZeroPage>, 3>;
+    table[0xB7] = &CPU::execute<&CPU::lax<ZeroPageY>, 4>;
+    table[0xAF] = &CPU::execute<&CPU::lax<Absolute>, 4>;
+    table[0xBF] = &CPU::executeWithPageCross<&CPU::lax<AbsoluteY>, 4>;
+    table[0xB3] = &CPU::executeWithPageCross<&CPU::lax<IndirectY>, 5>;
+    table[0xA3] = &CPU::execute<&CPU::lax<IndirectX>, 6>;
+
+    table[0xC7] = &CPU::execute<&CPU::dcp<ZeroPage>, 5>;
+    table[0xD7] = &CPU::execute<&CPU::dcp<ZeroPageX>, 6>;
+    table[0xCF] = &CPU::execute<&CPU::dcp<Absolute>, 6>;
+    table[0xDF] = &CPU::execute<&CPU::dcp<AbsoluteX>, 7>;
+    table[0xDB] = &CPU::execute<&CPU::dcp<AbsoluteY>, 7>;
+    table[0xC3] = &CPU::execute<&CPU::dcp<IndirectX>, 8>;
+    table[0xD3] = &CPU::execute<&CPU::dcp<IndirectY>, 8>;
+
+    table[0xE7] = &CPU::execute<&CPU::isc<ZeroPage>, 5>;
+    table[0xF7] = &CPU::execute<&CPU::isc<ZeroPageX>, 6>;
+    table[0xEF] = &CPU::execute<&CPU::isc<Absolute>, 6>;
+    table[0xFF] = &CPU::execute<&CPU::isc<AbsoluteX>, 7>;
+    table[0xFB] = &CPU::execute<&CPU::isc<AbsoluteY>, 7>;
+    table[0xE3] = &CPU::execute<&CPU::isc<IndirectX>, 8>;
+    table[0xF3] = &CPU::execute<&CPU::isc<IndirectY>, 8>;
+
+    table[0x67] = &CPU::execute<&CPU::rra<ZeroPage>, 5>;
+    table[0x77] = &CPU::execute<&CPU::rra<ZeroPageX>, 6>;
+    table[0x6F] = &CPU::execute<&CPU::rra<Absolute>, 6>;
+    table[0x7F] = &CPU::execute<&CPU::rra<AbsoluteX>, 7>;
+    table[0x7B] = &CPU::execute<&CPU::rra<AbsoluteY>, 7>;
+    table[0x63] = &CPU::execute<&CPU::rra<IndirectX>, 8>;
+    table[0x73] = &CPU::execute<&CPU::rra<IndirectY>, 8>;
+
+    table[0x27] = &CPU::execute<&CPU::rla<ZeroPage>, 5>;
+    table[0x37] = &CPU::execute<&CPU::rla<ZeroPageX>, 6>;
+    table[0x2F] = &CPU::execute<&CPU::rla<Absolute>, 6>;
+    table[0x3F] = &CPU::execute<&CPU::rla<AbsoluteX>, 7>;
+    table[0x3B] = &CPU::execute<&CPU::rla<AbsoluteY>, 7>;
+    table[0x33] = &CPU::execute<&CPU::rla<IndirectY>, 8>;
+    table[0x23] = &CPU::execute<&CPU::rla<IndirectX>, 8>;
+
+    table[0x47] = &CPU::execute<&CPU::sre<ZeroPage>, 5>;
+    table[0x57] = &CPU::execute<&CPU::sre<ZeroPageX>, 6>;
+    table[0x4F] = &CPU::execute<&CPU::sre<Absolute>, 6>;
+    table[0x5F] = &CPU::execute<&CPU::sre<AbsoluteX>, 7>;
+    table[0x5B] = &CPU::execute<&CPU::sre<AbsoluteY>, 7>;
+    table[0x43] = &CPU::execute<&CPU::sre<IndirectX>, 8>;
+    table[0x53] = &CPU::execute<&CPU::sre<IndirectY>, 8>;
+
+    table[0x07] = &CPU::execute<&CPU::slo<ZeroPage>, 5>;
+    table[0x17] = &CPU::execute<&CPU::slo<ZeroPageX>, 6>;
+    table[0x0F] = &CPU::execute<&CPU::slo<Absolute>, 6>;
+    table[0x1F] = &CPU::execute<&CPU::slo<AbsoluteX>, 7>;
+    table[0x1B] = &CPU::execute<&CPU::slo<AbsoluteY>, 7>;
+    table[0x03] = &CPU::execute<&CPU::slo<IndirectX>, 8>;
+    table[0x13] = &CPU::execute<&CPU::slo<IndirectY>, 8>;
+
+    table[0x9F] = &CPU::execute<&CPU::sha<AbsoluteY>, 5>;
+    table[0x93] = &CPU::execute<&CPU::sha<IndirectY>, 6>;
+    table[0x9E] = &CPU::execute<&CPU::shx<AbsoluteY>, 5>;
+    table[0x9C] = &CPU::execute<&CPU::shy<AbsoluteX>, 5>;
+    table[0x9B] = &CPU::invalidOpcode<0x9B>;
+
+    table[0x0B] = &CPU::execute<&CPU::anc<Immediate>, 2>;
+    table[0x2B] = &CPU::execute<&CPU::anc<Immediate>, 2>;
+
+    table[0x4B] = &CPU::execute<&CPU::alr<Immediate>, 2>;
+
+    table[0xCB] = &CPU::execute<&CPU::sbx<Immediate>, 2>;
+
+    table[0xEB] = &CPU::execute<&CPU::subWithCarry<Immediate>, 2>;
+
+    table[0x8B] = &CPU::execute<&CPU::ane<Immediate>, 2>;
+
+    table[0xBB] = &CPU::execute<&CPU::las<AbsoluteY>, 4>;
+
+    table[0x00] = &CPU::execute<&CPU::instructionBreak, 7>;
+
+    table[0x18] = &CPU::execute<&CPU::clearFlag<CPUFlag::Carry>, 2>;
+    table[0x58] = &CPU::execute<&CPU::clearInterruptDisable, 2>;
+    table[0xB8] = &CPU::execute<&CPU::clearFlag<CPUFlag::Overflow>, 2>;
+    table[0xD8] = &CPU::execute<&CPU::clearFlag<CPUFlag::Decimal>, 2>;
+
+    table[0x38] = &CPU::execute<&CPU::setFlag<CPUFlag::Carry>, 2>;
+    table[0x78] = &CPU::execute<&CPU::setFlag<CPUFlag::InterruptDisable>, 2>;
+    table[0xF8] = &CPU::execute<&CPU::setFlag<CPUFlag::Decimal>, 2>;
+
+    table[0x86] = &CPU::execute<&CPU::storeValue<&Registers::xIndex, ZeroPage>, 3>;
+    table[0x96] = &CPU::execute<&CPU::storeValue<&Registers::xIndex, ZeroPageY>, 4>;
+    table[0x8E] = &CPU::execute<&CPU::storeValue<&Registers::xIndex, Absolute>, 4>;
+    table[0x84] = &CPU::execute<&CPU::storeValue<&Registers::yIndex, ZeroPage>, 3>;
+    table[0x94] = &CPU::execute<&CPU::storeValue<&Registers::yIndex, ZeroPageX>, 4>;
+    table[0x8C] = &CPU::execute<&CPU::storeValue<&Registers::yIndex, Absolute>, 4>;
+    table[0x85] = &CPU::execute<&CPU::storeValue<&Registers::accumulator, ZeroPage>, 3>;
+    table[0x95] = &CPU::execute<&CPU::storeValue<&Registers::accumulator, ZeroPageX>, 4>;
+    table[0x8D] = &CPU::execute<&CPU::storeValue<&Registers::accumulator, Absolute>, 4>;
+    table[0x9D] = &CPU::execute<&CPU::storeValue<&Registers::accumulator, AbsoluteX>, 5>;
+    table[0x99] = &CPU::execute<&CPU::storeValue<&Registers::accumulator, AbsoluteY>, 5>;
+    table[0x81] = &CPU::execute<&CPU::storeValue<&Registers::accumulator, IndirectX>, 6>;
+    table[0x91] = &CPU::execute<&CPU::storeValue<&Registers::accumulator, IndirectY>, 6>;
+
+    table[0xA9] = &CPU::execute<&CPU::loadValue<&Registers::accumulator, Immediate>, 2>;
+    table[0xA5] = &CPU::execute<&CPU::loadValue<&Registers::accumulator, ZeroPage>, 3>;
+    table[0xB5] = &CPU::execute<&CPU::loadValue<&Registers::accumulator, ZeroPageX>, 4>;
+    table[0xAD] = &CPU::execute<&CPU::loadValue<&Registers::accumulator, Absolute>, 4>;
+    table[0xA1] = &CPU::execute<&CPU::loadValue<&Registers::accumulator, IndirectX>, 6>;
+    table[0xBD] = &CPU::executeWithPageCross<&CPU::loadValue<&Registers::accumulator, AbsoluteX>, 4>;
+    table[0xB9] = &CPU::executeWithPageCross<&CPU::loadValue<&Registers::accumulator, AbsoluteY>, 4>;
+    table[0xB1] = &CPU::executeWithPageCross<&CPU::loadValue<&Registers::accumulator, IndirectY>, 5>;
+
+    table[0xA2] = &CPU::execute<&CPU::loadValue<&Registers::xIndex, Immediate>, 2>;
+    table[0xA6] = &CPU::execute<&CPU::loadValue<&Registers::xIndex, ZeroPage>, 3>;
+    table[0xB6] = &CPU::execute<&CPU::loadValue<&Registers::xIndex, ZeroPageY>, 4>;
+    table[0xAE] = &CPU::execute<&CPU::loadValue<&Registers::xIndex, Absolute>, 4>;
+    table[0xBE] = &CPU::executeWithPageCross<&CPU::loadValue<&Registers::xIndex, AbsoluteY>, 4>;
+
+    table[0xA0] = &CPU::execute<&CPU::loadValue<&Registers::yIndex, Immediate>, 2>;
+    table[0xA4] = &CPU::execute<&CPU::loadValue<&Registers::yIndex, ZeroPage>, 3>;
+    table[0xB4] = &CPU::execute<&CPU::loadValue<&Registers::yIndex, ZeroPageX>, 4>;
+    table[0xAC] = &CPU::execute<&CPU::loadValue<&Registers::yIndex, Absolute>, 4>;
+    table[0xBC] = &CPU::executeWithPageCross<&CPU::loadValue<&Registers::yIndex, AbsoluteX>, 4>;
+
+    table[0x69] = &CPU::execute<&CPU::addWithCarry<Immediate>, 2>;
+    table[0x65] = &CPU::execute<&CPU::addWithCarry<ZeroPage>, 3>;
+    table[0x75] = &CPU::execute<&CPU::addWithCarry<ZeroPageX>, 4>;
+    table[0x6D] = &CPU::execute<&CPU::addWithCarry<Absolute>, 4>;
+    table[0x61] = &CPU::execute<&CPU::addWithCarry<IndirectX>, 6>;
+    table[0x7D] = &CPU::executeWithPageCross<&CPU::addWithCarry<AbsoluteX>, 4>;
+    table[0x79] = &CPU::executeWithPageCross<&CPU::addWithCarry<AbsoluteY>, 4>;
+    table[0x71] = &CPU::executeWithPageCross<&CPU::addWithCarry<IndirectY>, 5>;
+
+    table[0xE9] = &CPU::execute<&CPU::subWithCarry<Immediate>, 2>;
+    table[0xE5] = &CPU::execute<&CPU::subWithCarry<ZeroPage>, 3>;
+    table[0xF5] = &CPU::execute<&CPU::subWithCarry<ZeroPageX>, 4>;
+    table[0xED] = &CPU::execute<&CPU::subWithCarry<Absolute>, 4>;
+    table[0xE1] = &CPU::execute<&CPU::subWithCarry<IndirectX>, 6>;
+    table[0xFD] = &CPU::executeWithPageCross<&CPU::subWithCarry<AbsoluteX>, 4>;
+    table[0xF9] = &CPU::executeWithPageCross<&CPU::subWithCarry<AbsoluteY>, 4>;
+    table[0xF1] = &CPU::executeWithPageCross<&CPU::subWithCarry<IndirectY>, 5>;
+
+    table[0x29] = &CPU::execute<&CPU::bitwiseAnd<Immediate>, 2>;
+    table[0x25] = &CPU::execute<&CPU::bitwiseAnd<ZeroPage>, 3>;
+    table[0x35] = &CPU::execute<&CPU::bitwiseAnd<ZeroPageX>, 4>;
+    table[0x2D] = &CPU::execute<&CPU::bitwiseAnd<Absolute>, 4>;
+    table[0x21] = &CPU::execute<&CPU::bitwiseAnd<IndirectX>, 6>;
+    table[0x3D] = &CPU::executeWithPageCross<&CPU::bitwiseAnd<AbsoluteX>, 4>;
+    table[0x39] = &CPU::executeWithPageCross<&CPU::bitwiseAnd<AbsoluteY>, 4>;
+    table[0x31] = &CPU::executeWithPageCross<&CPU::bitwiseAnd<IndirectY>, 5>;
+
+    table[0x49] = &CPU::execute<&CPU::bitwiseXor<Immediate>, 2>;
+    table[0x45] = &CPU::execute<&CPU::bitwiseXor<ZeroPage>, 3>;
+    table[0x55] = &CPU::execute<&CPU::bitwiseXor<ZeroPageX>, 4>;
+    table[0x4D] = &CPU::execute<&CPU::bitwiseXor<Absolute>, 4>;
+    table[0x41] = &CPU::execute<&CPU::bitwiseXor<IndirectX>, 6>;
+    table[0x5D] = &CPU::executeWithPageCross<&CPU::bitwiseXor<AbsoluteX>, 4>;
+    table[0x59] = &CPU::executeWithPageCross<&CPU::bitwiseXor<AbsoluteY>, 4>;
+    table[0x51] = &CPU::executeWithPageCross<&CPU::bitwiseXor<IndirectY>, 5>;
+
+    table[0x09] = &CPU::execute<&CPU::bitwiseOr<Immediate>, 2>;
+    table[0x05] = &CPU::execute<&CPU::bitwiseOr<ZeroPage>, 3>;
+    table[0x15] = &CPU::execute<&CPU::bitwiseOr<ZeroPageX>, 4>;
+    table[0x0D] = &CPU::execute<&CPU::bitwiseOr<Absolute>, 4>;
+    table[0x01] = &CPU::execute<&CPU::bitwiseOr<IndirectX>, 6>;
+    table[0x1D] = &CPU::executeWithPageCross<&CPU::bitwiseOr<AbsoluteX>, 4>;
+    table[0x19] = &CPU::executeWithPageCross<&CPU::bitwiseOr<AbsoluteY>, 4>;
+    table[0x11] = &CPU::executeWithPageCross<&CPU::bitwiseOr<IndirectY>, 5>;
+
+    table[0x0A] = &CPU::execute<&CPU::arithmeticShiftLeft<Accumulator>, 2>;
+    table[0x06] = &CPU::execute<&CPU::arithmeticShiftLeft<ZeroPage>, 5>;
+    table[0x16] = &CPU::execute<&CPU::arithmeticShiftLeft<ZeroPageX>, 6>;
+    table[0x0E] = &CPU::execute<&CPU::arithmeticShiftLeft<Absolute>, 6>;
+    table[0x1E] = &CPU::execute<&CPU::arithmeticShiftLeft<AbsoluteX>, 7>;
+
+    table[0x4A] = &CPU::execute<&CPU::logicalShiftRight<Accumulator>, 2>;
+    table[0x46] = &CPU::execute<&CPU::logicalShiftRight<ZeroPage>, 5>;
+    table[0x56] = &CPU::execute<&CPU::logicalShiftRight<ZeroPageX>, 6>;
+    table[0x4E] = &CPU::execute<&CPU::logicalShiftRight<Absolute>, 6>;
+    table[0x5E] = &CPU::execute<&CPU::logicalShiftRight<AbsoluteX>, 7>;
+
+    table[0x6A] = &CPU::execute<&CPU::rotateRight<Accumulator>, 2>;
+    table[0x66] = &CPU::execute<&CPU::rotateRight<ZeroPage>, 5>;
+    table[0x76] = &CPU::execute<&CPU::rotateRight<ZeroPageX>, 6>;
+    table[0x6E] = &CPU::execute<&CPU::rotateRight<Absolute>, 6>;
+    table[0x7E] = &CPU::execute<&CPU::rotateRight<AbsoluteX>, 7>;
+
+    table[0x2A] = &CPU::execute<&CPU::rotateLeft<Accumulator>, 2>;
+    table[0x26] = &CPU::execute<&CPU::rotateLeft<ZeroPage>, 5>;
+    table[0x36] = &CPU::execute<&CPU::rotateLeft<ZeroPageX>, 6>;
+    table[0x2E] = &CPU::execute<&CPU::rotateLeft<Absolute>, 6>;
+    table[0x3E] = &CPU::execute<&CPU::rotateLeft<AbsoluteX>, 7>;
+
+    table[0x24] = &CPU::execute<&CPU::testBit<ZeroPage>, 3>;
+    table[0x2C] = &CPU::execute<&CPU::testBit<Absolute>, 4>;
+
+    table[0xC9] = &CPU::execute<&CPU::compare<&Registers::accumulator, Immediate>, 2>;
+    table[0xC5] = &CPU::execute<&CPU::compare<&Registers::accumulator, ZeroPage>, 3>;
+    table[0xD5] = &CPU::execute<&CPU::compare<&Registers::accumulator, ZeroPageX>, 4>;
+    table[0xCD] = &CPU::execute<&CPU::compare<&Registers::accumulator, Absolute>, 4>;
+    table[0xC1] = &CPU::execute<&CPU::compare<&Registers::accumulator, IndirectX>, 6>;
+    table[0xDD] = &CPU::executeWithPageCross<&CPU::compare<&Registers::accumulator, AbsoluteX>, 4>;
+    table[0xD9] = &CPU::executeWithPageCross<&CPU::compare<&Registers::accumulator, AbsoluteY>, 4>;
+    table[0xD1] = &CPU::executeWithPageCross<&CPU::compare<&Registers::accumulator, IndirectY>, 5>;
+
+    table[0xE0] = &CPU::execute<&CPU::compare<&Registers::xIndex, Immediate>, 2>;
+    table[0xE4] = &CPU::execute<&CPU::compare<&Registers::xIndex, ZeroPage>, 3>;
+    table[0xEC] = &CPU::execute<&CPU::compare<&Registers::xIndex, Absolute>, 4>;
+
+    table[0xC0] = &CPU::execute<&CPU::compare<&Registers::yIndex, Immediate>, 2>;
+    table[0xC4] = &CPU::execute<&CPU::compare<&Registers::yIndex, ZeroPage>, 3>;
+    table[0xCC] = &CPU::execute<&CPU::compare<&Registers::yIndex, Absolute>, 4>;
+
+    table[0xE6] = &CPU::execute<&CPU::incrementMemory<ZeroPage>, 5>;
+    table[0xF6] = &CPU::execute<&CPU::incrementMemory<ZeroPageX>, 6>;
+    table[0xEE] = &CPU::execute<&CPU::incrementMemory<Absolute>, 6>;
+    table[0xFE] = &CPU::execute<&CPU::incrementMemory<AbsoluteX>, 7>;
+
+    table[0xE8] = &CPU::execute<&CPU::increment<&Registers::xIndex>, 2>;
+    table[0xC8] = &CPU::execute<&CPU::increment<&Registers::yIndex>, 2>;
+
+    table[0xC6] = &CPU::execute<&CPU::decrementMemory<ZeroPage>, 5>;
+    table[0xD6] = &CPU::execute<&CPU::decrementMemory<ZeroPageX>, 6>;
+    table[0xCE] = &CPU::execute<&CPU::decrementMemory<Absolute>, 6>;
+    table[0xDE] = &CPU::execute<&CPU::decrementMemory<AbsoluteX>, 7>;
+
+    table[0xCA] = &CPU::execute<&CPU::decrement<&Registers::xIndex>, 2>;
+    table[0x88] = &CPU::execute<&CPU::decrement<&Registers::yIndex>, 2>;
+
+    table[0x4C] = &CPU::execute<&CPU::jump<Absolute>, 3>;
+    table[0x6C] = &CPU::execute<&CPU::jump<JumpIndirect>, 5>;
+
+    table[0x20] = &CPU::execute<&CPU::call<Absolute>, 6>;
+
+    table[0x60] = &CPU::execute<&CPU::fnReturn, 6>;
+    table[0x40] = &CPU::execute<&CPU::interruptReturn, 6>;
+
+    table[0xAA] = &CPU::execute<&CPU::transfer<&Registers::accumulator, &Registers::xIndex>, 2>;
+    table[0x8A] = &CPU::execute<&CPU::transfer<&Registers::xIndex, &Registers::accumulator>, 2>;
+    table[0xA8] = &CPU::execute<&CPU::transfer<&Registers::accumulator, &Registers::yIndex>, 2>;
+    table[0x98] = &CPU::execute<&CPU::transfer<&Registers::yIndex, &Registers::accumulator>, 2>;
+
+    table[0x48] = &CPU::execute<&CPU::pushAccumulatorToStack, 3>;
+    table[0x68] = &CPU::execute<&CPU::popAccumulatorFromStack, 4>;
+
+    table[0x08] = &CPU::execute<&CPU::pushStatus, 3>;
+    table[0x28] = &CPU::execute<&CPU::popStatus, 4>;
+
+    table[0x9A] = &CPU::execute<&CPU::setStackPointerToX, 2>;
+    table[0xBA] = &CPU::execute<&CPU::setXToStackPointer, 2>;
+
+    table[0x10] = &CPU::branchOn<CPUFlag::Negative, false>;
+    table[0x30] = &CPU::branchOn<CPUFlag::Negative, true>;
+    table[0x50] = &CPU::branchOn<CPUFlag::Overflow, false>;
+    table[0x70] = &CPU::branchOn<CPUFlag::Overflow, true>;
+    table[0x90] = &CPU::branchOn<CPUFlag::Carry, false>;
+    table[0xB0] = &CPU::branchOn<CPUFlag::Carry, true>;
+    table[0xD0] = &CPU::branchOn<CPUFlag::Zero, false>;
+    table[0xF0] = &CPU::branchOn<CPUFlag::Zero, true>;
+
+    for (const auto handler : table) {
+        if (handler == nullptr) {
+            throw std::logic_error("Opcode table has an unassigned entry");
+        }
+    }
+
+    return table;
+}
+
+Nes::CycleCount Nes::CPU::tick() {
+    const auto startedAt = m_scheduler.now();
+    m_scheduler.dispatchDueEvents();
+
+    const auto opcode = readOpcode();
+    finishInstruction(executeOpcode(opcode));
+
+    return static_cast<CycleCount>(m_scheduler.now() - startedAt);
+}
+
+std::uint64_t Nes::CPU::instructionsExecuted() const {
+    return m_instructionsExecuted;
+}
+
+void Nes::CPU::finishInstruction(CycleCount cyclesTaken) {
+    m_cycles += cyclesTaken;
+    m_instructionsExecuted++;
+
+    m_scheduler.advance(cyclesTaken);
+}
+
 Nes::CycleCount Nes::CPU::executeOpcode(Byte opcode) {
-    switch (opcode) {
-        case 0x02:
-        case 0x12:
-        case 0x22:
-        case 0x32:
-        case 0x42:
-        case 0x52:
-        case 0x62:
-        case 0x72:
-        case 0x92:
-        case 0xB2:
-        case 0xD2:
-        case 0xF2: jam(); return 2;
-
-        case 0x1A:
-        case 0x3A:
-        case 0x5A:
-        case 0x7A:
-        case 0xDA:
-        case 0xFA:
-        case 0xEA: nop(1); return 2;
-        case 0x80:
-        case 0x82:
-        case 0x89:
-        case 0xC2:
-        case 0xE2: nop(2); return 2;
-        case 0x04:
-        case 0x44:
-        case 0x64: nop(2); return 3;
-        case 0x14:
-        case 0x34:
-        case 0x54:
-        case 0x74:
-        case 0xD4:
-        case 0xF4: nop(2); return 4;
-        case 0x0C: nop(3); return 4;
-        case 0x1C:
-        case 0x3C:
-        case 0x5C:
-        case 0x7C:
-        case 0xDC:
-        case 0xFC: nop(1, AddressingMode::AbsoluteX); return cyclesAccountingForPageCross(4);
-
-        case 0x6B:
-        case 0xAB: unhandledInstruction(opcode, AddressingMode::Immediate); return 2;
-
-        case 0x87: sax(AddressingMode::ZeroPage);  return 3;
-        case 0x97: sax(AddressingMode::ZeroPageY); return 4;
-        case 0x8F: sax(AddressingMode::Absolute);  return 4;
-        case 0x83: sax(AddressingMode::IndirectX); return 6;
-
-        case 0xA7: lax(AddressingMode::ZeroPage);  return 3;
-        case 0xB7: lax(AddressingMode::ZeroPageY); return 4;
-        case 0xAF: lax(AddressingMode::Absolute);  return 4;
-        case 0xBF: lax(AddressingMode::AbsoluteY); return cyclesAccountingForPageCross(4);
-        case 0xB3: lax(AddressingMode::IndirectY); return cyclesAccountingForPageCross(5);
-        case 0xA3: lax(AddressingMode::IndirectX); return  6;
-
-        case 0xC7: dcp(AddressingMode::ZeroPage);  return 5;
-        case 0xD7: dcp(AddressingMode::ZeroPageX); return 6;
-        case 0xCF: dcp(AddressingMode::Absolute);  return 6;
-        case 0xDF: dcp(AddressingMode::AbsoluteX); return 7;
-        case 0xDB: dcp(AddressingMode::AbsoluteY); return 7;
-        case 0xC3: dcp(AddressingMode::IndirectX); return 8;
-        case 0xD3: dcp(AddressingMode::IndirectY); return 8;
-
-        case 0xE7: isc(AddressingMode::ZeroPage);  return 5;
-        case 0xF7: isc(AddressingMode::ZeroPageX); return 6;
-        case 0xEF: isc(AddressingMode::Absolute);  return 6;
-        case 0xFF: isc(AddressingMode::AbsoluteX); return 7;
-        case 0xFB: isc(AddressingMode::AbsoluteY); return 7;
-        case 0xE3: isc(AddressingMode::IndirectX); return 8;
-        case 0xF3: isc(AddressingMode::IndirectY); return 8;
-
-        case 0x67: rra(AddressingMode::ZeroPage);  return 5;
-        case 0x77: rra(AddressingMode::ZeroPageX); return 6;
-        case 0x6F: rra(AddressingMode::Absolute);  return 6;
-        case 0x7F: rra(AddressingMode::AbsoluteX); return 7;
-        case 0x7B: rra(AddressingMode::AbsoluteY); return 7;
-        case 0x63: rra(AddressingMode::IndirectX); return 8;
-        case 0x73: rra(AddressingMode::IndirectY); return 8;
-
-        case 0x27: rla(AddressingMode::ZeroPage);  return 5;
-        case 0x37: rla(AddressingMode::ZeroPageX); return 6;
-        case 0x2F: rla(AddressingMode::Absolute);  return 6;
-        case 0x3F: rla(AddressingMode::AbsoluteX); return 7;
-        case 0x3B: rla(AddressingMode::AbsoluteY); return 7;
-        case 0x33: rla(AddressingMode::IndirectY); return 8;
-        case 0x23: rla(AddressingMode::IndirectX); return 8;
-
-        case 0x47: sre(AddressingMode::ZeroPage);  return 5;
-        case 0x57: sre(AddressingMode::ZeroPageX); return 6;
-        case 0x4F: sre(AddressingMode::Absolute);  return 6;
-        case 0x5F: sre(AddressingMode::AbsoluteX); return 7;
-        case 0x5B: sre(AddressingMode::AbsoluteY); return 7;
-        case 0x43: sre(AddressingMode::IndirectX); return 8;
-        case 0x53: sre(AddressingMode::IndirectY); return 8;
-
-        case 0x07: slo(AddressingMode::ZeroPage);  return 5;
-        case 0x17: slo(AddressingMode::ZeroPageX); return 6;
-        case 0x0F: slo(AddressingMode::Absolute);  return 6;
-        case 0x1F: slo(AddressingMode::AbsoluteX); return 7;
-        case 0x1B: slo(AddressingMode::AbsoluteY); return 7;
-        case 0x03: slo(AddressingMode::IndirectX); return 8;
-        case 0x13: slo(AddressingMode::IndirectY); return 8;
-
-        case 0x9F: sha(AddressingMode::AbsoluteY); return 5;
-        case 0x93: sha(AddressingMode::IndirectY); return 6;
-        case 0x9E: shx(AddressingMode::AbsoluteY); return 5;
-        case 0x9C: shy(AddressingMode::AbsoluteX); return 5;
-
-        case 0x0B: anc(AddressingMode::Immediate); return 2;
-        case 0x2B: anc(AddressingMode::Immediate); return 2;
-
-        case 0x4B: alr(AddressingMode::Immediate); return 2;
-
-        case 0xCB: sbx(AddressingMode::Immediate); return 2;
-
-        case 0xEB: subWithCarry(AddressingMode::Immediate); return 2;
-
-        case 0x8B: ane(AddressingMode::Immediate); return 2;
-
-        case 0xBB: las(AddressingMode::AbsoluteY); return 4;
-
-        case 0x00: instructionBreak(); return 7;
-
-        case 0x18: m_registers.status.clearBit(CPUFlag::Carry);            return 2;
-        case 0x58: m_registers.status.clearBit(CPUFlag::InterruptDisable); return 2;
-        case 0xB8: m_registers.status.clearBit(CPUFlag::Overflow);         return 2;
-        case 0xD8: m_registers.status.clearBit(CPUFlag::Decimal);          return 2;
-
-        case 0x38: m_registers.status.setBit(CPUFlag::Carry);              return 2;
-        case 0x78: m_registers.status.setBit(CPUFlag::InterruptDisable);   return 2;
-        case 0xF8: m_registers.status.setBit(CPUFlag::Decimal);            return 2;
-
-        case 0x86: storeValue(m_registers.xIndex, AddressingMode::ZeroPage);       return 3;
-        case 0x96: storeValue(m_registers.xIndex, AddressingMode::ZeroPageY);      return 4;
-        case 0x8E: storeValue(m_registers.xIndex, AddressingMode::Absolute);       return 4;
-        case 0x84: storeValue(m_registers.yIndex, AddressingMode::ZeroPage);       return 3;
-        case 0x94: storeValue(m_registers.yIndex, AddressingMode::ZeroPageX);      return 4;
-        case 0x8C: storeValue(m_registers.yIndex, AddressingMode::Absolute);       return 4;
-        case 0x85: storeValue(m_registers.accumulator, AddressingMode::ZeroPage);  return 3;
-        case 0x95: storeValue(m_registers.accumulator, AddressingMode::ZeroPageX); return 4;
-        case 0x8D: storeValue(m_registers.accumulator, AddressingMode::Absolute);  return 4;
-        case 0x9D: storeValue(m_registers.accumulator, AddressingMode::AbsoluteX); return 5;
-        case 0x99: storeValue(m_registers.accumulator, AddressingMode::AbsoluteY); return 5;
-        case 0x81: storeValue(m_registers.accumulator, AddressingMode::IndirectX); return 6;
-        case 0x91: storeValue(m_registers.accumulator, AddressingMode::IndirectY); return 6;
-
-        case 0xA9: loadValue(m_registers.accumulator, AddressingMode::Immediate); return 2;
-        case 0xA5: loadValue(m_registers.accumulator, AddressingMode::ZeroPage);  return 3;
-        case 0xB5: loadValue(m_registers.accumulator, AddressingMode::ZeroPageX); return 4;
-        case 0xAD: loadValue(m_registers.accumulator, AddressingMode::Absolute);  return 4;
-        case 0xA1: loadValue(m_registers.accumulator, AddressingMode::IndirectX); return 6;
-        case 0xBD: loadValue(m_registers.accumulator, AddressingMode::AbsoluteX); return cyclesAccountingForPageCross(4);
-        case 0xB9: loadValue(m_registers.accumulator, AddressingMode::AbsoluteY); return cyclesAccountingForPageCross(4);
-        case 0xB1: loadValue(m_registers.accumulator, AddressingMode::IndirectY); return cyclesAccountingForPageCross(5);
-
-        case 0xA2: loadValue(m_registers.xIndex, AddressingMode::Immediate); return 2;
-        case 0xA6: loadValue(m_registers.xIndex, AddressingMode::ZeroPage);  return 3;
-        case 0xB6: loadValue(m_registers.xIndex, AddressingMode::ZeroPageY); return 4;
-        case 0xAE: loadValue(m_registers.xIndex, AddressingMode::Absolute);  return 4;
-        case 0xBE: loadValue(m_registers.xIndex, AddressingMode::AbsoluteY); return cyclesAccountingForPageCross(4);
-
-        case 0xA0: loadValue(m_registers.yIndex, AddressingMode::Immediate); return 2;
-        case 0xA4: loadValue(m_registers.yIndex, AddressingMode::ZeroPage);  return 3;
-        case 0xB4: loadValue(m_registers.yIndex, AddressingMode::ZeroPageX); return 4;
-        case 0xAC: loadValue(m_registers.yIndex, AddressingMode::Absolute);  return 4;
-        case 0xBC: loadValue(m_registers.yIndex, AddressingMode::AbsoluteX); return cyclesAccountingForPageCross(4);
-
-        case 0x69: addWithCarry(AddressingMode::Immediate); return 2;
-        case 0x65: addWithCarry(AddressingMode::ZeroPage);  return 3;
-        case 0x75: addWithCarry(AddressingMode::ZeroPageX); return 4;
-        case 0x6D: addWithCarry(AddressingMode::Absolute);  return 4;
-        case 0x61: addWithCarry(AddressingMode::IndirectX); return 6;
-        case 0x7D: addWithCarry(AddressingMode::AbsoluteX); return cyclesAccountingForPageCross(4);
-        case 0x79: addWithCarry(AddressingMode::AbsoluteY); return cyclesAccountingForPageCross(4);
-        case 0x71: addWithCarry(AddressingMode::IndirectY); return cyclesAccountingForPageCross(5);
-
-        case 0xE9: subWithCarry(AddressingMode::Immediate); return 2;
-        case 0xE5: subWithCarry(AddressingMode::ZeroPage);  return 3;
-        case 0xF5: subWithCarry(AddressingMode::ZeroPageX); return 4;
-        case 0xED: subWithCarry(AddressingMode::Absolute);  return 4;
-        case 0xE1: subWithCarry(AddressingMode::IndirectX); return 6;
-        case 0xFD: subWithCarry(AddressingMode::AbsoluteX); return cyclesAccountingForPageCross(4);
-        case 0xF9: subWithCarry(AddressingMode::AbsoluteY); return cyclesAccountingForPageCross(4);
-        case 0xF1: subWithCarry(AddressingMode::IndirectY); return cyclesAccountingForPageCross(5);
-
-        case 0x29: bitwiseAnd(AddressingMode::Immediate); return 2;
-        case 0x25: bitwiseAnd(AddressingMode::ZeroPage);  return 3;
-        case 0x35: bitwiseAnd(AddressingMode::ZeroPageX); return 4;
-        case 0x2D: bitwiseAnd(AddressingMode::Absolute);  return 4;
-        case 0x21: bitwiseAnd(AddressingMode::IndirectX); return 6;
-        case 0x3D: bitwiseAnd(AddressingMode::AbsoluteX); return cyclesAccountingForPageCross(4);
-        case 0x39: bitwiseAnd(AddressingMode::AbsoluteY); return cyclesAccountingForPageCross(4);
-        case 0x31: bitwiseAnd(AddressingMode::IndirectY); return cyclesAccountingForPageCross(5);
-
-        case 0x49: bitwiseXor(AddressingMode::Immediate); return 2;
-        case 0x45: bitwiseXor(AddressingMode::ZeroPage);  return 3;
-        case 0x55: bitwiseXor(AddressingMode::ZeroPageX); return 4;
-        case 0x4D: bitwiseXor(AddressingMode::Absolute);  return 4;
-        case 0x41: bitwiseXor(AddressingMode::IndirectX); return 6;
-        case 0x5D: bitwiseXor(AddressingMode::AbsoluteX); return cyclesAccountingForPageCross(4);
-        case 0x59: bitwiseXor(AddressingMode::AbsoluteY); return cyclesAccountingForPageCross(4);
-        case 0x51: bitwiseXor(AddressingMode::IndirectY); return cyclesAccountingForPageCross(5);
-
-        case 0x09: bitwiseOr(AddressingMode::Immediate); return 2;
-        case 0x05: bitwiseOr(AddressingMode::ZeroPage);  return 3;
-        case 0x15: bitwiseOr(AddressingMode::ZeroPageX); return 4;
-        case 0x0D: bitwiseOr(AddressingMode::Absolute);  return 4;
-        case 0x01: bitwiseOr(AddressingMode::IndirectX); return 6;
-        case 0x1D: bitwiseOr(AddressingMode::AbsoluteX); return cyclesAccountingForPageCross(4);
-        case 0x19: bitwiseOr(AddressingMode::AbsoluteY); return cyclesAccountingForPageCross(4);
-        case 0x11: bitwiseOr(AddressingMode::IndirectY); return cyclesAccountingForPageCross(5);
-
-        case 0x0A: arithmeticShiftLeft(AddressingMode::Accumulator); return 2;
-        case 0x06: arithmeticShiftLeft(AddressingMode::ZeroPage);    return 5;
-        case 0x16: arithmeticShiftLeft(AddressingMode::ZeroPageX);   return 6;
-        case 0x0E: arithmeticShiftLeft(AddressingMode::Absolute);    return 6;
-        case 0x1E: arithmeticShiftLeft(AddressingMode::AbsoluteX);   return 7;
-
-        case 0x4A: logicalShiftRight(AddressingMode::Accumulator); return 2;
-        case 0x46: logicalShiftRight(AddressingMode::ZeroPage);    return 5;
-        case 0x56: logicalShiftRight(AddressingMode::ZeroPageX);   return 6;
-        case 0x4E: logicalShiftRight(AddressingMode::Absolute);    return 6;
-        case 0x5E: logicalShiftRight(AddressingMode::AbsoluteX);   return 7;
-
-        case 0x6A: rotateRight(AddressingMode::Accumulator); return 2;
-        case 0x66: rotateRight(AddressingMode::ZeroPage);    return 5;
-        case 0x76: rotateRight(AddressingMode::ZeroPageX);   return 6;
-        case 0x6E: rotateRight(AddressingMode::Absolute);    return 6;
-        case 0x7E: rotateRight(AddressingMode::AbsoluteX);   return 7;
-
-        case 0x2A: rotateLeft(AddressingMode::Accumulator); return 2;
-        case 0x26: rotateLeft(AddressingMode::ZeroPage);    return 5;
-        case 0x36: rotateLeft(AddressingMode::ZeroPageX);   return 6;
-        case 0x2E: rotateLeft(AddressingMode::Absolute);    return 6;
-        case 0x3E: rotateLeft(AddressingMode::AbsoluteX);   return 7;
-
-        case 0x24: testBit(AddressingMode::ZeroPage); return 3;
-        case 0x2C: testBit(AddressingMode::Absolute); return 4;
-
-        case 0xC9: compare(m_registers.accumulator, AddressingMode::Immediate); return 2;
-        case 0xC5: compare(m_registers.accumulator, AddressingMode::ZeroPage);  return 3;
-        case 0xD5: compare(m_registers.accumulator, AddressingMode::ZeroPageX); return 4;
-        case 0xCD: compare(m_registers.accumulator, AddressingMode::Absolute);  return 4;
-        case 0xC1: compare(m_registers.accumulator, AddressingMode::IndirectX); return 6;
-        case 0xDD: compare(m_registers.accumulator, AddressingMode::AbsoluteX); return cyclesAccountingForPageCross(4);
-        case 0xD9: compare(m_registers.accumulator, AddressingMode::AbsoluteY); return cyclesAccountingForPageCross(4);
-        case 0xD1: compare(m_registers.accumulator, AddressingMode::IndirectY); return cyclesAccountingForPageCross(5);
-
-        case 0xE0: compare(m_registers.xIndex, AddressingMode::Immediate); return 2;
-        case 0xE4: compare(m_registers.xIndex, AddressingMode::ZeroPage);  return 3;
-        case 0xEC: compare(m_registers.xIndex, AddressingMode::Absolute);  return 4;
-
-        case 0xC0: compare(m_registers.yIndex, AddressingMode::Immediate); return 2;
-        case 0xC4: compare(m_registers.yIndex, AddressingMode::ZeroPage);  return 3;
-        case 0xCC: compare(m_registers.yIndex, AddressingMode::Absolute);  return 4;
-
-        case 0xE6: incrementMemory(AddressingMode::ZeroPage);  return 5;
-        case 0xF6: incrementMemory(AddressingMode::ZeroPageX); return 6;
-        case 0xEE: incrementMemory(AddressingMode::Absolute);  return 6;
-        case 0xFE: incrementMemory(AddressingMode::AbsoluteX); return 7;
-
-        case 0xE8: increment(m_registers.xIndex); return 2;
-        case 0xC8: increment(m_registers.yIndex); return 2;
-
-        case 0xC6: decrementMemory(AddressingMode::ZeroPage);  return 5;
-        case 0xD6: decrementMemory(AddressingMode::ZeroPageX); return 6;
-        case 0xCE: decrementMemory(AddressingMode::Absolute);  return 6;
-        case 0xDE: decrementMemory(AddressingMode::AbsoluteX); return 7;
-
-        case 0xCA: decrement(m_registers.xIndex); return 2;
-        case 0x88: decrement(m_registers.yIndex); return 2;
-
-        case 0x4C: jump(AddressingMode::Absolute);     return 3;
-        case 0x6C: jump(AddressingMode::JumpIndirect); return 5;
-
-        case 0x20: call(AddressingMode::Absolute); return 6;
-
-        case 0x60: fnReturn();        return 6;
-        case 0x40: interruptReturn(); return 6;
-
-        case 0xAA: transfer(m_registers.accumulator, m_registers.xIndex); return 2;
-        case 0x8A: transfer(m_registers.xIndex, m_registers.accumulator); return 2;
-        case 0xA8: transfer(m_registers.accumulator, m_registers.yIndex); return 2;
-        case 0x98: transfer(m_registers.yIndex, m_registers.accumulator); return 2;
-
-        case 0x48: pushToStack(m_registers.accumulator); return 3;
-        case 0x68: popAccumulatorFromStack();            return 4;
-
-        case 0x08: pushStatus(); return 3;
-        case 0x28: popStatus();  return 4;
-
-        case 0x9A: m_registers.stackPointer = m_registers.xIndex; return 2;
-        case 0xBA: setXToStackPointer(); return 2;
-
-        case 0x10: return branch(!m_registers.status.isBitSet(CPUFlag::Negative));
-        case 0x30: return branch(m_registers.status.isBitSet(CPUFlag::Negative));
-        case 0x50: return branch(!m_registers.status.isBitSet(CPUFlag::Overflow));
-        case 0x70: return branch(m_registers.status.isBitSet(CPUFlag::Overflow));
-        case 0x90: return branch(!m_registers.status.isBitSet(CPUFlag::Carry));
-        case 0xB0: return branch(m_registers.status.isBitSet(CPUFlag::Carry));
-        case 0xD0: return branch(!m_registers.status.isBitSet(CPUFlag::Zero));
-        case 0xF0: return branch(m_registers.status.isBitSet(CPUFlag::Zero));
-
-        default:
-            throw std::invalid_argument("Unhandled opcode: " + Utils::convertToHexString(opcode, true, 2));
+    static constexpr auto opcodeTable = buildOpcodeTable();
+    return opcodeTable[opcode](*this);
+}
+
+template <Nes::Byte opcode>
+Nes::CycleCount Nes::CPU::executeOpcode() {
+    constexpr auto handler = buildOpcodeTable()[opcode];
+    return handler(*this);
+}
+
+// Instructions run in batches up to the next scheduled event without looking at any other component. Between
+// batches the due events are dispatched and at least one instruction runs, which keeps the instruction boundaries
+// identical to calling tick() until the budget is used up.
+Nes::CycleCount Nes::CPU::run(CycleCount cycleBudget) {
+    const auto startedAt = m_scheduler.now();
+    const auto runEnd    = startedAt + cycleBudget;
+    m_scheduler.setRunLimit(runEnd);
+
+#ifdef CAIQUE_NES_COMPUTED_GOTO
+    // Every handler ends with its own copy of the dispatch jump, giving the branch predictor one indirect jump per
+    // opcode instead of a single shared one
+#define CAIQUE_NES_OPCODE_LABEL_ADDRESS(opcode) &&opcode_##opcode,
+    static void* const dispatchTable[Const::opcodeCount] = {
+        CAIQUE_NES_FOR_EACH_OPCODE(CAIQUE_NES_OPCODE_LABEL_ADDRESS)
+    };
+#undef CAIQUE_NES_OPCODE_LABEL_ADDRESS
+
+#define CAIQUE_NES_DISPATCH()                                           \
+    if (m_scheduler.now() >= m_scheduler.batchEnd()) {                  \
+        if (m_scheduler.now() >= runEnd) {                              \
+            goto finished;                                              \
+        }                                                               \
+        m_scheduler.dispatchDueEvents();                                \
+    }                                                                   \
+    goto *dispatchTable[readOpcode()]
+
+#define CAIQUE_NES_OPCODE_LABEL(opcode)                                 \
+    opcode_##opcode:                                                    \
+        finishInstruction(executeOpcode<opcode>());                     \
+        CAIQUE_NES_DISPATCH();
+
+    CAIQUE_NES_DISPATCH();
+    CAIQUE_NES_FOR_EACH_OPCODE(CAIQUE_NES_OPCODE_LABEL)
+
+#undef CAIQUE_NES_OPCODE_LABEL
+#undef CAIQUE_NES_DISPATCH
+
+finished:
+#else
+    while (m_scheduler.now() < runEnd) {
+        m_scheduler.dispatchDueEvents();
+        finishInstruction(executeOpcode(readOpcode()));
+
+        while (m_scheduler.now() < m_scheduler.batchEnd()) {
+            finishInstruction(executeOpcode(readOpcode()));
+        }
     }
+#endif
+
+    m_scheduler.setRunLimit(Const::Scheduler::never);
+    return static_cast<CycleCount>(m_scheduler.now() - startedAt);
+}
+
+template <Nes::CPU::InstructionHandler instruction, Nes::CycleCount cycles>
+Nes::CycleCount Nes::CPU::execute(CPU& cpu) {
+    (cpu.*instruction)();
+    return cycles;
+}
+
+template <Nes::CPU::InstructionHandler instruction, Nes::CycleCount cycles>
+Nes::CycleCount Nes::CPU::executeWithPageCross(CPU& cpu) {
+    (cpu.*instruction)();
+    return cpu.cyclesAccountingForPageCross(cycles);
 }
 
 void Nes::CPU::instructionBreak() {
@@ -366,22 +495,31 @@ Nes::CycleCount Nes::CPU::branch(bool condition) {
     return cycles;
 }
 
-void Nes::CPU::storeValue(Byte value, AddressingMode addressingMode) {
-    const auto addr = readAddressOperand(addressingMode);
-    m_mmu.write(addr, value);
+template <Nes::CPUFlag flag, bool expectedValue>
+Nes::CycleCount Nes::CPU::branchOn(CPU& cpu) {
+    return cpu.branch(cpu.m_registers.status.isBitSet(flag) == expectedValue);
 }
 
-void Nes::CPU::loadValue(Byte& target, AddressingMode addressingMode) {
-    const auto operand = readOperand(addressingMode);
+template <Nes::Byte Nes::Registers::* source, Nes::AddressingModePolicy Mode>
+void Nes::CPU::storeValue() {
+    const auto addr = readAddressOperand<Mode>();
+    m_mmu.write(addr, m_registers.*source);
+}
 
+template <Nes::Byte Nes::Registers::* destination, Nes::AddressingModePolicy Mode>
+void Nes::CPU::loadValue() {
+    const auto operand = readOperand<Mode>();
+
+    auto& target = m_registers.*destination;
     target = operand;
 
     m_registers.status.setBitTo(CPUFlag::Zero, target == 0);
     m_registers.status.setBitTo(CPUFlag::Negative, Utils::isValueNegative(target));
 }
 
-void Nes::CPU::addWithCarry(AddressingMode addressingMode) {
-    const auto operand = readOperand(addressingMode);
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::addWithCarry() {
+    const auto operand = readOperand<Mode>();
 
     const Word simulatedSum = m_registers.accumulator + operand + m_registers.status.isBitSet(CPUFlag::Carry);
     m_registers.status.setBitTo(CPUFlag::Carry, simulatedSum > Const::maximumByteValue);
@@ -396,8 +534,9 @@ void Nes::CPU::addWithCarry(AddressingMode addressingMode) {
     m_registers.status.setBitTo(CPUFlag::Negative, Utils::isValueNegative(m_registers.accumulator));
 }
 
-void Nes::CPU::subWithCarry(AddressingMode addressingMode) {
-    const auto operand = readOperand(addressingMode);
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::subWithCarry() {
+    const auto operand = readOperand<Mode>();
 
     const Word simulateDiff = m_registers.accumulator - operand - !m_registers.status.isBitSet(CPUFlag::Carry);
     m_registers.status.setBitTo(CPUFlag::Carry, simulateDiff <= Const::maximumByteValue);
@@ -412,37 +551,41 @@ void Nes::CPU::subWithCarry(AddressingMode addressingMode) {
     m_registers.status.setBitTo(CPUFlag::Negative, Utils::isValueNegative(m_registers.accumulator));
 }
 
-void Nes::CPU::bitwiseAnd(AddressingMode addressingMode) {
-    const auto operand = readOperand(addressingMode);
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::bitwiseAnd() {
+    const auto operand = readOperand<Mode>();
 
     m_registers.accumulator &= operand;
     m_registers.status.setBitTo(CPUFlag::Zero, m_registers.accumulator == 0);
     m_registers.status.setBitTo(CPUFlag::Negative, Utils::isValueNegative(m_registers.accumulator));
 }
 
-void Nes::CPU::bitwiseOr(AddressingMode addressingMode) {
-    const auto operand = readOperand(addressingMode);
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::bitwiseOr() {
+    const auto operand = readOperand<Mode>();
 
     m_registers.accumulator |= operand;
     m_registers.status.setBitTo(CPUFlag::Zero, m_registers.accumulator == 0);
     m_registers.status.setBitTo(CPUFlag::Negative, Utils::isValueNegative(m_registers.accumulator));
 }
 
-void Nes::CPU::bitwiseXor(AddressingMode addressingMode) {
-    const auto operand = readOperand(addressingMode);
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::bitwiseXor() {
+    const auto operand = readOperand<Mode>();
 
     m_registers.accumulator ^= operand;
     m_registers.status.setBitTo(CPUFlag::Zero, m_registers.accumulator == 0);
     m_registers.status.setBitTo(CPUFlag::Negative, Utils::isValueNegative(m_registers.accumulator));
 }
 
-void Nes::CPU::arithmeticShiftLeft(AddressingMode addressingMode) {
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::arithmeticShiftLeft() {
     Addr operandAddress;
     Byte value;
-    if (addressingMode == AddressingMode::Accumulator) {
+    if constexpr (std::same_as<Mode, AddressingMode::Accumulator>) {
         value = m_registers.accumulator;
     } else {
-        operandAddress = readAddressOperand(addressingMode);
+        operandAddress = readAddressOperand<Mode>();
         value = m_mmu.read(operandAddress);
     }
 
@@ -450,7 +593,7 @@ void Nes::CPU::arithmeticShiftLeft(AddressingMode addressingMode) {
 
     value <<= 1;
 
-    if (addressingMode == AddressingMode::Accumulator) {
+    if constexpr (std::same_as<Mode, AddressingMode::Accumulator>) {
         m_registers.accumulator = value;
     } else {
         m_mmu.write(operandAddress, value);
@@ -460,13 +603,14 @@ void Nes::CPU::arithmeticShiftLeft(AddressingMode addressingMode) {
     m_registers.status.setBitTo(CPUFlag::Negative, Utils::isValueNegative(value));
 }
 
-void Nes::CPU::logicalShiftRight(AddressingMode addressingMode) {
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::logicalShiftRight() {
     Addr operandAddress;
     Byte value;
-    if (addressingMode == AddressingMode::Accumulator) {
+    if constexpr (std::same_as<Mode, AddressingMode::Accumulator>) {
         value = m_registers.accumulator;
     } else {
-        operandAddress = readAddressOperand(addressingMode);
+        operandAddress = readAddressOperand<Mode>();
         value = m_mmu.read(operandAddress);
     }
 
@@ -474,7 +618,7 @@ void Nes::CPU::logicalShiftRight(AddressingMode addressingMode) {
 
     value >>= 1;
 
-    if (addressingMode == AddressingMode::Accumulator) {
+    if constexpr (std::same_as<Mode, AddressingMode::Accumulator>) {
         m_registers.accumulator = value;
     } else {
         m_mmu.write(operandAddress, value);
@@ -484,13 +628,14 @@ void Nes::CPU::logicalShiftRight(AddressingMode addressingMode) {
     m_registers.status.setBitTo(CPUFlag::Negative, Utils::isValueNegative(value));
 }
 
-void Nes::CPU::rotateLeft(AddressingMode addressingMode) {
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::rotateLeft() {
     Addr operandAddress;
     Byte value;
-    if (addressingMode == AddressingMode::Accumulator) {
+    if constexpr (std::same_as<Mode, AddressingMode::Accumulator>) {
         value = m_registers.accumulator;
     } else {
-        operandAddress = readAddressOperand(addressingMode);
+        operandAddress = readAddressOperand<Mode>();
         value = m_mmu.read(operandAddress);
     }
 
@@ -503,7 +648,7 @@ void Nes::CPU::rotateLeft(AddressingMode addressingMode) {
         value = Utils::setBit(value, 0);
     }
 
-    if (addressingMode == AddressingMode::Accumulator) {
+    if constexpr (std::same_as<Mode, AddressingMode::Accumulator>) {
         m_registers.accumulator = value;
     } else {
         m_mmu.write(operandAddress, value);
@@ -513,13 +658,14 @@ void Nes::CPU::rotateLeft(AddressingMode addressingMode) {
     m_registers.status.setBitTo(CPUFlag::Negative, Utils::isValueNegative(value));
 }
 
-void Nes::CPU::rotateRight(AddressingMode addressingMode) {
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::rotateRight() {
     Addr operandAddress;
     Byte value;
-    if (addressingMode == AddressingMode::Accumulator) {
+    if constexpr (std::same_as<Mode, AddressingMode::Accumulator>) {
         value = m_registers.accumulator;
     } else {
-        operandAddress = readAddressOperand(addressingMode);
+        operandAddress = readAddressOperand<Mode>();
         value = m_mmu.read(operandAddress);
     }
 
@@ -532,7 +678,7 @@ void Nes::CPU::rotateRight(AddressingMode addressingMode) {
         value = Utils::setBit(value, 7);
     }
 
-    if (addressingMode == AddressingMode::Accumulator) {
+    if constexpr (std::same_as<Mode, AddressingMode::Accumulator>) {
         m_registers.accumulator = value;
     } else {
         m_mmu.write(operandAddress, value);
@@ -542,24 +688,28 @@ void Nes::CPU::rotateRight(AddressingMode addressingMode) {
     m_registers.status.setBitTo(CPUFlag::Negative, Utils::isValueNegative(value));
 }
 
-void Nes::CPU::testBit(AddressingMode addressingMode) {
-    const auto operand = readOperand(addressingMode);
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::testBit() {
+    const auto operand = readOperand<Mode>();
 
     m_registers.status.setBitTo(CPUFlag::Zero, (operand & m_registers.accumulator) == 0);
     m_registers.status.setBitTo(CPUFlag::Negative, Utils::isValueNegative(operand));
     m_registers.status.setBitTo(CPUFlag::Overflow, Utils::isBitSet(operand, 6));
 }
 
-void Nes::CPU::compare(Byte compareWith, AddressingMode addressingMode) {
-    const auto operand = readOperand(addressingMode);
+template <Nes::Byte Nes::Registers::* source, Nes::AddressingModePolicy Mode>
+void Nes::CPU::compare() {
+    const auto operand     = readOperand<Mode>();
+    const auto compareWith = m_registers.*source;
 
     m_registers.status.setBitTo(CPUFlag::Carry, compareWith >= operand);
     m_registers.status.setBitTo(CPUFlag::Zero, compareWith == operand);
     m_registers.status.setBitTo(CPUFlag::Negative, Utils::isValueNegative(static_cast<Byte>(compareWith - operand)));
 }
 
-void Nes::CPU::incrementMemory(AddressingMode addressingMode) {
-    const auto operandAddress = readAddressOperand(addressingMode);
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::incrementMemory() {
+    const auto operandAddress = readAddressOperand<Mode>();
     const Byte updatedOperand = m_mmu.read(operandAddress) + 1;
 
     m_mmu.write(operandAddress, updatedOperand);
@@ -568,8 +718,9 @@ void Nes::CPU::incrementMemory(AddressingMode addressingMode) {
     m_registers.status.setBitTo(CPUFlag::Negative, Utils::isValueNegative(updatedOperand));
 }
 
-void Nes::CPU::decrementMemory(AddressingMode addressingMode) {
-    const auto operandAddress = readAddressOperand(addressingMode);
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::decrementMemory() {
+    const auto operandAddress = readAddressOperand<Mode>();
     const Byte updatedOperand = m_mmu.read(operandAddress) - 1;
 
     m_mmu.write(operandAddress, updatedOperand);
@@ -578,27 +729,48 @@ void Nes::CPU::decrementMemory(AddressingMode addressingMode) {
     m_registers.status.setBitTo(CPUFlag::Negative, Utils::isValueNegative(updatedOperand));
 }
 
-void Nes::CPU::increment(Byte& target) {
+template <Nes::Byte Nes::Registers::* destination>
+void Nes::CPU::increment() {
+    auto& target = m_registers.*destination;
     target++;
 
     m_registers.status.setBitTo(CPUFlag::Zero, target == 0);
     m_registers.status.setBitTo(CPUFlag::Negative, Utils::isValueNegative(target));
 }
 
-void Nes::CPU::decrement(Byte& target) {
+template <Nes::Byte Nes::Registers::* destination>
+void Nes::CPU::decrement() {
+    auto& target = m_registers.*destination;
     target--;
 
     m_registers.status.setBitTo(CPUFlag::Zero, target == 0);
     m_registers.status.setBitTo(CPUFlag::Negative, Utils::isValueNegative(target));
 }
 
-void Nes::CPU::jump(AddressingMode addressingMode) {
-    m_registers.programCounter = readAddressOperand(addressingMode);
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::jump() {
+    m_registers.programCounter = readAddressOperand<Mode>();
 }
 
-void Nes::CPU::call(AddressingMode addressingMode) {
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::call() {
     pushWordToStack(m_registers.programCounter + 1);
-    m_registers.programCounter = readAddressOperand(addressingMode);
+    m_registers.programCounter = readAddressOperand<Mode>();
+}
+
+template <Nes::CPUFlag flag>
+void Nes::CPU::setFlag() {
+    m_registers.status.setBit(flag);
+}
+
+template <Nes::CPUFlag flag>
+void Nes::CPU::clearFlag() {
+    m_registers.status.clearBit(flag);
+}
+
+void Nes::CPU::clearInterruptDisable() {
+    clearFlag<CPUFlag::InterruptDisable>();
+    pollIrq();
 }
 
 void Nes::CPU::fnReturn() {
@@ -612,10 +784,13 @@ void Nes::CPU::interruptReturn() {
     m_registers.status.setBit(CPUFlag::Unused);
 
     m_registers.programCounter = popWordFromStack();
+    pollIrq();
 }
 
-void Nes::CPU::transfer(Nes::Byte from, Nes::Byte& to) {
-    to = from;
+template <Nes::Byte Nes::Registers::* source, Nes::Byte Nes::Registers::* destination>
+void Nes::CPU::transfer() {
+    auto& to = m_registers.*destination;
+    to = m_registers.*source;
 
     m_registers.status.setBitTo(CPUFlag::Zero, to == 0);
     m_registers.status.setBitTo(CPUFlag::Negative, Utils::isValueNegative(to));
@@ -634,6 +809,11 @@ void Nes::CPU::popStatus() {
     m_registers.status.setCombinedValue(newStatusValue);
     m_registers.status.clearBit(CPUFlag::BFlag);
     m_registers.status.setBit(CPUFlag::Unused);
+    pollIrq();
+}
+
+void Nes::CPU::pushAccumulatorToStack() {
+    pushToStack(m_registers.accumulator);
 }
 
 void Nes::CPU::popAccumulatorFromStack() {
@@ -644,6 +824,10 @@ void Nes::CPU::popAccumulatorFromStack() {
 }
 
 
+void Nes::CPU::setStackPointerToX() {
+    m_registers.stackPointer = m_registers.xIndex;
+}
+
 void Nes::CPU::setXToStackPointer() {
     m_registers.xIndex = m_registers.stackPointer;
 
@@ -651,15 +835,17 @@ void Nes::CPU::setXToStackPointer() {
     m_registers.status.setBitTo(CPUFlag::Negative, Utils::isValueNegative(m_registers.xIndex));
 }
 
-void Nes::CPU::sax(AddressingMode addressingMode) {
-    const auto addr   = readAddressOperand(addressingMode);
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::sax() {
+    const auto addr   = readAddressOperand<Mode>();
     const auto result = m_registers.accumulator & m_registers.xIndex;
 
     m_mmu.write(addr, result);
 }
 
-void Nes::CPU::lax(AddressingMode addressingMode) {
-    const auto operand = readOperand(addressingMode);
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::lax() {
+    const auto operand = readOperand<Mode>();
 
     m_registers.xIndex      = operand;
     m_registers.accumulator = operand;
@@ -668,8 +854,9 @@ void Nes::CPU::lax(AddressingMode addressingMode) {
     m_registers.status.setBitTo(CPUFlag::Negative, Utils::isValueNegative(m_registers.accumulator));
 }
 
-void Nes::CPU::dcp(AddressingMode addressingMode) {
-    const auto addr    = readAddressOperand(addressingMode);
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::dcp() {
+    const auto addr    = readAddressOperand<Mode>();
     const auto operand = m_mmu.read(addr);
 
     const Byte result = operand - 1;
@@ -682,8 +869,9 @@ void Nes::CPU::dcp(AddressingMode addressingMode) {
     m_registers.status.setBitTo(CPUFlag::Negative, Utils::isValueNegative(toCompare));
 }
 
-void Nes::CPU::las(AddressingMode addressingMode) {
-    const auto addr    = readAddressOperand(addressingMode);
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::las() {
+    const auto addr    = readAddressOperand<Mode>();
     const auto operand = m_mmu.read(addr);
 
     const Byte result = operand & m_registers.stackPointer;
@@ -695,8 +883,9 @@ void Nes::CPU::las(AddressingMode addressingMode) {
     m_registers.status.setBitTo(CPUFlag::Negative, Utils::isValueNegative(result));
 }
 
-void Nes::CPU::isc(AddressingMode addressingMode) {
-    const auto operandAddress = readAddressOperand(addressingMode);
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::isc() {
+    const auto operandAddress = readAddressOperand<Mode>();
     const Byte updatedOperand = m_mmu.read(operandAddress) + 1;
 
     m_mmu.write(operandAddress, updatedOperand);
@@ -714,13 +903,14 @@ void Nes::CPU::isc(AddressingMode addressingMode) {
     m_registers.status.setBitTo(CPUFlag::Negative, Utils::isValueNegative(m_registers.accumulator));
 }
 
-void Nes::CPU::rra(AddressingMode addressingMode) {
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::rra() {
     Addr operandAddress;
     Byte value;
-    if (addressingMode == AddressingMode::Accumulator) {
-        value = readOperand(addressingMode);
+    if constexpr (std::same_as<Mode, AddressingMode::Accumulator>) {
+        value = readOperand<Mode>();
     } else {
-        operandAddress = readAddressOperand(addressingMode);
+        operandAddress = readAddressOperand<Mode>();
         value = m_mmu.read(operandAddress);
     }
 
@@ -732,7 +922,7 @@ void Nes::CPU::rra(AddressingMode addressingMode) {
         value = Utils::setBit(value, 7);
     }
 
-    if (addressingMode == AddressingMode::Accumulator) {
+    if constexpr (std::same_as<Mode, AddressingMode::Accumulator>) {
         m_registers.accumulator = value;
     } else {
         m_mmu.write(operandAddress, value);
@@ -751,13 +941,14 @@ void Nes::CPU::rra(AddressingMode addressingMode) {
     m_registers.status.setBitTo(CPUFlag::Negative, Utils::isValueNegative(m_registers.accumulator));
 }
 
-void Nes::CPU::rla(AddressingMode addressingMode) {
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::rla() {
     Addr operandAddress;
     Byte value;
-    if (addressingMode == AddressingMode::Accumulator) {
-        value = readOperand(AddressingMode::Accumulator);
+    if constexpr (std::same_as<Mode, AddressingMode::Accumulator>) {
+        value = readOperand<Mode>();
     } else {
-        operandAddress = readAddressOperand(addressingMode);
+        operandAddress = readAddressOperand<Mode>();
         value = m_mmu.read(operandAddress);
     }
 
@@ -769,7 +960,7 @@ void Nes::CPU::rla(AddressingMode addressingMode) {
         value = Utils::setBit(value, 0);
     }
 
-    if (addressingMode == AddressingMode::Accumulator) {
+    if constexpr (std::same_as<Mode, AddressingMode::Accumulator>) {
         m_registers.accumulator = value;
     } else {
         m_mmu.write(operandAddress, value);
@@ -780,13 +971,14 @@ void Nes::CPU::rla(AddressingMode addressingMode) {
     m_registers.status.setBitTo(CPUFlag::Negative, Utils::isValueNegative(m_registers.accumulator));
 }
 
-void Nes::CPU::sre(AddressingMode addressingMode) {
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::sre() {
     Addr operandAddress;
     Byte value;
-    if (addressingMode == AddressingMode::Accumulator) {
-        value = readOperand(addressingMode);
+    if constexpr (std::same_as<Mode, AddressingMode::Accumulator>) {
+        value = readOperand<Mode>();
     } else {
-        operandAddress = readAddressOperand(addressingMode);
+        operandAddress = readAddressOperand<Mode>();
         value = m_mmu.read(operandAddress);
     }
 
@@ -794,7 +986,7 @@ void Nes::CPU::sre(AddressingMode addressingMode) {
 
     value >>= 1;
 
-    if (addressingMode == AddressingMode::Accumulator) {
+    if constexpr (std::same_as<Mode, AddressingMode::Accumulator>) {
         m_registers.accumulator = value;
     } else {
         m_mmu.write(operandAddress, value);
@@ -805,13 +997,14 @@ void Nes::CPU::sre(AddressingMode addressingMode) {
     m_registers.status.setBitTo(CPUFlag::Negative, Utils::isValueNegative(m_registers.accumulator));
 }
 
-void Nes::CPU::slo(AddressingMode addressingMode) {
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::slo() {
     Addr operandAddress;
     Byte value;
-    if (addressingMode == AddressingMode::Accumulator) {
-        value = readOperand(addressingMode);
+    if constexpr (std::same_as<Mode, AddressingMode::Accumulator>) {
+        value = readOperand<Mode>();
     } else {
-        operandAddress = readAddressOperand(addressingMode);
+        operandAddress = readAddressOperand<Mode>();
         value = m_mmu.read(operandAddress);
     }
 
@@ -819,7 +1012,7 @@ void Nes::CPU::slo(AddressingMode addressingMode) {
 
     value <<= 1;
 
-    if (addressingMode == AddressingMode::Accumulator) {
+    if constexpr (std::same_as<Mode, AddressingMode::Accumulator>) {
         m_registers.accumulator = value;
     } else {
         m_mmu.write(operandAddress, value);
@@ -830,26 +1023,30 @@ void Nes::CPU::slo(AddressingMode addressingMode) {
     m_registers.status.setBitTo(CPUFlag::Negative, Utils::isValueNegative(m_registers.accumulator));
 }
 
-void Nes::CPU::sha(AddressingMode addressingMode) {
-    const auto addr = readAddressOperand(addressingMode);
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::sha() {
+    const auto addr = readAddressOperand<Mode>();
     const Byte value = (m_registers.accumulator & ((addr >> 8)) + 1) & 0xFF;
     m_mmu.write(addr, value);
 }
 
-void Nes::CPU::shx(AddressingMode addressingMode) {
-    const auto addr = readAddressOperand(addressingMode);
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::shx() {
+    const auto addr = readAddressOperand<Mode>();
     const Byte value = (m_registers.xIndex & ((addr >> 8)) + 1) & 0xFF;
     m_mmu.write(addr, value);
 }
 
-void Nes::CPU::shy(AddressingMode addressingMode) {
-    const auto addr = readAddressOperand(addressingMode);
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::shy() {
+    const auto addr = readAddressOperand<Mode>();
     const Byte value = (m_registers.yIndex & ((addr >> 8)) + 1) & 0xFF;
     m_mmu.write(addr, value);
 }
 
-void Nes::CPU::sbx(AddressingMode addressingMode) {
-    const auto operand = readOperand(addressingMode);
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::sbx() {
+    const auto operand = readOperand<Mode>();
 
     Byte result = m_registers.accumulator & m_registers.xIndex;
     m_registers.status.setBitTo(CPUFlag::Carry, result >= operand);
@@ -862,9 +1059,10 @@ void Nes::CPU::sbx(AddressingMode addressingMode) {
     m_registers.xIndex = result;
 }
 
-void Nes::CPU::ane(AddressingMode addressingMode) {
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::ane() {
     // This opcode is highly unstable, there are magic numbers possible (0xFF, 0x00, 0xEE etc)
-    const auto operand = readOperand(addressingMode);
+    const auto operand = readOperand<Mode>();
 
     m_registers.accumulator = (m_registers.accumulator | Const::aneMagicNumber) & m_registers.xIndex & operand;
 
@@ -872,8 +1070,9 @@ void Nes::CPU::ane(AddressingMode addressingMode) {
     m_registers.status.setBitTo(CPUFlag::Negative, Utils::isValueNegative(m_registers.accumulator));
 }
 
-void Nes::CPU::anc(AddressingMode addressingMode) {
-    const auto operand = readOperand(addressingMode);
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::anc() {
+    const auto operand = readOperand<Mode>();
 
     m_registers.accumulator &= operand;
 
@@ -882,8 +1081,9 @@ void Nes::CPU::anc(AddressingMode addressingMode) {
     m_registers.status.setBitTo(CPUFlag::Carry, m_registers.status.isBitSet(CPUFlag::Negative));
 }
 
-void Nes::CPU::alr(AddressingMode addressingMode) {
-    const auto operand = readOperand(addressingMode);
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::alr() {
+    const auto operand = readOperand<Mode>();
 
     m_registers.accumulator &= operand;
     m_registers.status.setBitTo(CPUFlag::Carry, Utils::isBitSet(m_registers.accumulator, 0));
@@ -893,6 +1093,11 @@ void Nes::CPU::alr(AddressingMode addressingMode) {
     m_registers.status.setBitTo(CPUFlag::Negative, Utils::isValueNegative(m_registers.accumulator));
 }
 
+template <Nes::Byte opcode>
+Nes::CycleCount Nes::CPU::invalidOpcode(CPU&) {
+    throw std::invalid_argument("Unhandled opcode: " + Utils::convertToHexString(opcode, true, 2));
+}
+
 void Nes::CPU::jam() {
     m_registers.programCounter--;
 
@@ -901,17 +1106,19 @@ void Nes::CPU::jam() {
     }
 }
 
-void Nes::CPU::nop(std::size_t instructionSize, std::optional<AddressingMode> addressingMode) {
-    if (addressingMode.has_value()) {
-        (void) readAddressOperand(addressingMode.value());
+template <Nes::AddressingModePolicy Mode>
+void Nes::CPU::nop() {
+    if constexpr (Mode::canCrossPage) {
+        (void) readAddressOperand<Mode>(); // for the page cross check
+    } else {
+        m_registers.programCounter += Mode::operandSize;
     }
-
-    m_registers.programCounter += (instructionSize - 1);
 }
 
-void Nes::CPU::unhandledInstruction(Byte opcode, AddressingMode addressingMode) {
-    if (addressingMode != AddressingMode::Implicit) {
-        (void) readOperand(addressingMode); // for side effects
+template <Nes::Byte opcode, Nes::AddressingModePolicy Mode>
+void Nes::CPU::unhandledInstruction() {
+    if constexpr (!std::same_as<Mode, AddressingMode::Implicit>) {
+        (void) readOperand<Mode>(); // for side effects
     }
 
     if (Const::logIllegal) {
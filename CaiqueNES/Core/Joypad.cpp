@@ -18,18 +18,11 @@
 
 #include "Core/Joypad.hpp"
 
-Nes::Joypad::Joypad(MMU& mmu, bool isSecondPlayer) :
+Nes::Joypad::Joypad(MMU& mmu, bool isSecondPlayer, APU* frameCounter) :
     m_mmu(mmu)
 {
     const auto ioRange = isSecondPlayer ? Const::AddrRange::joypad2IO : Const::AddrRange::joypadIO;
-    m_mmu.addMemoryRegion(ioRange,
-                          [&](MemoryRegion*, MMU*, Addr addr, Byte value) {
-                              handleWrite(value);
-                          },
-                          [&](MemoryRegion*, const MMU*, Addr) {
-                              return handleRead();
-                          },
-                          false);
+    m_mmu.addMemoryRegion(ioRange, JoypadDevice{this, frameCounter});
 
     for (auto i = 0; i < Const::joypadButtonCount; i++) {
         m_buttonStatus[static_cast<JoypadButton>(i)] = false;
@@ -64,3 +57,17 @@ void Nes::Joypad::press(JoypadButton button) {
 void Nes::Joypad::release(JoypadButton button) {
     m_buttonStatus[button] = false;
 }
+
+bool Nes::Joypad::isPressed(JoypadButton button) const {
+    return m_buttonStatus.at(button);
+}
+
+void Nes::Joypad::saveState(Utils::StateWriter& writer) const {
+    writer.write(m_singleButtonMode);
+    writer.write(m_singleButtonModeIndex);
+}
+
+void Nes::Joypad::loadState(Utils::StateReader& reader) {
+    reader.read(m_singleButtonMode);
+    reader.read(m_singleButtonModeIndex);
+}
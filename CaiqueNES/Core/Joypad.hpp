@@ -41,13 +41,18 @@ namespace Nes {
 
     class Joypad {
     public:
-        Joypad(MMU& mmu, bool isSecondPlayer);
+        Joypad(MMU& mmu, bool isSecondPlayer, APU* frameCounter = nullptr);
 
         void handleWrite(Byte value);
         Byte handleRead();
 
         void press(JoypadButton button);
         void release(JoypadButton button);
+        bool isPressed(JoypadButton button) const;
+
+        // Only the shift register is machine state, the buttons are host input and stay as they are when restoring
+        void saveState(Utils::StateWriter& writer) const;
+        void loadState(Utils::StateReader& reader);
 
     private:
         MMU& m_mmu;
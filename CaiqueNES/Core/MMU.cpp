@@ -17,32 +17,21 @@
 ***********************************************************************************************************************/
 
 #include "Core/MMU.hpp"
+#include "Core/Joypad.hpp"
+#include "Core/PPU.hpp"
+#include "Core/APU.hpp"
 #include "Utils/String.hpp"
 #include "Utils/Log.hpp"
 
-Nes::MemoryRegion::MemoryRegion(Utils::Range<Addr> addrRange, MemoryWriteFunction writeFunction,
-                                MemoryReadFunction readFunction, bool needsItsOwnMemory) :
+Nes::MemoryRegion::MemoryRegion(Utils::Range<Addr> addrRange, MemoryDevice device, bool needsItsOwnMemory) :
     addrRange(addrRange),
-    writeFunction(std::move(writeFunction)),
-    readFunction(std::move(readFunction))
+    device(std::move(device))
 {
-    if (needsItsOwnMemory) {
+    if (needsItsOwnMemory || std::holds_alternative<RAMDevice>(this->device)) {
         memory.resize(addrRange.extent(), 0);
     }
 }
 
-Nes::MemoryRegion::MemoryRegion(Utils::Range<Addr> addrRange) :
-        MemoryRegion(addrRange,
-                     [&](MemoryRegion* region, MMU*, Addr addr, Byte value) {
-                         region->memory.at(addr - region->addrRange.from) = value;
-                     },
-                     [&](MemoryRegion* region, const MMU*, Addr addr) {
-                         return region->memory.at(addr - region->addrRange.from);
-                     },
-                     true)
-{
-}
-
 Nes::MMU::MMU(Cartridge& cartridge) :
     m_cartridge(cartridge)
 {
@@ -50,50 +39,239 @@ Nes::MMU::MMU(Cartridge& cartridge) :
     addMemoryRegion(Const::AddrRange::workRAM);
     addMemoryRegion(Const::AddrRange::unmapped); // <- Note: Remove when non-nrom mappers added
 
-    addMemoryRegion(Const::AddrRange::mirror,
-                    [](MemoryRegion*, MMU* mmu, Addr addr, Byte value) {
-                        mmu->write(addr & Const::AddrRange::internalRAM.to, value);
-                    },
-                    [](MemoryRegion*, MMU* mmu, Addr addr) {
-                        return mmu->read(addr & Const::AddrRange::internalRAM.to);
-                    },
-                    false);
-
-    addMemoryRegion(Const::AddrRange::cartridgePRG,
-                    [](MemoryRegion* region, MMU* mmu, Addr addr, Byte value) {
-                        mmu->m_cartridge.mappedWritePRG(addr - region->addrRange.from, value);
-                    },
-                    [](MemoryRegion* region, MMU* mmu, Addr addr) -> Byte {
-                        return mmu->m_cartridge.mappedReadPRG(addr - region->addrRange.from);
-                    },
-                    false);
-}
-
-const Nes::Cartridge& Nes::MMU::accessCartridge() {
+    addMirrorRegion(Const::AddrRange::mirror, Const::AddrRange::internalRAM);
+    addMemoryRegion(Const::AddrRange::cartridgePRG, CartridgeDevice{});
+}
+
+Nes::Cartridge& Nes::MMU::accessCartridge() {
     return m_cartridge;
 }
 
 void Nes::MMU::addMemoryRegion(Utils::Range<Addr> addrRange, const MemoryWriteFunction& writeFunction,
                                    const MemoryReadFunction& readFunction, bool needItsOwnMemory = false) {
-    m_memoryRegions.emplace_back(addrRange, writeFunction, readFunction, needItsOwnMemory);
+    m_memoryRegions.emplace_back(addrRange, CustomDevice{writeFunction, readFunction}, needItsOwnMemory);
+    rebuildPageTable();
+}
+
+void Nes::MMU::addMemoryRegion(Utils::Range<Addr> addrRange, MemoryDevice device) {
+    m_memoryRegions.emplace_back(addrRange, std::move(device));
+    rebuildPageTable();
 }
 
 void Nes::MMU::addMemoryRegion(Utils::Range<Addr> addrRange) {
-    m_memoryRegions.emplace_back(addrRange);
+    addMemoryRegion(addrRange, RAMDevice{});
+}
+
+void Nes::MMU::addMirrorRegion(Utils::Range<Addr> addrRange, Utils::Range<Addr> mirroredRange) {
+    addMemoryRegion(addrRange, MirrorDevice{mirroredRange});
+}
+
+std::span<const Nes::Byte> Nes::MMU::viewMemory(Utils::Range<Addr> addrRange) const {
+    for (const auto& region : m_memoryRegions) {
+        if (region.addrRange.from == addrRange.from && region.addrRange.to == addrRange.to) {
+            return region.memory;
+        }
+    }
+
+    return {};
+}
+
+void Nes::MMU::saveState(Utils::StateWriter& writer) const {
+    for (const auto& region : m_memoryRegions) {
+        writer.writeBytes(region.memory);
+    }
+}
+
+void Nes::MMU::loadState(Utils::StateReader& reader) {
+    for (auto& region : m_memoryRegions) {
+        reader.readBytes(region.memory);
+    }
 }
 
 void Nes::MMU::clearMemoryRegions() {
     m_memoryRegions.clear();
+    rebuildPageTable();
 }
 
-void Nes::MMU::write(Addr addr, Byte value) {
-    auto region = std::find_if(m_memoryRegions.begin(), m_memoryRegions.end(), [&](const MemoryRegion& memoryRegion) {
+void Nes::MMU::rebuildPageTable() {
+    for (auto pageIndex = 0; pageIndex < Const::Paging::pageCount; pageIndex++) {
+        buildPage(pageIndex);
+    }
+
+    // Mirrors are resolved last so that they can reuse pointers of the pages they repeat
+    for (auto pageIndex = 0; pageIndex < Const::Paging::pageCount; pageIndex++) {
+        resolveMirrorPage(pageIndex);
+    }
+
+    m_prgMappingVersion = m_cartridge.prgMappingVersion();
+}
+
+void Nes::MMU::refreshCartridgePages() {
+    for (auto pageIndex = 0; pageIndex < Const::Paging::pageCount; pageIndex++) {
+        auto& page = m_pages[pageIndex];
+        if (page.region == nullptr || !std::holds_alternative<CartridgeDevice>(page.region->device)) {
+            continue;
+        }
+
+        const Addr pageStart = pageIndex << Const::Paging::pageShift;
+        page.readMemory = m_cartridge.mappedPRGPointer(pageStart - page.region->addrRange.from);
+    }
+
+    m_prgMappingVersion = m_cartridge.prgMappingVersion();
+}
+
+void Nes::MMU::buildPage(int pageIndex) {
+    const Addr pageStart = pageIndex << Const::Paging::pageShift;
+    const Addr pageEnd   = pageStart + (Const::Paging::pageSize - 1);
+
+    auto& page = m_pages[pageIndex];
+    page = MemoryPage{};
+
+    MemoryRegion* firstOverlapping = nullptr;
+    for (auto& region : m_memoryRegions) {
+        if (region.addrRange.from <= pageEnd && region.addrRange.to >= pageStart) {
+            firstOverlapping = &region;
+            break;
+        }
+    }
+
+    if (firstOverlapping == nullptr) {
+        return;
+    }
+
+    if (!firstOverlapping->addrRange.isValueWithin(pageStart) || !firstOverlapping->addrRange.isValueWithin(pageEnd)) {
+        page.regionPerAddr.resize(Const::Paging::pageSize, nullptr);
+        for (auto offset = 0; offset < Const::Paging::pageSize; offset++) {
+            page.regionPerAddr[offset] = findRegion(pageStart + offset);
+        }
+
+        return;
+    }
+
+    auto& region = *firstOverlapping;
+    page.region = &region;
+
+    if (std::holds_alternative<RAMDevice>(region.device)) {
+        page.writeMemory = region.memory.data() + (pageStart - region.addrRange.from);
+        page.readMemory  = page.writeMemory;
+    } else if (std::holds_alternative<CartridgeDevice>(region.device)) {
+        page.readMemory = m_cartridge.mappedPRGPointer(pageStart - region.addrRange.from);
+    }
+}
+
+void Nes::MMU::resolveMirrorPage(int pageIndex) {
+    auto& page = m_pages[pageIndex];
+    if (page.region == nullptr || !std::holds_alternative<MirrorDevice>(page.region->device)) {
+        return;
+    }
+
+    const auto& region        = *page.region;
+    const auto& mirroredRange = std::get<MirrorDevice>(region.device).mirroredRange;
+    const Addr pageStart      = pageIndex << Const::Paging::pageShift;
+    const Addr mirrored       = mirroredRange.from + ((pageStart - region.addrRange.from) % mirroredRange.extent());
+
+    const auto& mirroredPage = m_pages[mirrored >> Const::Paging::pageShift];
+    if (mirroredRange.extent() % Const::Paging::pageSize != 0 || Utils::getLowerByte(mirrored) != 0 ||
+        mirroredPage.region == nullptr)
+    {
+        return;
+    }
+
+    page.readMemory  = mirroredPage.readMemory;
+    page.writeMemory = mirroredPage.writeMemory;
+}
+
+Nes::MemoryRegion* Nes::MMU::findRegion(Addr addr) {
+    const auto region = std::find_if(m_memoryRegions.begin(), m_memoryRegions.end(), [&](const MemoryRegion& memoryRegion) {
         return memoryRegion.addrRange.isValueWithin(addr);
     });
 
-    if (region != m_memoryRegions.end()) {
-        auto& regionObj = *region;
-        regionObj.writeFunction(&regionObj, this, addr, value);
+    return region != m_memoryRegions.end() ? &(*region) : nullptr;
+}
+
+void Nes::MMU::writeToDevice(MemoryRegion& region, Addr addr, Byte value) {
+    std::visit(Utils::Overloaded{
+        [&](RAMDevice&) {
+            region.memory.at(addr - region.addrRange.from) = value;
+        },
+        [&](const MirrorDevice& device) {
+            const auto offset = (addr - region.addrRange.from) % device.mirroredRange.extent();
+            write(device.mirroredRange.from + offset, value);
+        },
+        [&](CartridgeDevice&) {
+            m_cartridge.mappedWritePRG(addr - region.addrRange.from, value);
+            if (m_cartridge.prgMappingVersion() != m_prgMappingVersion) {
+                refreshCartridgePages();
+            }
+        },
+        [&](const PPUDevice& device) {
+            if (Const::AddrRange::oamDmaRequest.isValueWithin(addr)) {
+                device.ppu->handleOamDmaRequest(value);
+            } else {
+                device.ppu->handlePPURegisterWrite(addr & Const::AddrRange::ppuRegisters.to, value);
+            }
+        },
+        [&](const APUDevice& device) {
+            device.apu->handleAPURegisterWrite(addr, value);
+        },
+        [&](const JoypadDevice& device) {
+            device.joypad->handleWrite(value);
+            if (device.frameCounter != nullptr) {
+                device.frameCounter->handleFrameCounterWrite(value);
+            }
+        },
+        [&](const CustomDevice& device) {
+            device.writeFunction(&region, this, addr, value);
+        }
+    }, region.device);
+}
+
+Nes::Byte Nes::MMU::readFromDevice(MemoryRegion& region, Addr addr) {
+    return std::visit(Utils::Overloaded{
+        [&](RAMDevice&) -> Byte {
+            return region.memory.at(addr - region.addrRange.from);
+        },
+        [&](const MirrorDevice& device) -> Byte {
+            const auto offset = (addr - region.addrRange.from) % device.mirroredRange.extent();
+            return read(device.mirroredRange.from + offset);
+        },
+        [&](CartridgeDevice&) -> Byte {
+            return m_cartridge.mappedReadPRG(addr - region.addrRange.from);
+        },
+        [&](const PPUDevice& device) -> Byte {
+            if (Const::AddrRange::oamDmaRequest.isValueWithin(addr)) {
+                Utils::log("Attempted to read OAM DMA request address");
+                return 0x00;
+            }
+
+            return device.ppu->handlePPURegisterRead(addr & Const::AddrRange::ppuRegisters.to);
+        },
+        [&](const APUDevice& device) -> Byte {
+            return device.apu->handleAPURegisterRead(addr);
+        },
+        [&](const JoypadDevice& device) -> Byte {
+            return device.joypad->handleRead();
+        },
+        [&](const CustomDevice& device) -> Byte {
+            return device.readFunction(&region, this, addr);
+        }
+    }, region.device);
+}
+
+void Nes::MMU::write(Addr addr, Byte value) {
+    const auto& page = m_pages[addr >> Const::Paging::pageShift];
+    if (page.writeMemory != nullptr) {
+        page.writeMemory[addr & (Const::Paging::pageSize - 1)] = value;
+        return;
+    }
+
+    auto* region = page.region;
+    if (region == nullptr && !page.regionPerAddr.empty()) {
+        region = page.regionPerAddr[addr & (Const::Paging::pageSize - 1)];
+    }
+
+    if (region != nullptr) {
+        writeToDevice(*region, addr, value);
     } else {
         Utils::log("Writing to invalid address: " + Utils::convertToHexString(addr, true, 4));
     }
@@ -105,13 +283,18 @@ void Nes::MMU::writeWord(Addr addr, Word value) {
 }
 
 Nes::Byte Nes::MMU::read(Addr addr) {
-    const auto region = std::find_if(m_memoryRegions.begin(), m_memoryRegions.end(), [&](const MemoryRegion& memoryRegion) {
-        return memoryRegion.addrRange.isValueWithin(addr);
-    });
+    const auto& page = m_pages[addr >> Const::Paging::pageShift];
+    if (page.readMemory != nullptr) {
+        return page.readMemory[addr & (Const::Paging::pageSize - 1)];
+    }
+
+    auto* region = page.region;
+    if (region == nullptr && !page.regionPerAddr.empty()) {
+        region = page.regionPerAddr[addr & (Const::Paging::pageSize - 1)];
+    }
 
-    if (region != m_memoryRegions.end()) {
-        auto& regionObj = *region;
-        return regionObj.readFunction(&regionObj, this, addr);
+    if (region != nullptr) {
+        return readFromDevice(*region, addr);
     } else {
         Utils::log("Reading from invalid address: " + Utils::convertToHexString(addr, true, 4));
         return 0x00;
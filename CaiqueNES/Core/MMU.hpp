@@ -20,8 +20,13 @@
 #define CAIQUE_NES_MMU_HPP
 
 #include <functional>
+#include <variant>
+#include <span>
+#include <array>
+#include <vector>
 #include "Core/Cartridge.hpp"
 #include "Utils/Range.hpp"
+#include "Utils/StateStream.hpp"
 #include "Utils/Types.hpp"
 
 #ifdef TESTING_ENVIRONMENT_6502
@@ -47,6 +52,12 @@ namespace Nes {
             constexpr Utils::Range<Addr> cartridgePRG        = {0x8000, 0xFFFF};
         }
 
+        namespace Paging {
+            constexpr int pageSize  = 256;
+            constexpr int pageCount = 256;
+            constexpr int pageShift = 8;
+        }
+
         namespace VectorAddr {
             constexpr Addr interrupt = 0xFFFA;
             constexpr Addr reset     = 0xFFFC;
@@ -55,35 +66,85 @@ namespace Nes {
     }
 
     class MMU;
+    class PPU;
+    class APU;
+    class Joypad;
     struct MemoryRegion;
 
     using MemoryWriteFunction = std::function<void(MemoryRegion*, MMU*, Addr, Byte)>;
     using MemoryReadFunction  = std::function<Byte(MemoryRegion*, MMU*, Addr)>;
 
+    /* Devices which can be attached to the CPU bus */
+    struct RAMDevice {};
+
+    struct MirrorDevice {
+        Utils::Range<Addr> mirroredRange;
+    };
+
+    struct CartridgeDevice {};
+
+    struct PPUDevice {
+        PPU* ppu;
+    };
+
+    struct APUDevice {
+        APU* apu;
+    };
+
+    // The second joypad's port doubles as the APU frame counter, which receives the writes
+    struct JoypadDevice {
+        Joypad* joypad;
+        APU* frameCounter = nullptr;
+    };
+
+    struct CustomDevice {
+        MemoryWriteFunction writeFunction;
+        MemoryReadFunction  readFunction;
+    };
+
+    using MemoryDevice = std::variant<RAMDevice, MirrorDevice, CartridgeDevice, PPUDevice, APUDevice, JoypadDevice,
+                                      CustomDevice>;
+
     struct MemoryRegion {
-        MemoryRegion(Utils::Range<Addr> addrRange, MemoryWriteFunction writeFunction, MemoryReadFunction readFunction,
-                     bool needItsOwnMemory = false);
-        explicit MemoryRegion(Utils::Range<Addr> addrRange);
+        MemoryRegion(Utils::Range<Addr> addrRange, MemoryDevice device, bool needItsOwnMemory = false);
 
         std::vector<Byte> memory;
 
         Utils::Range<Addr> addrRange;
 
-        MemoryWriteFunction writeFunction;
-        MemoryReadFunction  readFunction;
+        MemoryDevice device;
+    };
+
+    // Resolves a 256 byte page of the CPU address space. Pages backed by plain memory are accessed through the
+    // pointers directly, pages owned by a single region skip the lookup, mixed pages keep a per-address table.
+    struct MemoryPage {
+        const Byte* readMemory  = nullptr;
+        Byte*       writeMemory = nullptr;
+
+        MemoryRegion* region = nullptr;
+        std::vector<MemoryRegion*> regionPerAddr{};
     };
 
     class MMU : Module {
     public:
         explicit MMU(Cartridge& cartridge);
 
-        const Cartridge& accessCartridge();
+        Cartridge& accessCartridge();
 
         void addMemoryRegion(Utils::Range<Addr> addrRange, const MemoryWriteFunction& writeFunction,
                              const MemoryReadFunction& readFunction, bool needItsOwnMemory);
+        void addMemoryRegion(Utils::Range<Addr> addrRange, MemoryDevice device);
         void addMemoryRegion(Utils::Range<Addr> addrRange);
+        void addMirrorRegion(Utils::Range<Addr> addrRange, Utils::Range<Addr> mirroredRange);
+
+        // Memory backing the region which covers exactly addrRange, empty if there is no such region
+        std::span<const Byte> viewMemory(Utils::Range<Addr> addrRange) const;
 
         void clearMemoryRegions();
+        void rebuildPageTable();
+
+        // Points the cartridge pages at the currently mapped PRG banks, needed after the mapper switched banks
+        void refreshCartridgePages();
 
         void write(Addr addr, Byte value);
         void writeWord(Addr addr, Word value);
@@ -91,10 +152,22 @@ namespace Nes {
         Byte read(Addr addr);
         Word readWord(Addr addr);
 
+        void saveState(Utils::StateWriter& writer) const;
+        void loadState(Utils::StateReader& reader);
+
     private:
         Cartridge& m_cartridge;
 
         std::vector<MemoryRegion> m_memoryRegions;
+        std::array<MemoryPage, Const::Paging::pageCount> m_pages{};
+        std::uint32_t m_prgMappingVersion = 0;
+
+        void buildPage(int pageIndex);
+        void resolveMirrorPage(int pageIndex);
+        MemoryRegion* findRegion(Addr addr);
+
+        void writeToDevice(MemoryRegion& region, Addr addr, Byte value);
+        Byte readFromDevice(MemoryRegion& region, Addr addr);
 
 #ifdef TESTING_ENVIRONMENT_6502
         public:
@@ -36,14 +36,22 @@ int Nes::OAMEntry::getPaletteId() const {
     return (2 * secondBit) + firstBit;
 }
 
-Graphics::Position Nes::OAMEntry::getPosition(int pixelX, int pixelY) const {
-    int x = m_internalPosition.x;
-    x += m_attributes.isBitSet(SpriteAttribute::FlipHorizontal) ? -pixelX : pixelX;
-    x += m_attributes.isBitSet(SpriteAttribute::FlipHorizontal) ? Const::flipOffset : 0;
+int Nes::OAMEntry::getX() const {
+    return m_internalPosition.x;
+}
+
+int Nes::OAMEntry::getY() const {
+    return m_internalPosition.y;
+}
 
-    int y = m_internalPosition.y;
-    y += m_attributes.isBitSet(SpriteAttribute::FlipVertical) ? Const::flipOffset : 0;
-    y += m_attributes.isBitSet(SpriteAttribute::FlipVertical) ? -pixelY : pixelY;
+bool Nes::OAMEntry::isFlippedHorizontally() const {
+    return m_attributes.isBitSet(SpriteAttribute::FlipHorizontal);
+}
+
+bool Nes::OAMEntry::isFlippedVertically() const {
+    return m_attributes.isBitSet(SpriteAttribute::FlipVertical);
+}
 
-    return {x, y};
+bool Nes::OAMEntry::isBehindBackground() const {
+    return m_attributes.isBitSet(SpriteAttribute::Priority);
 }
@@ -26,7 +26,6 @@
 namespace Nes {
     namespace Const {
         constexpr int oamEntrySize = 4;
-        constexpr int flipOffset   = 7;
 
         namespace OAMByteIndex {
             constexpr int yPosition  = 0;
@@ -50,7 +49,12 @@ namespace Nes {
 
         Byte getSpriteId() const;
         int getPaletteId() const;
-        Graphics::Position getPosition(int pixelX, int pixelY) const;
+        int getX() const;
+        int getY() const;
+
+        bool isFlippedHorizontally() const;
+        bool isFlippedVertically() const;
+        bool isBehindBackground() const;
 
     private:
         Byte m_spriteId;
@@ -16,41 +16,24 @@
 *
 ***********************************************************************************************************************/
 
+#include <algorithm>
 #include "Core/PPU.hpp"
 #include "Utils/String.hpp"
 #include "Utils/Log.hpp"
 
-Nes::PPU::PPU(MMU& mmu, DrawFunction drawCallback) :
+Nes::PPU::PPU(MMU& mmu, Scheduler& scheduler, DrawFunction drawCallback) :
     m_mmu(mmu),
-    m_drawCallback(std::move(drawCallback))
+    m_scheduler(scheduler),
+    m_drawCallback(std::move(drawCallback)),
+    m_syncedAt(scheduler.now())
 {
-    m_mmu.addMemoryRegion(Const::AddrRange::ppuRegisters,
-                          [&](MemoryRegion*, MMU*, Addr addr, Byte byte) {
-                              handlePPURegisterWrite(addr, byte);
-                          },
-                          [&](MemoryRegion*, MMU*, Addr addr) {
-                              return handlePPURegisterRead(addr);
-                          },
-                          false);
-
-    m_mmu.addMemoryRegion(Const::AddrRange::ppuRegistersMirror,
-                          [&](MemoryRegion*, MMU*, Addr addr, Byte byte) {
-                              handlePPURegisterWrite(addr & Const::AddrRange::ppuRegisters.to, byte);
-                          },
-                          [&](MemoryRegion*, MMU*, Addr addr) {
-                              return handlePPURegisterRead(addr & Const::AddrRange::ppuRegisters.to);
-                          },
-                          false);
-
-    m_mmu.addMemoryRegion(Const::AddrRange::oamDmaRequest,
-                          [&](MemoryRegion*, MMU*, Addr, Byte byte) {
-                              handleOamDmaRequest(byte);
-                          },
-                          [&](MemoryRegion*, MMU*, Addr) -> Byte {
-                              Utils::log("Attempted to read OAM DMA request address");
-                              return 0x00;
-                          },
-                          false);
+    m_mmu.addMemoryRegion(Const::AddrRange::ppuRegisters, PPUDevice{this});
+    m_mmu.addMemoryRegion(Const::AddrRange::ppuRegistersMirror, PPUDevice{this});
+    m_mmu.addMemoryRegion(Const::AddrRange::oamDmaRequest, PPUDevice{this});
+
+    m_scheduler.setHandler(EventType::PpuCatchUp, [this] { synchronize(); });
+    m_mmu.accessCartridge().connectPPU(m_scheduler, [this] { synchronize(); });
+    updateSyncDeadline();
 }
 
 bool Nes::PPU::nmiStatus() {
@@ -60,7 +43,70 @@ bool Nes::PPU::nmiStatus() {
     return oldNmiStatus;
 }
 
+void Nes::PPU::setDrawEnabled(bool enabled) {
+    m_drawEnabled = enabled;
+}
+
+void Nes::PPU::setFrameTarget(FrameBuffer* target) {
+    m_frameTarget = target != nullptr ? target : &m_frameBuffer;
+}
+
+const Nes::FrameBuffer& Nes::PPU::frameBuffer() const {
+    return *m_frameTarget;
+}
+
+// The frame buffer is left out, it is fully redrawn during the next frame
+void Nes::PPU::saveState(Utils::StateWriter& writer) const {
+    writer.write(m_cycles);
+    writer.write(m_scanline);
+    writer.write(m_syncedAt);
+    writer.write(m_nmiStatus);
+    writer.write(m_lastReadBuffer);
+
+    writer.write(m_control.getCombinedValue());
+    writer.write(m_status.getCombinedValue());
+    writer.write(m_mask.getCombinedValue());
+    writer.write(m_oamAddr);
+    writer.write(m_addr);
+    writer.write(m_scrollX);
+    writer.write(m_scrollY);
+    writer.write(m_frameScrollY);
+    writer.write(m_frameNametableY);
+    writer.write(m_scrollLatch);
+    writer.write(m_addrLatch);
+
+    writer.writeBytes(m_palettes);
+    writer.writeBytes(m_oam);
+    writer.writeBytes(m_nametables);
+}
+
+void Nes::PPU::loadState(Utils::StateReader& reader) {
+    reader.read(m_cycles);
+    reader.read(m_scanline);
+    reader.read(m_syncedAt);
+    reader.read(m_nmiStatus);
+    reader.read(m_lastReadBuffer);
+
+    m_control.setCombinedValue(reader.read<Byte>());
+    m_status.setCombinedValue(reader.read<Byte>());
+    m_mask.setCombinedValue(reader.read<Byte>());
+    reader.read(m_oamAddr);
+    reader.read(m_addr);
+    reader.read(m_scrollX);
+    reader.read(m_scrollY);
+    reader.read(m_frameScrollY);
+    reader.read(m_frameNametableY);
+    reader.read(m_scrollLatch);
+    reader.read(m_addrLatch);
+
+    reader.readBytes(m_palettes);
+    reader.readBytes(m_oam);
+    reader.readBytes(m_nametables);
+}
+
 void Nes::PPU::handleOamDmaRequest(Byte addressUpperByte) {
+    synchronize();
+
     const Addr copyFrom = Utils::combineBytes(addressUpperByte, 0x00);
     const Addr copyUpTo = Utils::combineBytes(addressUpperByte, 0xFF);
 
@@ -74,9 +120,27 @@ void Nes::PPU::handleOamDmaRequest(Byte addressUpperByte) {
 }
 
 void Nes::PPU::tick(CycleCount cpuCycleCount) {
-    m_cycles += Const::cpuToPpuCycleMultiplier * cpuCycleCount;
-    if (m_cycles >= Const::ppuCycleThreshold) {
-        m_cycles %= Const::ppuCycleThreshold;
+    m_scheduler.advance(cpuCycleCount);
+    if (m_scheduler.isDue(EventType::PpuCatchUp)) {
+        synchronize();
+    }
+}
+
+void Nes::PPU::synchronize() {
+    const auto pendingCycles = static_cast<CycleCount>(m_scheduler.now() - m_syncedAt);
+    m_cycles += Const::cpuToPpuCycleMultiplier * pendingCycles;
+    m_syncedAt = m_scheduler.now();
+
+    while (m_cycles >= Const::ppuCycleThreshold) {
+        m_cycles -= Const::ppuCycleThreshold;
+
+        if (m_scanline < Const::screenHeight) {
+            drawScanline(m_scanline);
+        }
+
+        if (doesA12Rise(m_scanline)) {
+            m_mmu.accessCartridge().handleA12Rise();
+        }
 
         switch (++m_scanline) {
             case Const::Scanline::vBlank: handleVBlankScanline(); break;
@@ -84,9 +148,77 @@ void Nes::PPU::tick(CycleCount cpuCycleCount) {
             default:  /* Continue execution until threshold */    break;
         }
     }
+
+    updateSyncDeadline();
+}
+
+// Without NMIs enabled the CPU can only notice VBlank through the status register, which synchronizes by itself
+void Nes::PPU::updateSyncDeadline() {
+    const bool nmiPending = m_scanline < Const::Scanline::vBlank &&
+                            m_control.isBitSet(ControlRegisterFlag::ShouldGenerateVBlankNMI);
+
+    auto deadline = cpuCyclesUntilScanline(nmiPending ? Const::Scanline::vBlank : Const::Scanline::final);
+
+    // A scanline counter IRQ has to reach the CPU on the scanline it fires, rises are handled at the end of the line
+    if (const auto irqScanline = findIrqScanline(); irqScanline.has_value()) {
+        deadline = std::min(deadline, cpuCyclesUntilScanline(*irqScanline + 1));
+    }
+
+    m_scheduler.schedule(EventType::PpuCatchUp, m_syncedAt + deadline);
+}
+
+// The CPU picks the NMI up before its next instruction
+void Nes::PPU::raiseNmi() {
+    m_nmiStatus = true;
+    m_scheduler.schedule(EventType::Nmi, m_scheduler.now());
+}
+
+Nes::CycleCount Nes::PPU::cpuCyclesUntilScanline(int scanline) const {
+    const auto ppuCycles = (scanline - m_scanline) * Const::ppuCycleThreshold - m_cycles;
+    return (ppuCycles + Const::cpuToPpuCycleMultiplier - 1) / Const::cpuToPpuCycleMultiplier;
+}
+
+// A12 selects the upper pattern table, it rises once per rendered line when the sprite fetches use a different table
+// than the background ones. Rather than following every fetch, the rise is counted once for the whole line.
+bool Nes::PPU::doesA12Rise(int scanline) const {
+    if (scanline >= Const::screenHeight && scanline != Const::Scanline::preRender) {
+        return false;
+    }
+
+    if (!m_mask.isBitSet(MaskRegisterFlag::ShowBackground) && !m_mask.isBitSet(MaskRegisterFlag::ShowSprites)) {
+        return false;
+    }
+
+    return m_control.isBitSet(ControlRegisterFlag::SpritePatternTableAddr) ||
+           m_control.isBitSet(ControlRegisterFlag::BackgroundPatternTableAddr) ||
+           m_control.isBitSet(ControlRegisterFlag::SpriteSize);
+}
+
+// Only scanlines of the current frame are considered, the PPU catches up at the end of the frame anyway
+std::optional<int> Nes::PPU::findIrqScanline() const {
+    const auto risesUntilIrq = m_mmu.accessCartridge().a12RisesUntilIrq();
+    if (!risesUntilIrq.has_value()) {
+        return std::nullopt;
+    }
+
+    auto rises = 0;
+    for (auto scanline = m_scanline; scanline < Const::Scanline::final; scanline++) {
+        if (doesA12Rise(scanline) && ++rises == *risesUntilIrq) {
+            return scanline;
+        }
+    }
+
+    return std::nullopt;
+}
+
+Nes::CycleCount Nes::PPU::cpuCyclesUntilFrameEnd() {
+    synchronize();
+    return cpuCyclesUntilScanline(Const::Scanline::final);
 }
 
 void Nes::PPU::handlePPURegisterWrite(Addr addr, Byte value) {
+    synchronize();
+
     switch (addr) {
         case Const::RegisterAddress::oamData: writeToOam(value); break;
         case Const::RegisterAddress::data:    write(value);      break;
@@ -121,12 +253,19 @@ void Nes::PPU::handlePPURegisterWrite(Addr addr, Byte value) {
                 m_control.isBitSet(ControlRegisterFlag::ShouldGenerateVBlankNMI) &&
                 m_status.isBitSet(StatusRegisterFlag::VBlank))
             {
-                m_nmiStatus = true;
+                raiseNmi();
             }
+
+            updateSyncDeadline();
+            break;
         }
 
-        case Const::RegisterAddress::mask:    m_mask.setCombinedValue(value); break;
-        case Const::RegisterAddress::oamAddr: m_oamAddr = value;              break;
+        case Const::RegisterAddress::mask:
+            m_mask.setCombinedValue(value);
+            updateSyncDeadline();
+            break;
+
+        case Const::RegisterAddress::oamAddr: m_oamAddr = value; break;
 
         case Const::RegisterAddress::status:
             Utils::log("Write to read-only PPU status register");
@@ -138,6 +277,8 @@ void Nes::PPU::handlePPURegisterWrite(Addr addr, Byte value) {
 }
 
 Nes::Byte Nes::PPU::handlePPURegisterRead(Addr addr) {
+    synchronize();
+
     switch (addr) {
         case Const::RegisterAddress::oamData: return m_oam[m_oamAddr];
         case Const::RegisterAddress::data: {
@@ -203,8 +344,8 @@ Nes::Addr Nes::PPU::normalizePaletteAddr() const {
     return requestedAddr - Const::PPUAddrRange::palette.from;
 }
 
-Nes::Addr Nes::PPU::normalizeNametableAddr() const {
-    const Addr normalisedAddr = (m_addr & Const::PPUAddrRange::nametables.to) - Const::PPUAddrRange::nametables.from;
+Nes::Addr Nes::PPU::normalizeNametableAddr(Addr addr) const {
+    const Addr normalisedAddr = (addr & Const::PPUAddrRange::nametables.to) - Const::PPUAddrRange::nametables.from;
     const auto mirroring      = m_mmu.accessCartridge().mirroring();
     const Word nametableIndex = normalisedAddr / Const::nametableSize;
 
@@ -212,6 +353,11 @@ Nes::Addr Nes::PPU::normalizeNametableAddr() const {
         return normalisedAddr;
     }
 
+    if (mirroring == Mirroring::SingleScreenLower || mirroring == Mirroring::SingleScreenUpper) {
+        const Addr offset = mirroring == Mirroring::SingleScreenUpper ? Const::nametableSize : 0;
+        return offset + (normalisedAddr % Const::nametableSize);
+    }
+
     switch (nametableIndex) {
         case 0x01: return mirroring == Mirroring::Horizontal ? normalisedAddr - Const::nametableSize : normalisedAddr;
         case 0x02: return mirroring == Mirroring::Horizontal ? normalisedAddr - Const::nametableSize : normalisedAddr - (2 * Const::nametableSize);
@@ -226,8 +372,10 @@ void Nes::PPU::writeToOam(Byte value) {
 }
 
 void Nes::PPU::write(Byte value) {
-    if (Const::PPUAddrRange::nametables.isValueWithin(m_addr)) {
-        const auto timetableAddr = normalizeNametableAddr();
+    if (Const::PPUAddrRange::chr.isValueWithin(m_addr)) {
+        m_mmu.accessCartridge().mappedWriteCHR(m_addr, value);
+    } else if (Const::PPUAddrRange::nametables.isValueWithin(m_addr)) {
+        const auto timetableAddr = normalizeNametableAddr(m_addr);
         m_nametables[timetableAddr] = value;
     } else if (Const::PPUAddrRange::palette.isValueWithin(m_addr)) {
         m_palettes[normalizePaletteAddr()] = value;
@@ -242,7 +390,7 @@ Nes::Byte Nes::PPU::read() {
     if (Const::PPUAddrRange::chr.isValueWithin(m_addr)) {
         return returnAndSwapBuffer(m_mmu.accessCartridge().mappedReadCHR(m_addr));
     } else if (Const::PPUAddrRange::nametables.isValueWithin(m_addr)) {
-        const auto timetableAddr = normalizeNametableAddr();
+        const auto timetableAddr = normalizeNametableAddr(m_addr);
         return returnAndSwapBuffer(m_nametables[timetableAddr]);
     } else if (Const::PPUAddrRange::palette.isValueWithin(m_addr)) {
         return m_palettes[normalizePaletteAddr()];
@@ -255,7 +403,7 @@ void Nes::PPU::handleVBlankScanline() {
     m_status.setBit(StatusRegisterFlag::VBlank);
     m_status.clearBit(StatusRegisterFlag::SpriteHitZero);
     if (m_control.isBitSet(ControlRegisterFlag::ShouldGenerateVBlankNMI)) {
-        m_nmiStatus = true;
+        raiseNmi();
     }
 }
 
@@ -269,9 +417,16 @@ void Nes::PPU::handleFinalScanline() {
     drawFrame();
 }
 
-Nes::Palette Nes::PPU::createBackgroundPalette(Word column, Word row) const {
-    const auto attributeTableId = row / 4 * 8 + column / 4;
-    const Byte attributeByte = m_nametables[Const::PPUAddrRange::nametable0.to - Const::attributeTableSize + attributeTableId];
+const Nes::PatternRow& Nes::PPU::fetchPatternRow(Addr patternTable, Byte tileNumber, int fineY) const {
+    const auto tileIndex = (patternTable / Const::tileSize) + tileNumber;
+    return m_mmu.accessCartridge().mappedReadPatternRow(tileIndex, fineY);
+}
+
+Nes::Byte Nes::PPU::fetchBackgroundPaletteId(int nametable, int column, int row) const {
+    const auto attributeId = (row / Const::tilesPerAttribute) * Const::attributeTableWidth + column / Const::tilesPerAttribute;
+    const Addr attributeAddr = Const::PPUAddrRange::nametables.from + (nametable * Const::nametableSize) +
+                               Const::attributeTableOffset + attributeId;
+    const Byte attributeByte = m_nametables[normalizeNametableAddr(attributeAddr)];
 
     const auto columnCheck = ((column % 4) / 2) == 1;
     const auto rowCheck    = ((row % 4) / 2)    == 1;
@@ -280,90 +435,171 @@ Nes::Palette Nes::PPU::createBackgroundPalette(Word column, Word row) const {
     shiftMagnitude += columnCheck ? 2 : 0;
     shiftMagnitude += rowCheck ? 4 : 0;
 
-    const Addr paletteStartingAddr = Const::colorIndexCount * ((attributeByte >> shiftMagnitude) & 0b11) + 1;
+    return (attributeByte >> shiftMagnitude) & 0b11;
+}
 
-    std::array<Byte, Const::colorIndexCount> paletteBytes{0};
-    paletteBytes[0] = m_palettes[0];
-    for (auto i = 1; i < Const::colorIndexCount; i++) {
-        paletteBytes[i] = m_palettes[paletteStartingAddr + i - 1];
+Nes::OAMEntry Nes::PPU::createOAMEntry(Addr startingAddr) const {
+    std::array<Byte, Const::oamEntrySize> bytes{0};
+    for (auto i = startingAddr; i < (startingAddr + Const::oamEntrySize); i++) {
+        bytes[i - startingAddr] = m_oam[i];
     }
 
-    return Palette(paletteBytes);
+    return OAMEntry(bytes);
 }
 
-Nes::Palette Nes::PPU::createSpritePalette(Word paletteId) const {
-    const auto paletteStartingAddr = Const::spritePaletteOffset + (paletteId * Const::colorIndexCount);
-
-    std::array<Byte, Const::colorIndexCount> paletteBytes{0};
-    for (auto i = 1; i < Const::colorIndexCount; i++) {
-        paletteBytes[i] = m_palettes[paletteStartingAddr + i - 1];
+bool Nes::PPU::isSpriteZeroHitPossible(int scanline) const {
+    if (m_status.isBitSet(StatusRegisterFlag::SpriteHitZero) || !m_mask.isBitSet(MaskRegisterFlag::ShowBackground) ||
+        !m_mask.isBitSet(MaskRegisterFlag::ShowSprites))
+    {
+        return false;
     }
 
-    return Palette(paletteBytes);
+    const auto spriteHeight = m_control.isBitSet(ControlRegisterFlag::SpriteSize) ?
+                              Const::largeSpriteHeight : Const::smallSpriteHeight;
+    const auto spriteRow = scanline - createOAMEntry(0).getY();
+
+    return spriteRow >= 0 && spriteRow < spriteHeight;
 }
 
-Nes::Tile Nes::PPU::createTile(ControlRegisterFlag addrControlBit, Addr tileNumber, const Palette& palette) const {
-    const auto bank = m_control.isBitSet(addrControlBit) ? Const::backgroundBankWhenSet : 0x0;
-    const auto startingAddr = (tileNumber * Const::tileSize) + bank;
+void Nes::PPU::drawScanline(int scanline) {
+    if (scanline == 0) {
+        m_frameScrollY    = m_scrollY;
+        m_frameNametableY = (m_control.getCombinedValue() & Const::baseNametableMask) >= 2;
+    }
 
-    std::array<Byte, Const::tileSize> tileBytes{};
-    for (auto i = startingAddr; i < (startingAddr + Const::tileSize); i++) {
-        tileBytes[i - startingAddr] = m_mmu.accessCartridge().mappedReadCHR(i);
+    if (!m_drawEnabled) {
+        if (isSpriteZeroHitPossible(scanline)) {
+            drawBackgroundLine(scanline);
+            drawSpriteLine(scanline);
+        }
+
+        return;
     }
 
-    return Tile(tileBytes, palette);
-}
+    drawBackgroundLine(scanline);
+    drawSpriteLine(scanline);
 
-Nes::OAMEntry Nes::PPU::createOAMEntry(Addr startingAddr) const {
-    std::array<Byte, Const::oamEntrySize> bytes{0};
-    for (auto i = startingAddr; i < (startingAddr + Const::oamEntrySize); i++) {
-        bytes[i - startingAddr] = m_oam[i];
+    PaletteColors paletteColors{0};
+    for (auto i = 0; i < Const::MemorySize::palettes; i++) {
+        paletteColors[i] = getSystemColor(m_palettes[i]);
     }
 
-    return OAMEntry(bytes);
-}
+    PixelKernels::resolveColors(m_linePaletteIndexes.data(), paletteColors, m_linePixels.data(), Const::screenWidth);
 
-void Nes::PPU::drawFrame() {
-    drawBackground();
-    drawSprites();
-    m_drawCallback(m_frameBuffer);
+    m_frameTarget->updateLine(scanline, m_linePixels);
 }
 
-void Nes::PPU::drawBackground() {
-    for(auto i = 0; i < Const::PPUAddrRange::nametable0.to - Const::attributeTableSize; i++) {
-        const auto index  = m_nametables[i];
-        const auto column = i % 32;
-        const auto row    = i / 32;
-
-        const auto palette = createBackgroundPalette(column, row);
-        const auto tile    = createTile(ControlRegisterFlag::BackgroundPatternTableAddr, index, palette);
+// Fills the scanline with palette RAM indexes, 0 meaning the backdrop color shows through
+void Nes::PPU::drawBackgroundLine(int scanline) {
+    m_linePaletteIndexes.fill(0);
+    if (!m_mask.isBitSet(MaskRegisterFlag::ShowBackground)) {
+        return;
+    }
 
-        for (auto pixelY = 0; pixelY < Const::tileDimension; pixelY++) {
-            for (auto pixelX = (Const::tileDimension - 1); pixelX >= 0; pixelX--) {
-                const Graphics::PixelColor color = tile.getColor(pixelX, pixelY);
-                m_frameBuffer.updatePixel(column * 8 + pixelX, row * 8 + pixelY, color);
+    constexpr int worldWidth  = 2 * Const::screenWidth;
+    constexpr int worldHeight = 2 * Const::screenHeight;
+
+    const auto patternTable = m_control.isBitSet(ControlRegisterFlag::BackgroundPatternTableAddr) ?
+                              Const::backgroundBankWhenSet : 0x0;
+    const bool nametableX   = m_control.isBitSet(ControlRegisterFlag::BaseNametable);
+
+    const auto worldY    = (scanline + m_frameScrollY + (m_frameNametableY ? Const::screenHeight : 0)) % worldHeight;
+    const auto tileRow   = (worldY % Const::screenHeight) / Const::tileDimension;
+    const auto fineY     = worldY % Const::tileDimension;
+    const auto scrolledX = m_scrollX + (nametableX ? Const::screenWidth : 0);
+    const auto fineX     = scrolledX % Const::tileDimension;
+
+    // One extra tile is fetched to cover the partially visible tile on the right edge when fine scrolling
+    for (auto tile = 0; tile <= Const::nametableColumns; tile++) {
+        const auto worldX    = (scrolledX - fineX + tile * Const::tileDimension) % worldWidth;
+        const auto nametable = (worldX / Const::screenWidth) + 2 * (worldY / Const::screenHeight);
+        const auto column    = (worldX % Const::screenWidth) / Const::tileDimension;
+
+        const Addr entryAddr = Const::PPUAddrRange::nametables.from + (nametable * Const::nametableSize) +
+                               (tileRow * Const::nametableColumns) + column;
+        const Byte tileNumber = m_nametables[normalizeNametableAddr(entryAddr)];
+        const Byte paletteId  = fetchBackgroundPaletteId(nametable, column, tileRow);
+        const auto pattern    = fetchPatternRow(patternTable, tileNumber, fineY);
+
+        for (auto pixelX = 0; pixelX < Const::tileDimension; pixelX++) {
+            const auto screenX = tile * Const::tileDimension + pixelX - fineX;
+            if (screenX < 0 || screenX >= Const::screenWidth || pattern[pixelX] == 0) {
+                continue;
             }
+
+            m_linePaletteIndexes[screenX] = paletteId * Const::colorIndexCount + pattern[pixelX];
         }
     }
+
+    if (!m_mask.isBitSet(MaskRegisterFlag::ShowBackgroundLeftmost)) {
+        std::fill_n(m_linePaletteIndexes.begin(), Const::leftmostColumns, 0);
+    }
 }
 
-void Nes::PPU::drawSprites() {
-    for (auto i = 0; i < m_oam.size(); i += 4) {
-        const auto entry    = createOAMEntry(i);
-        const auto palette  = createSpritePalette(entry.getPaletteId());
-        const auto tile     = createTile(ControlRegisterFlag::SpritePatternTableAddr, entry.getSpriteId(), palette);
+// Sprites earlier in OAM take priority, a sprite behind the background still hides later sprites
+void Nes::PPU::drawSpriteLine(int scanline) {
+    if (!m_mask.isBitSet(MaskRegisterFlag::ShowSprites)) {
+        return;
+    }
+
+    const auto spriteHeight = m_control.isBitSet(ControlRegisterFlag::SpriteSize) ?
+                              Const::largeSpriteHeight : Const::smallSpriteHeight;
+    const bool showLeftmost = m_mask.isBitSet(MaskRegisterFlag::ShowSpritesLeftmost);
 
-        for (auto pixelY = 0; pixelY < Const::tileDimension; pixelY++) {
-            for (auto pixelX = (Const::tileDimension - 1); pixelX >= 0; pixelX--) {
-                const Graphics::Position position = entry.getPosition(pixelX, pixelY);
+    std::array<bool, Const::screenWidth> spritePixelDrawn{false};
+    for (auto i = 0; i < Const::MemorySize::oam; i += Const::oamEntrySize) {
+        const auto entry = createOAMEntry(i);
+
+        auto spriteRow = scanline - entry.getY();
+        if (spriteRow < 0 || spriteRow >= spriteHeight) {
+            continue;
+        }
+
+        if (entry.isFlippedVertically()) {
+            spriteRow = spriteHeight - 1 - spriteRow;
+        }
+
+        Addr patternTable;
+        Byte tileNumber = entry.getSpriteId();
+        if (spriteHeight == Const::largeSpriteHeight) {
+            patternTable = (tileNumber & 0b1) ? Const::backgroundBankWhenSet : 0x0;
+            tileNumber   = (tileNumber & ~0b1) + (spriteRow / Const::tileDimension);
+            spriteRow   %= Const::tileDimension;
+        } else {
+            patternTable = m_control.isBitSet(ControlRegisterFlag::SpritePatternTableAddr) ? Const::backgroundBankWhenSet : 0x0;
+        }
 
-                if (tile.skipDrawingSpritePixel(pixelX, pixelY) || !m_frameBuffer.withinBounds(position.x, position.y)) {
-                    continue;
-                }
+        const auto pattern = fetchPatternRow(patternTable, tileNumber, spriteRow);
+        const auto paletteStart = Const::spritePaletteOffset + entry.getPaletteId() * Const::colorIndexCount;
 
-                const Graphics::PixelColor color = tile.getColor(pixelX, pixelY);
-                m_frameBuffer.updatePixel(position.x, position.y, color);
+        for (auto pixelX = 0; pixelX < Const::tileDimension; pixelX++) {
+            const auto screenX = entry.getX() + pixelX;
+            const auto colorId = pattern[entry.isFlippedHorizontally() ? Const::tileDimension - 1 - pixelX : pixelX];
+
+            if (screenX >= Const::screenWidth || colorId == 0 || spritePixelDrawn[screenX] ||
+                (!showLeftmost && screenX < Const::leftmostColumns))
+            {
+                continue;
+            }
+
+            spritePixelDrawn[screenX] = true;
+
+            const bool backgroundOpaque = m_linePaletteIndexes[screenX] != 0;
+            if (i == 0 && backgroundOpaque && screenX != Const::screenWidth - 1) {
+                m_status.setBit(StatusRegisterFlag::SpriteHitZero);
+            }
+
+            if (!(entry.isBehindBackground() && backgroundOpaque)) {
+                m_linePaletteIndexes[screenX] = paletteStart + colorId;
             }
         }
     }
 }
+
+void Nes::PPU::drawFrame() {
+    if (!m_drawEnabled) {
+        return;
+    }
+
+    m_drawCallback(*m_frameTarget);
+}
@@ -20,8 +20,10 @@
 #define CAIQUE_NES_PPU_HPP
 
 #include "Core/OAMEntry.hpp"
-#include "Core/Tile.hpp"
+#include "Core/Palette.hpp"
+#include "Core/PixelKernels.hpp"
 #include "Core/MMU.hpp"
+#include "Core/Scheduler.hpp"
 #include "Graphics/FrameBuffer.hpp"
 #include "Utils/BitIndexedValue.hpp"
 #include "Utils/Types.hpp"
@@ -55,25 +57,33 @@ namespace Nes {
         constexpr int largerVRamIncrement  = 32;
         constexpr int smallerVRamIncrement = 1;
 
-        constexpr int nametableSize      = 1024;
-        constexpr int attributeTableSize = 64;
+        constexpr int nametableSize        = 1024;
+        constexpr int attributeTableSize   = 64;
+        constexpr int attributeTableOffset = nametableSize - attributeTableSize;
+        constexpr int nametableColumns     = 32;
+        constexpr int nametableRows        = 30;
+        constexpr int attributeTableWidth  = 8;
+        constexpr int tilesPerAttribute    = 4;
+        constexpr Byte baseNametableMask   = 0b11;
+
+        constexpr int smallSpriteHeight = 8;
+        constexpr int largeSpriteHeight = 16;
+        constexpr int leftmostColumns   = 8;
 
         constexpr Addr backgroundBankWhenSet = 0x1000;
 
-        constexpr Addr spritePaletteOffset = 0x11;
+        constexpr Addr spritePaletteOffset = 0x10;
 
         namespace Scanline {
-            constexpr int vBlank = 241;
-            constexpr int final  = 262;
+            constexpr int vBlank    = 241;
+            constexpr int preRender = 261;
+            constexpr int final     = 262;
         }
 
         namespace PPUAddrRange {
             constexpr Utils::Range<Addr> chr        = {0x0000, 0x1FFF};
             constexpr Utils::Range<Addr> nametables = {0x2000, 0x2FFF};
             constexpr Utils::Range<Addr> palette    = {0x3F00, 0x3FFF};
-
-            // Note: when implementing other nametables createBackgroundPalette also need to be changed
-            constexpr Utils::Range<Addr> nametable0 = {0x0000, nametableSize};
         }
         namespace MemorySize {
             constexpr int palettes = 32;
@@ -133,11 +143,30 @@ namespace Nes {
 
     class PPU : Module {
     public:
-        PPU(MMU& mmu, DrawFunction drawCallback);
+        PPU(MMU& mmu, Scheduler& scheduler, DrawFunction drawCallback);
 
         bool nmiStatus();
 
+        // The PPU is not stepped along with the CPU, it catches up to the scheduler's clock once its state could be
+        // observed: on register access, when the next NMI is due or when the frame ends. Ticking only advances the
+        // clock and catches up if the scheduled catch-up point was passed, which drives the PPU without a CPU.
         void tick(CycleCount cpuCycleCount);
+        void synchronize();
+
+        // CPU cycles left until the final scanline of the current frame is reached, rounded up
+        CycleCount cpuCyclesUntilFrameEnd();
+
+        const FrameBuffer& frameBuffer() const;
+
+        // Renders into an externally owned frame buffer instead of the internal one, nullptr switches back. The target
+        // may be changed from within the draw callback to hand the finished frame over without copying it.
+        void setFrameTarget(FrameBuffer* target);
+
+        // With drawing disabled scanlines are only evaluated for sprite zero hits and the draw callback is skipped
+        void setDrawEnabled(bool enabled);
+
+        void saveState(Utils::StateWriter& writer) const;
+        void loadState(Utils::StateReader& reader);
 
         void handleOamDmaRequest(Byte addressUpperByte);
         void handlePPURegisterWrite(Addr addr, Byte value);
@@ -145,12 +174,18 @@ namespace Nes {
 
     private:
         MMU& m_mmu;
+        Scheduler& m_scheduler;
 
         DrawFunction m_drawCallback;
         FrameBuffer  m_frameBuffer{};
+        FrameBuffer* m_frameTarget = &m_frameBuffer;
+        bool m_drawEnabled = true;
 
         CycleCount m_cycles = Const::ppuInitialCycles;
         int m_scanline      = 0;
+
+        Timestamp m_syncedAt = 0;
+
         bool m_nmiStatus    = false;
 
         Byte m_lastReadBuffer = 0;
@@ -164,6 +199,10 @@ namespace Nes {
         Byte m_scrollX = 0;
         Byte m_scrollY = 0;
 
+        /* Scroll latched at the start of the frame, the horizontal scroll is sampled per scanline */
+        Byte m_frameScrollY    = 0;
+        bool m_frameNametableY = false;
+
         /* Register Helpers */
         bool m_scrollLatch = Const::DefaultValue::scrollLatch;
         bool m_addrLatch   = Const::DefaultValue::addrLatch;
@@ -173,35 +212,49 @@ namespace Nes {
         std::array<Byte, Const::MemorySize::oam>      m_oam{0};
         std::array<Byte, Const::MemorySize::vram>     m_nametables{0};
 
+        /* Scanline Buffers */
+        std::array<Byte, Const::screenWidth>                 m_linePaletteIndexes{0};
+        std::array<Graphics::PixelColor, Const::screenWidth> m_linePixels{0};
+
         void incrementAddrRegisterBasedOnControlRegister();
 
         /* Memory Helpers */
         Byte returnAndSwapBuffer(Byte value);
         Addr normaliseAddrRegister() const;
         Addr normalizePaletteAddr()  const;
-        Addr normalizeNametableAddr() const;
+        Addr normalizeNametableAddr(Addr addr) const;
         void writeToOam(Byte value);
         void write(Byte value);
         Byte read();
 
+        void raiseNmi();
+        void updateSyncDeadline();
+        CycleCount cpuCyclesUntilScanline(int scanline) const;
+
+        /* Scanline Counter Helpers */
+        bool doesA12Rise(int scanline) const;
+        std::optional<int> findIrqScanline() const;
+
         /* Scanline Handlers */
         void handleVBlankScanline();
         void handleFinalScanline();
 
         /* Graphics Helpers */
-        Palette createBackgroundPalette(Word column, Word row) const;
-        Palette createSpritePalette(Word paletteId) const;
-        Tile createTile(ControlRegisterFlag addrControlBit, Addr tileNumber, const Palette& palette) const;
+        const PatternRow& fetchPatternRow(Addr patternTable, Byte tileNumber, int fineY) const;
+        Byte fetchBackgroundPaletteId(int nametable, int column, int row) const;
         OAMEntry createOAMEntry(Addr startingAddr) const;
+        bool isSpriteZeroHitPossible(int scanline) const;
 
         /* Drawing Helpers */
+        void drawScanline(int scanline);
+        void drawBackgroundLine(int scanline);
+        void drawSpriteLine(int scanline);
         void drawFrame();
-        void drawBackground();
-        void drawSprites();
 
 #ifdef TESTING_ENVIRONMENT_NESTEST
         public:
-            std::pair<bool, std::string> matchesEntry(const NesTestUtils::Entry& state) const {
+            std::pair<bool, std::string> matchesEntry(const NesTestUtils::Entry& state) {
+            synchronize();
 
             if (state.ppuCycles != m_cycles) {
                return {false, "(PPU Cycles) Expected: " + std::to_string(state.ppuCycles) +
@@ -231,6 +284,7 @@ namespace Nes {
         };
 
         BitIndexedRegister<StatusRegisterFlag>& accesssStatus() {
+            synchronize();
             return m_status;
         }
 
@@ -43,11 +43,6 @@ static Graphics::PixelColor systemPalette[Nes::Const::systemPaletteSize] = {
     0xFF111111,
 };
 
-Nes::Palette::Palette(std::array<Byte, Const::colorIndexCount> indexes) :
-    m_colorIndexes(std::move(indexes))
-{
-}
-
-Graphics::PixelColor Nes::Palette::getColor(int id) const {
-    return systemPalette[m_colorIndexes[id]];
+Graphics::PixelColor Nes::getSystemColor(Byte colorIndex) {
+    return systemPalette[colorIndex % Const::systemPaletteSize];
 }
@@ -27,15 +27,7 @@ namespace Nes {
         constexpr int colorIndexCount   = 4;
     }
 
-    class Palette {
-    public:
-        explicit Palette(std::array<Byte, Const::colorIndexCount> indexes);
-
-        Graphics::PixelColor getColor(int id) const;
-
-    private:
-        std::array<Byte, Const::colorIndexCount> m_colorIndexes;
-    };
+    Graphics::PixelColor getSystemColor(Byte colorIndex);
 }
 
 #endif //CAIQUE_NES_PALETTE_HPP
@@ -0,0 +1,51 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <algorithm>
+#include "Core/PatternCache.hpp"
+#include "Core/PixelKernels.hpp"
+
+bool Nes::PatternCache::isTileDecoded(int tileIndex) const {
+    return m_decodedTiles[tileIndex];
+}
+
+const Nes::PatternRow& Nes::PatternCache::getRow(int tileIndex, int fineY) const {
+    return m_tiles[tileIndex][fineY];
+}
+
+void Nes::PatternCache::decodeTile(int tileIndex, const std::array<Byte, Const::tileSize>& bytes) {
+    auto& tile = m_tiles[tileIndex];
+
+    for (auto pixelY = 0; pixelY < Const::tileDimension; pixelY++) {
+        PixelKernels::decodePatternRow(bytes[pixelY], bytes[pixelY + Const::tileDimension], tile[pixelY]);
+    }
+
+    m_decodedTiles[tileIndex] = true;
+}
+
+void Nes::PatternCache::invalidateTile(int tileIndex) {
+    m_decodedTiles[tileIndex] = false;
+}
+
+void Nes::PatternCache::invalidateTiles(int firstTile, int count) {
+    std::fill_n(m_decodedTiles.begin() + firstTile, count, false);
+}
+
+void Nes::PatternCache::invalidate() {
+    m_decodedTiles.fill(false);
+}
@@ -0,0 +1,57 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#ifndef CAIQUE_NES_PATTERNCACHE_HPP
+#define CAIQUE_NES_PATTERNCACHE_HPP
+
+#include <array>
+#include "Utils/Types.hpp"
+
+namespace Nes {
+    namespace Const {
+        constexpr int tileSize      = 16;
+        constexpr int tileDimension = 8;
+
+        // Both pattern tables, 256 tiles each
+        constexpr int patternTileCount = 512;
+    }
+
+    // 2-bit color ids of a single tile row, leftmost pixel first
+    using PatternRow  = std::array<Byte, Const::tileDimension>;
+    using PatternTile = std::array<PatternRow, Const::tileDimension>;
+
+    // Tiles of the PPU pattern tables decoded from their bitplanes into one color id per pixel. Tiles are decoded
+    // lazily and have to be invalidated whenever the CHR data they were decoded from changes.
+    class PatternCache {
+    public:
+        bool isTileDecoded(int tileIndex) const;
+        const PatternRow& getRow(int tileIndex, int fineY) const;
+
+        void decodeTile(int tileIndex, const std::array<Byte, Const::tileSize>& bytes);
+
+        void invalidateTile(int tileIndex);
+        void invalidateTiles(int firstTile, int count);
+        void invalidate();
+
+    private:
+        std::array<PatternTile, Const::patternTileCount> m_tiles{};
+        std::array<bool, Const::patternTileCount>        m_decodedTiles{false};
+    };
+}
+
+#endif //CAIQUE_NES_PATTERNCACHE_HPP
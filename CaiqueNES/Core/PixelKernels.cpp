@@ -0,0 +1,79 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include "Core/PixelKernels.hpp"
+#include "Utils/Data.hpp"
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+void Nes::PixelKernels::Scalar::decodePatternRow(Byte lowerPlane, Byte upperPlane, PatternRow& row) {
+    for (auto pixelX = 0; pixelX < Const::tileDimension; pixelX++) {
+        const auto bit = Const::tileDimension - 1 - pixelX;
+        row[pixelX] = Utils::combineBits(Utils::isBitSet(upperPlane, bit), Utils::isBitSet(lowerPlane, bit));
+    }
+}
+
+void Nes::PixelKernels::Scalar::resolveColors(const Byte* paletteIndexes, const PaletteColors& colors,
+                                              Graphics::PixelColor* output, int count)
+{
+    for (auto i = 0; i < count; i++) {
+        output[i] = colors[paletteIndexes[i] % Const::paletteColorCount];
+    }
+}
+
+void Nes::PixelKernels::decodePatternRow(Byte lowerPlane, Byte upperPlane, PatternRow& row) {
+#if defined(__SSE2__)
+    // Every byte lane tests one bit of the plane, leftmost pixel being the most significant bit
+    const __m128i pixelBits = _mm_setr_epi8(static_cast<char>(0x80), 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+                                            0, 0, 0, 0, 0, 0, 0, 0);
+
+    const __m128i lower = _mm_and_si128(_mm_set1_epi8(static_cast<char>(lowerPlane)), pixelBits);
+    const __m128i upper = _mm_and_si128(_mm_set1_epi8(static_cast<char>(upperPlane)), pixelBits);
+
+    const __m128i lowerSet = _mm_and_si128(_mm_cmpeq_epi8(lower, pixelBits), _mm_set1_epi8(0b01));
+    const __m128i upperSet = _mm_and_si128(_mm_cmpeq_epi8(upper, pixelBits), _mm_set1_epi8(0b10));
+
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(row.data()), _mm_or_si128(lowerSet, upperSet));
+#else
+    Scalar::decodePatternRow(lowerPlane, upperPlane, row);
+#endif
+}
+
+void Nes::PixelKernels::resolveColors(const Byte* paletteIndexes, const PaletteColors& colors,
+                                      Graphics::PixelColor* output, int count)
+{
+    auto i = 0;
+
+#if defined(__AVX2__)
+    // SSE2 has no gather, so only AVX2 builds get a vectorized lookup
+    constexpr int lanes = 8;
+    const __m256i indexMask = _mm256_set1_epi32(Const::paletteColorCount - 1);
+    const auto* table = reinterpret_cast<const int*>(colors.data());
+
+    for (; i + lanes <= count; i += lanes) {
+        const __m128i packedIndexes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(paletteIndexes + i));
+        const __m256i indexes = _mm256_and_si256(_mm256_cvtepu8_epi32(packedIndexes), indexMask);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), _mm256_i32gather_epi32(table, indexes, 4));
+    }
+#endif
+
+    Scalar::resolveColors(paletteIndexes + i, colors, output + i, count - i);
+}
@@ -0,0 +1,51 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#ifndef CAIQUE_NES_PIXELKERNELS_HPP
+#define CAIQUE_NES_PIXELKERNELS_HPP
+
+#include <array>
+#include "Core/PatternCache.hpp"
+#include "Utils/Types.hpp"
+
+namespace Nes {
+    namespace Const {
+        constexpr int paletteColorCount = 32;
+    }
+
+    using PaletteColors = std::array<Graphics::PixelColor, Const::paletteColorCount>;
+
+    // Pixel loops of the PPU. The vectorized variants are selected at compile time (SSE2 / AVX2) and have to produce
+    // exactly the same output as the scalar ones.
+    namespace PixelKernels {
+        // Expands the two bitplanes of a tile row into 8 color ids, leftmost pixel first
+        void decodePatternRow(Byte lowerPlane, Byte upperPlane, PatternRow& row);
+
+        // Resolves palette RAM indexes (0 - 31) into colors
+        void resolveColors(const Byte* paletteIndexes, const PaletteColors& colors, Graphics::PixelColor* output,
+                           int count);
+
+        namespace Scalar {
+            void decodePatternRow(Byte lowerPlane, Byte upperPlane, PatternRow& row);
+            void resolveColors(const Byte* paletteIndexes, const PaletteColors& colors, Graphics::PixelColor* output,
+                               int count);
+        }
+    }
+}
+
+#endif //CAIQUE_NES_PIXELKERNELS_HPP
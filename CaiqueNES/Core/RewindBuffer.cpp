@@ -0,0 +1,129 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <algorithm>
+#include "Core/RewindBuffer.hpp"
+#include "Utils/DeltaCodec.hpp"
+
+Nes::RewindBuffer::RewindBuffer(std::size_t frameCapacity, int keyframeInterval) :
+    m_frames(std::max<std::size_t>(frameCapacity, 1)),
+    m_keyframeInterval(std::max(keyframeInterval, 1))
+{
+}
+
+void Nes::RewindBuffer::capture(const VirtualMachine& virtualMachine) {
+    virtualMachine.saveState(m_snapshot);
+
+    if (m_count == m_frames.size()) {
+        dropOldest();
+    }
+
+    const auto slot = slotAt(m_count);
+    auto& frame = m_frames[slot];
+
+    if (shouldCaptureKeyframe()) {
+        frame.data.assign(m_snapshot.begin(), m_snapshot.end());
+        frame.keyframeSlot     = slot;
+        frame.keyframeDistance = 0;
+    } else {
+        const auto& previous = m_frames[slotAt(m_count - 1)];
+        Utils::encodeDelta(m_frames[previous.keyframeSlot].data, m_snapshot, frame.data);
+        frame.keyframeSlot     = previous.keyframeSlot;
+        frame.keyframeDistance = previous.keyframeDistance + 1;
+    }
+
+    m_count++;
+}
+
+bool Nes::RewindBuffer::rewind(VirtualMachine& virtualMachine) {
+    if (m_count == 0) {
+        return false;
+    }
+
+    const auto& frame = m_frames[slotAt(m_count - 1)];
+    std::span<const Byte> snapshot = frame.data;
+
+    if (frame.keyframeDistance != 0) {
+        const auto& keyframe = m_frames[frame.keyframeSlot].data;
+        m_restored.resize(keyframe.size());
+        if (!Utils::decodeDelta(keyframe, frame.data, m_restored)) {
+            clear();
+            return false;
+        }
+
+        snapshot = m_restored;
+    }
+
+    // A failed restore means the snapshots belong to a ROM which is no longer loaded
+    if (!virtualMachine.loadState(snapshot).has_value()) {
+        clear();
+        return false;
+    }
+
+    m_count--;
+
+    return true;
+}
+
+void Nes::RewindBuffer::clear() {
+    m_oldest = 0;
+    m_count  = 0;
+}
+
+std::size_t Nes::RewindBuffer::size() const {
+    return m_count;
+}
+
+std::size_t Nes::RewindBuffer::capacity() const {
+    return m_frames.size();
+}
+
+std::size_t Nes::RewindBuffer::memoryUsage() const {
+    auto usage = m_snapshot.capacity() + m_restored.capacity();
+    for (const auto& frame : m_frames) {
+        usage += frame.data.capacity();
+    }
+
+    return usage;
+}
+
+std::size_t Nes::RewindBuffer::slotAt(std::size_t position) const {
+    return (m_oldest + position) % m_frames.size();
+}
+
+bool Nes::RewindBuffer::shouldCaptureKeyframe() const {
+    if (m_count == 0) {
+        return true;
+    }
+
+    const auto& newest = m_frames[slotAt(m_count - 1)];
+    if (newest.keyframeDistance + 1 >= m_keyframeInterval) {
+        return true;
+    }
+
+    // Deltas need a keyframe of the same layout, which changes when another ROM gets loaded
+    return m_frames[newest.keyframeSlot].data.size() != m_snapshot.size();
+}
+
+// Frames following a dropped keyframe can't be decoded anymore, so they go with it
+void Nes::RewindBuffer::dropOldest() {
+    do {
+        m_oldest = slotAt(1);
+        m_count--;
+    } while (m_count > 0 && m_frames[m_oldest].keyframeDistance != 0);
+}
@@ -0,0 +1,74 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#ifndef CAIQUE_NES_REWINDBUFFER_HPP
+#define CAIQUE_NES_REWINDBUFFER_HPP
+
+#include <cstddef>
+#include <vector>
+#include "Core/VirtualMachine.hpp"
+
+namespace Nes {
+    namespace Const::Rewind {
+        constexpr int defaultSeconds   = 60;
+        constexpr int keyframeInterval = 60;
+    }
+
+    // Fixed-size ring of per-frame snapshots. Every keyframeInterval frames the full snapshot is kept, the frames in
+    // between are stored as XOR/RLE deltas against that keyframe. Once full, the oldest frames are dropped together
+    // with their keyframe.
+    class RewindBuffer {
+    public:
+        explicit RewindBuffer(std::size_t frameCapacity = Const::Rewind::defaultSeconds * Const::frameRate,
+                              int keyframeInterval = Const::Rewind::keyframeInterval);
+
+        void capture(const VirtualMachine& virtualMachine);
+
+        // Restores the most recently captured frame and forgets it, false when there is nothing left to rewind
+        bool rewind(VirtualMachine& virtualMachine);
+
+        void clear();
+
+        std::size_t size() const;
+        std::size_t capacity() const;
+        std::size_t memoryUsage() const;
+
+    private:
+        struct Frame {
+            std::vector<Byte> data{};
+            std::size_t keyframeSlot = 0;
+            int keyframeDistance     = 0;
+        };
+
+        std::vector<Frame> m_frames;
+        int m_keyframeInterval;
+
+        std::size_t m_oldest = 0;
+        std::size_t m_count  = 0;
+
+        /* Scratch buffers, reused between frames */
+        std::vector<Byte> m_snapshot{};
+        std::vector<Byte> m_restored{};
+
+        std::size_t slotAt(std::size_t position) const;
+        bool shouldCaptureKeyframe() const;
+        void dropOldest();
+    };
+}
+
+#endif //CAIQUE_NES_REWINDBUFFER_HPP
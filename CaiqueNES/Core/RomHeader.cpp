@@ -0,0 +1,181 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include "Core/BaseMapper.hpp"
+#include "Core/RomHeader.hpp"
+#include "Utils/Checksum.hpp"
+
+namespace {
+    // Bytes 4 and 5 hold the low byte of the size, NES 2.0 adds a nibble of byte 9 on top or switches to
+    // 2^exponent * (multiplier * 2 + 1) bytes
+    std::optional<std::size_t> decodeRomSize(Nes::Byte lowByte, Nes::Byte upperNibble, std::size_t unit) {
+        if (upperNibble != Nes::Const::Nes2::exponentNotation) {
+            return ((static_cast<std::size_t>(upperNibble) << 8) | lowByte) * unit;
+        }
+
+        const auto exponent   = lowByte >> 2;
+        const auto multiplier = (lowByte & 0x03) * 2 + 1;
+
+        // No file comes close, the size only has to stay representable
+        if (exponent >= 48) {
+            return std::nullopt;
+        }
+
+        return (std::size_t{1} << exponent) * multiplier;
+    }
+
+    std::size_t decodeRamSize(Nes::Byte shift) {
+        return shift == 0 ? 0 : Nes::Const::Nes2::ramSizeBase << shift;
+    }
+}
+
+const char* Nes::describeRomHeaderError(RomHeaderError error) {
+    switch (error) {
+        case RomHeaderError::TooSmall:          return "File is too small to contain a header";
+        case RomHeaderError::BadConstant:       return "Header constant check failed";
+        case RomHeaderError::Truncated:         return "File is smaller than the sections in its header";
+        case RomHeaderError::UnsupportedMapper: return "Mapper is not supported";
+        case RomHeaderError::UnsupportedSizes:  return "Mapper does not accept the ROM's sizes";
+        default:                                return "Unknown header error";
+    }
+}
+
+std::expected<Nes::RomHeader, Nes::RomHeaderError> Nes::RomHeader::parse(std::span<const Byte> fileBytes) {
+    if (fileBytes.size() < static_cast<std::size_t>(Const::headerSize)) {
+        return std::unexpected(RomHeaderError::TooSmall);
+    }
+
+    for (std::size_t i = Const::AddressOf::headerConstant; i < std::strlen(Const::headerConstant); i++) {
+        if (fileBytes[i] != Const::headerConstant[i]) {
+            return std::unexpected(RomHeaderError::BadConstant);
+        }
+    }
+
+    RomHeader header;
+
+    const Byte flag6 = fileBytes[Const::AddressOf::flag6];
+    const Byte flag7 = fileBytes[Const::AddressOf::flag7];
+    const Byte flag8 = fileBytes[Const::AddressOf::flag8];
+    const Byte flag9 = fileBytes[Const::AddressOf::flag9];
+
+    if (Utils::isBitSet(flag6, Const::BitIndex::Flag6::fourScreen)) {
+        header.mirroring = Mirroring::FourScreen;
+    } else {
+        header.mirroring = static_cast<Mirroring>(Utils::isBitSet(flag6, Const::BitIndex::Flag6::mirroring));
+    }
+
+    header.hasBattery = Utils::isBitSet(flag6, Const::BitIndex::Flag6::battery);
+    header.hasTrainer = Utils::isBitSet(flag6, Const::BitIndex::Flag6::hasTrainer);
+
+    const auto ines2Bits = Utils::combineBits(Utils::isBitSet(flag7, Const::BitIndex::Flag7::ines2SecondBit),
+                                              Utils::isBitSet(flag7, Const::BitIndex::Flag7::ines2FirstBit));
+    header.isNes2 = ines2Bits == Const::ines2Value;
+
+    header.mapperId = (flag7 & 0xF0) | (flag6 >> 4);
+
+    if (header.isNes2) {
+        header.mapperId |= (flag8 & 0x0F) << 8;
+        header.submapper = flag8 >> 4;
+
+        const auto prgRomSize = decodeRomSize(fileBytes[Const::AddressOf::sizeOfPRG], flag9 & 0x0F,
+                                              Utils::kilobytesToBytes(Const::prgSizeMultiplier));
+        const auto chrRomSize = decodeRomSize(fileBytes[Const::AddressOf::sizeOfCHR], flag9 >> 4,
+                                              Utils::kilobytesToBytes(Const::chrSizeMultiplier));
+        if (!prgRomSize.has_value() || !chrRomSize.has_value()) {
+            return std::unexpected(RomHeaderError::Truncated);
+        }
+
+        header.prgRomSize = prgRomSize.value();
+        header.chrRomSize = chrRomSize.value();
+
+        const Byte flag10 = fileBytes[Const::AddressOf::flag10];
+        const Byte flag11 = fileBytes[Const::AddressOf::flag11];
+        header.prgRamSize   = decodeRamSize(flag10 & 0x0F);
+        header.prgNvRamSize = decodeRamSize(flag10 >> 4);
+        header.chrRamSize   = decodeRamSize(flag11 & 0x0F);
+        header.chrNvRamSize = decodeRamSize(flag11 >> 4);
+
+        header.tvSystem = static_cast<TVSystem>(fileBytes[Const::AddressOf::flag12] & Const::Nes2::timingMask);
+    } else {
+        const auto garbage = fileBytes.subspan(Const::archaicGarbageFrom, Const::headerSize - Const::archaicGarbageFrom);
+        if (std::ranges::any_of(garbage, [](Byte value) { return value != 0; })) {
+            header.mapperId &= 0x0F;
+        }
+
+        header.prgRomSize = Utils::kilobytesToBytes(fileBytes[Const::AddressOf::sizeOfPRG] * Const::prgSizeMultiplier);
+        header.chrRomSize = Utils::kilobytesToBytes(fileBytes[Const::AddressOf::sizeOfCHR] * Const::chrSizeMultiplier);
+
+        // Battery backed PRG RAM is what iNES 1.0 calls save RAM, the size byte never says which kind it is
+        const auto prgRamSize = flag8 == 0 ? Const::prgRamUnit : flag8 * Const::prgRamUnit;
+        if (header.hasBattery) {
+            header.prgNvRamSize = prgRamSize;
+        } else {
+            header.prgRamSize = prgRamSize;
+        }
+
+        header.chrRamSize = header.chrRomSize == 0 ? Utils::kilobytesToBytes(8) : 0;
+        header.tvSystem   = static_cast<TVSystem>(Utils::isBitSet(flag9, Const::BitIndex::Flag9::tvSystem));
+    }
+
+    if (fileBytes.size() - Const::headerSize < header.romSectionsSize()) {
+        return std::unexpected(RomHeaderError::Truncated);
+    }
+
+    return header;
+}
+
+std::span<const Nes::Byte> Nes::RomHeader::trainer(std::span<const Byte> fileBytes) const {
+    return romSections(fileBytes).first(hasTrainer ? Const::trainerSize : 0);
+}
+
+std::span<const Nes::Byte> Nes::RomHeader::prgRom(std::span<const Byte> fileBytes) const {
+    return romSections(fileBytes).subspan(hasTrainer ? Const::trainerSize : 0, prgRomSize);
+}
+
+std::span<const Nes::Byte> Nes::RomHeader::chrRom(std::span<const Byte> fileBytes) const {
+    return romSections(fileBytes).subspan((hasTrainer ? Const::trainerSize : 0) + prgRomSize, chrRomSize);
+}
+
+std::span<const Nes::Byte> Nes::RomHeader::romSections(std::span<const Byte> fileBytes) const {
+    return fileBytes.subspan(Const::headerSize, romSectionsSize());
+}
+
+std::size_t Nes::RomHeader::romSectionsSize() const {
+    return (hasTrainer ? Const::trainerSize : 0) + prgRomSize + chrRomSize;
+}
+
+std::uint32_t Nes::RomHeader::checksum(std::span<const Byte> fileBytes) const {
+    const auto prg = prgRom(fileBytes);
+    const auto chr = chrRom(fileBytes);
+
+    return Utils::crc32(chr.data(), chr.size(), Utils::crc32(prg.data(), prg.size()));
+}
+
+std::expected<void, Nes::RomHeaderError> Nes::RomHeader::checkSupported() const {
+    if (!BaseMapper::isImplemented(mapperId)) {
+        return std::unexpected(RomHeaderError::UnsupportedMapper);
+    }
+
+    if (!BaseMapper::isSupported(mapperId, prgRomSize, chrRomSize)) {
+        return std::unexpected(RomHeaderError::UnsupportedSizes);
+    }
+
+    return {};
+}
@@ -0,0 +1,152 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#ifndef CAIQUE_NES_ROMHEADER_HPP
+#define CAIQUE_NES_ROMHEADER_HPP
+
+#include <cstdint>
+#include <expected>
+#include <optional>
+#include <span>
+#include "Utils/Data.hpp"
+#include "Utils/Types.hpp"
+
+namespace Nes {
+    namespace Const {
+        constexpr const char* headerConstant = "NES";
+        constexpr int headerSize             = 16;
+        constexpr int prgSizeMultiplier      = 16;
+        constexpr int chrSizeMultiplier      = 8;
+        constexpr int ines2Value             = 0x2;
+        constexpr int trainerSize            = 512;
+        constexpr Addr trainerAddr           = 0x7000;
+
+        // iNES headers from old dumping tools carry garbage past byte 11, their mapper upper nibble cannot be trusted
+        constexpr int archaicGarbageFrom = 12;
+
+        namespace AddressOf {
+            constexpr Addr headerConstant = 0x0;
+            constexpr Addr sizeOfPRG      = 0x4;
+            constexpr Addr sizeOfCHR      = 0x5;
+            constexpr Addr flag6          = 0x6;
+            constexpr Addr flag7          = 0x7;
+            constexpr Addr flag8          = 0x8;
+            constexpr Addr flag9          = 0x9;
+            constexpr Addr flag10         = 0xA;
+            constexpr Addr flag11         = 0xB;
+            constexpr Addr flag12         = 0xC;
+        }
+
+        namespace BitIndex {
+            namespace Flag6 {
+                constexpr int mirroring  = 0;
+                constexpr int battery    = 1;
+                constexpr int hasTrainer = 2;
+                constexpr int fourScreen = 3;
+            }
+
+            namespace Flag7 {
+                constexpr int ines2FirstBit  = 2;
+                constexpr int ines2SecondBit = 3;
+            }
+
+            namespace Flag9 {
+                constexpr int tvSystem = 0;
+            }
+        }
+
+        namespace Nes2 {
+            // Size nibbles of this value switch the size byte to the exponent-multiplier notation
+            constexpr int exponentNotation = 0xF;
+
+            // RAM sizes are given as shift counts of 64 bytes, zero meaning no RAM
+            constexpr std::size_t ramSizeBase = 64;
+
+            constexpr int timingMask = 0x03;
+        }
+
+        // iNES 1.0 headers give PRG RAM in 8 KB units, with zero still meaning 8 KB for compatibility
+        constexpr std::size_t prgRamUnit = Utils::kilobytesToBytes(8);
+    }
+
+    enum class Mirroring {
+        Horizontal,
+        Vertical,
+        FourScreen,
+        SingleScreenLower,
+        SingleScreenUpper
+    };
+
+    enum class TVSystem {
+        NTSC,
+        PAL,
+        MultiRegion,
+        Dendy
+    };
+
+    enum class RomHeaderError {
+        TooSmall,
+        BadConstant,
+        Truncated,
+        UnsupportedMapper,
+        UnsupportedSizes
+    };
+
+    // Errors are plain values so that scanning whole ROM libraries does not allocate for every rejected file
+    const char* describeRomHeaderError(RomHeaderError error);
+
+    // Fields of an iNES or NES 2.0 header, read straight out of the file bytes. The sections are located in the
+    // same bytes again through the accessors, nothing is copied.
+    struct RomHeader {
+        static std::expected<RomHeader, RomHeaderError> parse(std::span<const Byte> fileBytes);
+
+        bool isNes2 = false;
+
+        std::uint16_t mapperId  = 0;
+        Byte          submapper = 0;
+
+        Mirroring mirroring  = Mirroring::Horizontal;
+        TVSystem  tvSystem   = TVSystem::NTSC;
+        bool      hasBattery = false;
+        bool      hasTrainer = false;
+
+        // All sizes in bytes
+        std::size_t prgRomSize   = 0;
+        std::size_t chrRomSize   = 0;
+        std::size_t prgRamSize   = 0;
+        std::size_t prgNvRamSize = 0;
+        std::size_t chrRamSize   = 0;
+        std::size_t chrNvRamSize = 0;
+
+        std::span<const Byte> trainer(std::span<const Byte> fileBytes) const;
+        std::span<const Byte> prgRom(std::span<const Byte> fileBytes) const;
+        std::span<const Byte> chrRom(std::span<const Byte> fileBytes) const;
+
+        // Trainer, PRG ROM and CHR ROM, which follow each other in the file
+        std::span<const Byte> romSections(std::span<const Byte> fileBytes) const;
+        std::size_t romSectionsSize() const;
+
+        // CRC-32 of PRG ROM followed by CHR ROM, the key ROM databases and the index know a dump by
+        std::uint32_t checksum(std::span<const Byte> fileBytes) const;
+
+        // Whether a supported mapper accepts the ROM's sizes, which is what makes it runnable
+        std::expected<void, RomHeaderError> checkSupported() const;
+    };
+}
+
+#endif //CAIQUE_NES_ROMHEADER_HPP
@@ -0,0 +1,128 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <algorithm>
+#include <vector>
+#include "Core/RomHeader.hpp"
+#include "Core/RomImage.hpp"
+
+Nes::RomImage::RomImage(Utils::MappedFile file) :
+    m_file(std::move(file))
+{
+    const auto header = RomHeader::parse(m_file.bytes());
+    if (header.has_value()) {
+        m_checksum = header->checksum(m_file.bytes());
+    }
+}
+
+std::span<const Nes::Byte> Nes::RomImage::bytes() const {
+    return m_file.bytes();
+}
+
+std::optional<std::uint32_t> Nes::RomImage::checksum() const {
+    return m_checksum;
+}
+
+Nes::RomImageCache& Nes::RomImageCache::global() {
+    static RomImageCache cache;
+    return cache;
+}
+
+std::expected<std::shared_ptr<const Nes::RomImage>, Utils::ErrorString>
+Nes::RomImageCache::load(const std::string& path) {
+    const auto fileKey = makeFileKey(path);
+    if (fileKey.has_value()) {
+        std::lock_guard lock(m_mutex);
+
+        // The entry outlives its image until the next prune, an expired one is just a miss
+        if (const auto found = m_images.find(fileKey.value()); found != m_images.end()) {
+            if (auto image = found->second.lock()) {
+                return image;
+            }
+        }
+    }
+
+    auto fileOpenResult = Utils::MappedFile::open(path);
+    if (!fileOpenResult.has_value()) {
+        return std::unexpected(fileOpenResult.error());
+    }
+
+    // Reading the file happens outside the lock, other VMs keep loading the ROMs they already have
+    auto image = std::make_shared<const RomImage>(std::move(fileOpenResult.value()));
+
+    std::lock_guard lock(m_mutex);
+
+    // Dead entries are only pruned here, on the rare occasion a new ROM gets loaded
+    std::erase_if(m_images, [](const auto& entry) { return entry.second.expired(); });
+
+    // Same checksum is only a candidate, a collision costs the sharing and nothing else
+    for (const auto& [otherKey, otherImage] : m_images) {
+        auto other = otherImage.lock();
+        if (other == nullptr || other->checksum() != image->checksum()) {
+            continue;
+        }
+
+        if (std::ranges::equal(other->bytes(), image->bytes())) {
+            image = std::move(other);
+            break;
+        }
+    }
+
+    if (fileKey.has_value()) {
+        m_images.insert_or_assign(fileKey.value(), image);
+    }
+
+    return image;
+}
+
+std::size_t Nes::RomImageCache::size() const {
+    std::lock_guard lock(m_mutex);
+
+    // Copies of a file share an image and are counted once
+    std::vector<const RomImage*> images;
+    for (const auto& [key, image] : m_images) {
+        if (const auto alive = image.lock()) {
+            images.push_back(alive.get());
+        }
+    }
+
+    std::ranges::sort(images);
+    return std::ranges::distance(images.begin(), std::ranges::unique(images).begin());
+}
+
+std::optional<Nes::RomImageCache::FileKey> Nes::RomImageCache::makeFileKey(const std::string& path) {
+    std::error_code error;
+
+    FileKey key;
+    key.path = std::filesystem::absolute(path, error).string();
+    if (error) {
+        return std::nullopt;
+    }
+
+    key.size = std::filesystem::file_size(path, error);
+    if (error) {
+        return std::nullopt;
+    }
+
+    key.modified = std::filesystem::last_write_time(path, error).time_since_epoch().count();
+    if (error) {
+        return std::nullopt;
+    }
+
+    return key;
+}
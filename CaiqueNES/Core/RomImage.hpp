@@ -0,0 +1,82 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#ifndef CAIQUE_NES_ROMIMAGE_HPP
+#define CAIQUE_NES_ROMIMAGE_HPP
+
+#include <compare>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include "Utils/MappedFile.hpp"
+#include "Utils/Types.hpp"
+
+namespace Nes {
+    // Contents of a ROM file as mapped from disk, never written to. Cartridges slice their PRG and CHR ROM out of it.
+    class RomImage {
+    public:
+        explicit RomImage(Utils::MappedFile file);
+
+        std::span<const Byte> bytes() const;
+
+        // RomHeader::checksum of the file, computed once when the image is created so that cartridges sharing it do
+        // not read the whole ROM again. Empty when the file has no valid header.
+        std::optional<std::uint32_t> checksum() const;
+
+    private:
+        Utils::MappedFile            m_file;
+        std::optional<std::uint32_t> m_checksum;
+    };
+
+    // Hands out one image per distinct file content, so that every VM in the process running the same game shares
+    // the same pages. Images are only held weakly and go away with the last cartridge using them.
+    //
+    // Files seen before are recognized by path, size and modification time without reading them. Only new files are
+    // read, and share the image of another file with the same content, such as a copy of the ROM.
+    class RomImageCache {
+    public:
+        static RomImageCache& global();
+
+        std::expected<std::shared_ptr<const RomImage>, Utils::ErrorString> load(const std::string& path);
+
+        // Number of images still in use
+        std::size_t size() const;
+
+    private:
+        struct FileKey {
+            std::string    path;
+            std::uintmax_t size     = 0;
+            std::filesystem::file_time_type::rep modified = 0;
+
+            auto operator<=>(const FileKey&) const = default;
+        };
+
+        mutable std::mutex m_mutex;
+        std::map<FileKey, std::weak_ptr<const RomImage>> m_images;
+
+        static std::optional<FileKey> makeFileKey(const std::string& path);
+    };
+}
+
+#endif //CAIQUE_NES_ROMIMAGE_HPP
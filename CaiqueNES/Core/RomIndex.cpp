@@ -0,0 +1,153 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <algorithm>
+#include <fstream>
+#include "Core/RomIndex.hpp"
+#include "Utils/StateStream.hpp"
+
+bool Nes::RomIndexEntry::isRunnable() const {
+    return (flags & RomIndexFlag::runnable) != 0;
+}
+
+bool Nes::RomIndexEntry::isCorrected() const {
+    return (flags & RomIndexFlag::corrected) != 0;
+}
+
+std::expected<Nes::RomIndex, Utils::ErrorString> Nes::RomIndex::loadFromFilesystem(const std::string& path) {
+    auto fileOpenResult = Utils::MappedFile::open(path);
+    if (!fileOpenResult.has_value()) {
+        return std::unexpected(fileOpenResult.error());
+    }
+
+    RomIndex index(std::move(fileOpenResult.value()));
+
+    const auto bytes = index.m_file.bytes();
+    Utils::StateReader reader(bytes);
+    if (reader.read<std::uint32_t>() != Const::RomIndex::magic) {
+        return std::unexpected("Not a ROM index: " + path);
+    }
+
+    if (reader.read<std::uint16_t>() != Const::RomIndex::version) {
+        return std::unexpected("Unsupported ROM index version: " + path);
+    }
+
+    index.m_size = reader.read<std::uint32_t>();
+
+    const auto entriesSize = index.m_size * Const::RomIndex::entrySize;
+    if (reader.failed() || bytes.size() - Const::RomIndex::headerSize < entriesSize) {
+        return std::unexpected("ROM index is truncated: " + path);
+    }
+
+    index.m_entries = bytes.subspan(Const::RomIndex::headerSize, entriesSize);
+    index.m_paths   = bytes.subspan(Const::RomIndex::headerSize + entriesSize);
+
+    return index;
+}
+
+std::expected<void, Utils::ErrorString> Nes::RomIndex::writeToFilesystem(const std::string& path,
+                                                                         std::vector<RomIndexEntry> entries)
+{
+    // The same dump found twice only needs one entry, the first path wins
+    std::ranges::stable_sort(entries, {}, &RomIndexEntry::checksum);
+    const auto duplicates = std::ranges::unique(entries, {}, &RomIndexEntry::checksum);
+    entries.erase(duplicates.begin(), duplicates.end());
+
+    std::vector<Byte> buffer;
+    Utils::StateWriter writer(buffer);
+    writer.write(Const::RomIndex::magic);
+    writer.write(Const::RomIndex::version);
+    writer.write(static_cast<std::uint32_t>(entries.size()));
+
+    std::uint32_t pathOffset = 0;
+    for (const auto& entry : entries) {
+        writer.write(entry.checksum);
+        writer.writeBytes(entry.sha1);
+        writer.write(entry.mapperId);
+        writer.write(entry.submapper);
+        writer.write(static_cast<Byte>(entry.mirroring));
+        writer.write(entry.flags);
+        writer.write(pathOffset);
+        writer.write(static_cast<std::uint32_t>(entry.path.size()));
+
+        pathOffset += entry.path.size();
+    }
+
+    for (const auto& entry : entries) {
+        writer.writeBytes({reinterpret_cast<const Byte*>(entry.path.data()), entry.path.size()});
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()))) {
+        return std::unexpected("unable to write ROM index to: " + path);
+    }
+
+    return {};
+}
+
+std::size_t Nes::RomIndex::size() const {
+    return m_size;
+}
+
+Nes::RomIndexEntry Nes::RomIndex::entryAt(std::size_t index) const {
+    Utils::StateReader reader(m_entries.subspan(index * Const::RomIndex::entrySize, Const::RomIndex::entrySize));
+
+    RomIndexEntry entry;
+    entry.checksum = reader.read<std::uint32_t>();
+    reader.readBytes(entry.sha1);
+    entry.mapperId  = reader.read<std::uint16_t>();
+    entry.submapper = reader.read<Byte>();
+
+    const auto mirroring = reader.read<Byte>();
+    entry.mirroring = static_cast<Mirroring>(std::min<Byte>(mirroring, static_cast<Byte>(Mirroring::SingleScreenUpper)));
+    entry.flags     = reader.read<Byte>();
+
+    // Paths outside the table are left empty, a damaged index must not be able to point anywhere
+    const auto pathOffset = reader.read<std::uint32_t>();
+    const auto pathLength = reader.read<std::uint32_t>();
+    if (pathOffset <= m_paths.size() && pathLength <= m_paths.size() - pathOffset) {
+        entry.path = {reinterpret_cast<const char*>(m_paths.data()) + pathOffset, pathLength};
+    }
+
+    return entry;
+}
+
+std::optional<Nes::RomIndexEntry> Nes::RomIndex::find(std::uint32_t checksum) const {
+    std::size_t low  = 0;
+    std::size_t high = m_size;
+    while (low < high) {
+        const auto middle = low + (high - low) / 2;
+        const auto entry  = entryAt(middle);
+        if (entry.checksum == checksum) {
+            return entry;
+        }
+
+        if (entry.checksum < checksum) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    return std::nullopt;
+}
+
+Nes::RomIndex::RomIndex(Utils::MappedFile file) :
+    m_file(std::move(file))
+{
+}
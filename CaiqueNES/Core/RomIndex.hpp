@@ -0,0 +1,91 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#ifndef CAIQUE_NES_ROMINDEX_HPP
+#define CAIQUE_NES_ROMINDEX_HPP
+
+#include <cstdint>
+#include <expected>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Core/RomHeader.hpp"
+#include "Utils/Checksum.hpp"
+#include "Utils/MappedFile.hpp"
+#include "Utils/Types.hpp"
+
+namespace Nes {
+    namespace Const::RomIndex {
+        constexpr std::uint32_t magic   = 0x58494E43; // "CNIX"
+        constexpr std::uint16_t version = 1;
+
+        constexpr std::size_t headerSize = sizeof(magic) + sizeof(version) + sizeof(std::uint32_t);
+
+        // checksum, SHA-1, mapper, submapper, mirroring, flags, path offset and length
+        constexpr std::size_t entrySize = 4 + 20 + 2 + 1 + 1 + 1 + 4 + 4;
+    }
+
+    namespace RomIndexFlag {
+        constexpr Byte runnable  = 1 << 0;
+        constexpr Byte corrected = 1 << 1;
+    }
+
+    struct RomIndexEntry {
+        // RomHeader::checksum of the dump, entries are sorted by it
+        std::uint32_t    checksum = 0;
+        Utils::Sha1Digest sha1{};
+
+        // Header values after database corrections, which loading the ROM uses instead of the file's own
+        std::uint16_t mapperId  = 0;
+        Byte          submapper = 0;
+        Mirroring     mirroring = Mirroring::Horizontal;
+        Byte          flags     = 0;
+
+        std::string_view path;
+
+        bool isRunnable() const;
+        bool isCorrected() const;
+    };
+
+    // Compact index of a ROM library written by caique-nes-indexer: fixed size entries sorted by checksum followed
+    // by the paths. The file is mapped and searched in place, looking a ROM up costs a binary search.
+    class RomIndex {
+    public:
+        static std::expected<RomIndex, Utils::ErrorString> loadFromFilesystem(const std::string& path);
+
+        // Entries are sorted here, the paths they point at only have to live until the call returns
+        static std::expected<void, Utils::ErrorString> writeToFilesystem(const std::string& path,
+                                                                         std::vector<RomIndexEntry> entries);
+
+        std::size_t size() const;
+        RomIndexEntry entryAt(std::size_t index) const;
+        std::optional<RomIndexEntry> find(std::uint32_t checksum) const;
+
+    private:
+        explicit RomIndex(Utils::MappedFile file);
+
+        Utils::MappedFile     m_file;
+        std::span<const Byte> m_entries;
+        std::span<const Byte> m_paths;
+        std::size_t           m_size = 0;
+    };
+}
+
+#endif //CAIQUE_NES_ROMINDEX_HPP
@@ -0,0 +1,124 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <algorithm>
+#include "Core/Scheduler.hpp"
+
+Nes::Scheduler::Scheduler() {
+    m_eventTimes.fill(Const::Scheduler::never);
+}
+
+Nes::Timestamp Nes::Scheduler::now() const {
+    return m_now;
+}
+
+void Nes::Scheduler::advance(CycleCount cycles) {
+    m_now += cycles;
+}
+
+void Nes::Scheduler::schedule(EventType type, Timestamp at) {
+    m_eventTimes[static_cast<std::size_t>(type)] = at;
+    updateNextEvent();
+}
+
+void Nes::Scheduler::cancel(EventType type) {
+    schedule(type, Const::Scheduler::never);
+}
+
+bool Nes::Scheduler::isDue(EventType type) const {
+    return m_eventTimes[static_cast<std::size_t>(type)] <= m_now;
+}
+
+std::optional<Nes::EventType> Nes::Scheduler::popDueEvent() {
+    if (m_nextEventTime > m_now) {
+        return std::nullopt;
+    }
+
+    const auto earliest = std::min_element(m_eventTimes.begin(), m_eventTimes.end());
+    if (*earliest > m_now) {
+        return std::nullopt;
+    }
+
+    *earliest = Const::Scheduler::never;
+    updateNextEvent();
+
+    return static_cast<EventType>(earliest - m_eventTimes.begin());
+}
+
+void Nes::Scheduler::setHandler(EventType type, EventHandler handler) {
+    m_handlers[static_cast<std::size_t>(type)] = std::move(handler);
+}
+
+void Nes::Scheduler::dispatchDueEvents() {
+    while (const auto event = popDueEvent()) {
+        const auto& handler = m_handlers[static_cast<std::size_t>(*event)];
+        if (handler) {
+            handler();
+        }
+    }
+}
+
+void Nes::Scheduler::raiseIrq(IrqSource source) {
+    m_irqSources |= static_cast<std::uint8_t>(source);
+    schedule(EventType::Irq, m_now);
+}
+
+void Nes::Scheduler::acknowledgeIrq(IrqSource source) {
+    m_irqSources &= ~static_cast<std::uint8_t>(source);
+}
+
+bool Nes::Scheduler::isIrqAsserted() const {
+    return m_irqSources != 0;
+}
+
+bool Nes::Scheduler::isIrqAsserted(IrqSource source) const {
+    return (m_irqSources & static_cast<std::uint8_t>(source)) != 0;
+}
+
+Nes::Timestamp Nes::Scheduler::batchEnd() const {
+    return m_batchEnd;
+}
+
+void Nes::Scheduler::setRunLimit(Timestamp limit) {
+    m_runLimit = limit;
+    updateNextEvent();
+}
+
+void Nes::Scheduler::updateNextEvent() {
+    m_nextEventTime = *std::min_element(m_eventTimes.begin(), m_eventTimes.end());
+    m_batchEnd      = std::min(m_runLimit, m_nextEventTime);
+}
+
+// The run limit only lives for the duration of a single CPU::run call and is left out, handlers belong to the machine
+void Nes::Scheduler::saveState(Utils::StateWriter& writer) const {
+    writer.write(m_now);
+    writer.write(m_irqSources);
+    for (const auto eventTime : m_eventTimes) {
+        writer.write(eventTime);
+    }
+}
+
+void Nes::Scheduler::loadState(Utils::StateReader& reader) {
+    reader.read(m_now);
+    reader.read(m_irqSources);
+    for (auto& eventTime : m_eventTimes) {
+        reader.read(eventTime);
+    }
+
+    updateNextEvent();
+}
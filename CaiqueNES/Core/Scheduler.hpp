@@ -0,0 +1,106 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#ifndef CAIQUE_NES_SCHEDULER_HPP
+#define CAIQUE_NES_SCHEDULER_HPP
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include "Utils/StateStream.hpp"
+
+namespace Nes {
+    using CycleCount = int;
+    using Timestamp  = std::uint64_t;
+
+    namespace Const::Scheduler {
+        constexpr Timestamp never = std::numeric_limits<Timestamp>::max();
+    }
+
+    // Ordered by priority, events due at the same timestamp are dispatched in this order
+    enum class EventType {
+        PpuCatchUp,
+        ApuFrameCounter,
+        Nmi,
+        Irq,
+        Count
+    };
+
+    // The IRQ line is shared, it stays asserted as long as any of the sources holds it
+    enum class IrqSource : std::uint8_t {
+        FrameCounter = 1 << 0,
+        Dmc          = 1 << 1,
+        Mapper       = 1 << 2
+    };
+
+    using EventHandler = std::function<void()>;
+
+    // Master timeline counted in CPU cycles since power on. Every event type has at most one pending occurrence at
+    // an absolute timestamp, so the CPU can run uninterrupted until the earliest of them instead of polling the other
+    // components after every instruction.
+    class Scheduler {
+    public:
+        Scheduler();
+
+        Timestamp now() const;
+        void advance(CycleCount cycles);
+
+        void schedule(EventType type, Timestamp at);
+        void cancel(EventType type);
+        bool isDue(EventType type) const;
+
+        // Earliest due event, which is removed from the timeline. Empty once nothing is due anymore.
+        std::optional<EventType> popDueEvent();
+
+        // Every component registers the handler for the events it schedules, dispatching runs them until nothing is
+        // due anymore
+        void setHandler(EventType type, EventHandler handler);
+        void dispatchDueEvents();
+
+        // Asserting schedules the IRQ event right away, the CPU decides whether it is taken
+        void raiseIrq(IrqSource source);
+        void acknowledgeIrq(IrqSource source);
+        bool isIrqAsserted() const;
+        bool isIrqAsserted(IrqSource source) const;
+
+        // Earliest timestamp at which the running batch of instructions has to stop: the next event or the run limit
+        Timestamp batchEnd() const;
+        void setRunLimit(Timestamp limit);
+
+        void saveState(Utils::StateWriter& writer) const;
+        void loadState(Utils::StateReader& reader);
+
+    private:
+        static constexpr auto eventTypeCount = static_cast<std::size_t>(EventType::Count);
+
+        std::array<Timestamp, eventTypeCount> m_eventTimes{};
+        std::array<EventHandler, eventTypeCount> m_handlers{};
+        std::uint8_t m_irqSources = 0;
+
+        Timestamp m_now           = 0;
+        Timestamp m_nextEventTime = Const::Scheduler::never;
+        Timestamp m_runLimit      = Const::Scheduler::never;
+        Timestamp m_batchEnd      = Const::Scheduler::never;
+
+        void updateNextEvent();
+    };
+}
+
+#endif //CAIQUE_NES_SCHEDULER_HPP
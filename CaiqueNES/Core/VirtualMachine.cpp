@@ -16,15 +16,17 @@
 *
 ***********************************************************************************************************************/
 
+#include <algorithm>
 #include "Core/VirtualMachine.hpp"
 
 Nes::VirtualMachine::VirtualMachine(DrawFunction drawFunction) :
+    m_drawCallback(drawFunction),
     m_mmu(m_cartridge),
+    m_apu(m_mmu, m_scheduler),
     m_firstJoypad(m_mmu, false),
-    m_secondJoypad(m_mmu, true),
-    m_apu(m_mmu),
-    m_ppu(m_mmu, std::move(drawFunction)),
-    m_cpu(m_mmu, m_ppu)
+    m_secondJoypad(m_mmu, true, &m_apu),
+    m_ppu(m_mmu, m_scheduler, std::move(drawFunction)),
+    m_cpu(m_mmu, m_ppu, m_scheduler)
 {
 }
 
@@ -34,22 +36,246 @@ std::expected<void, Utils::ErrorString> Nes::VirtualMachine::loadRom(const std::
         return std::unexpected(loadResult.error());
     }
 
+    m_mmu.rebuildPageTable();
+
+    // Trainers patch the game through work RAM, which has to hold them before the first instruction runs
+    const auto trainer = m_cartridge.trainer();
+    for (std::size_t i = 0; i < trainer.size(); i++) {
+        m_mmu.write(Const::trainerAddr + i, trainer[i]);
+    }
+
     m_cpu.loadProgramCounter();
+    m_romPath = path;
+
+    if (m_runAheadInstance) {
+        return loadRunAheadInstance();
+    }
 
     return {};
 }
 
+void Nes::VirtualMachine::setRomIndex(std::shared_ptr<const RomIndex> romIndex) {
+    m_romIndex = romIndex;
+    m_cartridge.setRomIndex(std::move(romIndex));
+
+    if (m_runAheadInstance) {
+        m_runAheadInstance->setRomIndex(m_romIndex);
+    }
+}
+
 void Nes::VirtualMachine::tick() {
-    CycleCount thisTickCycles = 0;
-    while (thisTickCycles < Const::cyclesPerFrame) {
-        thisTickCycles += m_cpu.tick();
+    if (m_skippedFrames < m_frameSkip) {
+        m_skippedFrames++;
+        skipFrame();
+        return;
+    }
+
+    m_skippedFrames = 0;
+
+    if (m_runAheadFrames == 0) {
+        runFrame();
+        return;
+    }
+
+    runFrame();
+    saveState(m_runAheadSnapshot);
+
+    if (m_runAheadInstance) {
+        (void) m_runAheadInstance->loadState(m_runAheadSnapshot);
+        m_runAheadInstance->runFramesAhead(m_runAheadFrames);
+    } else {
+        runFramesAhead(m_runAheadFrames);
+        (void) loadState(m_runAheadSnapshot);
     }
 }
 
+// Running ahead is only needed for presented frames, skipped ones just advance the emulated state
+void Nes::VirtualMachine::skipFrame() {
+    m_ppu.setDrawEnabled(false);
+    runFrame();
+    m_ppu.setDrawEnabled(m_runAheadFrames == 0);
+}
+
+void Nes::VirtualMachine::setFrameSkip(int skippedFrames) {
+    m_frameSkip     = std::max(skippedFrames, 0);
+    m_skippedFrames = 0;
+}
+
+std::expected<void, Utils::ErrorString> Nes::VirtualMachine::setRunAhead(int frames, bool useSecondInstance) {
+    m_runAheadFrames = std::max(frames, 0);
+    m_runAheadInstance.reset();
+
+    // The frame of the emulated state itself is never presented while running ahead
+    m_ppu.setDrawEnabled(m_runAheadFrames == 0);
+
+    if (m_runAheadFrames == 0 || !useSecondInstance) {
+        return {};
+    }
+
+    m_runAheadInstance = std::make_unique<VirtualMachine>(m_drawCallback);
+    m_runAheadInstance->setFrameTarget(m_frameTarget);
+    m_runAheadInstance->setRomIndex(m_romIndex);
+    for (auto i = 0; i < Const::joypadButtonCount; i++) {
+        if (m_firstJoypad.isPressed(static_cast<JoypadButton>(i))) {
+            m_runAheadInstance->handleKeyPress(static_cast<JoypadButton>(i));
+        }
+    }
+
+    if (!m_romPath.empty()) {
+        return loadRunAheadInstance();
+    }
+
+    return {};
+}
+
+// A second instance without the ROM cannot restore the snapshots, running ahead is turned off altogether instead
+std::expected<void, Utils::ErrorString> Nes::VirtualMachine::loadRunAheadInstance() {
+    const auto loadResult = m_runAheadInstance->loadRom(m_romPath);
+    if (!loadResult.has_value()) {
+        m_runAheadInstance.reset();
+        m_runAheadFrames = 0;
+        m_ppu.setDrawEnabled(true);
+
+        return std::unexpected("Run-ahead disabled, the second instance failed to load the ROM: " + loadResult.error());
+    }
+
+    return {};
+}
+
+// Runs up to the end of the current frame rather than a fixed budget, so each tick draws exactly one whole frame.
+// The run stops right as the final scanline is due, catching up here finishes the frame within this tick.
+void Nes::VirtualMachine::runFrame() {
+    (void) m_cpu.run(m_ppu.cpuCyclesUntilFrameEnd());
+    m_ppu.synchronize();
+    m_apu.endFrame();
+}
+
+// Only the last frame gets drawn, the ones before it cost CPU emulation alone. None of them is heard, the audio
+// comes from the frames of the emulated state.
+void Nes::VirtualMachine::runFramesAhead(int frames) {
+    m_apu.setOutputEnabled(false);
+    m_ppu.setDrawEnabled(false);
+    for (auto i = 1; i < frames; i++) {
+        runFrame();
+    }
+
+    m_ppu.setDrawEnabled(true);
+    runFrame();
+    m_ppu.setDrawEnabled(m_runAheadFrames == 0);
+    m_apu.setOutputEnabled(true);
+}
+
+void Nes::VirtualMachine::setAudioCallback(AudioFunction callback) {
+    m_apu.setAudioCallback(std::move(callback));
+}
+
+void Nes::VirtualMachine::setAudioRateRatio(double ratio) {
+    m_apu.setSampleRateRatio(ratio);
+}
+
+// Save states leave the buttons out, so the second run-ahead instance is given the same input directly
 void Nes::VirtualMachine::handleKeyPress(JoypadButton button) {
     m_firstJoypad.press(button);
+
+    if (m_runAheadInstance) {
+        m_runAheadInstance->handleKeyPress(button);
+    }
 }
 
 void Nes::VirtualMachine::handleKeyRelease(JoypadButton button) {
     m_firstJoypad.release(button);
+
+    if (m_runAheadInstance) {
+        m_runAheadInstance->handleKeyRelease(button);
+    }
+}
+
+bool Nes::VirtualMachine::isKeyPressed(JoypadButton button) const {
+    return m_firstJoypad.isPressed(button);
+}
+
+void Nes::VirtualMachine::saveState(std::vector<Byte>& snapshot) const {
+    snapshot.clear();
+
+    Utils::StateWriter writer(snapshot);
+    writer.write(Const::SaveState::magic);
+    writer.write(Const::SaveState::version);
+    writer.write(m_cartridge.checksum());
+
+    const auto payloadSizeOffset = writer.size();
+    writer.write(std::uint32_t{0});
+    const auto payloadOffset = writer.size();
+
+    m_scheduler.saveState(writer);
+    m_cpu.saveState(writer);
+    m_ppu.saveState(writer);
+    m_apu.saveState(writer);
+    m_mmu.saveState(writer);
+    m_firstJoypad.saveState(writer);
+    m_secondJoypad.saveState(writer);
+    m_cartridge.saveState(writer);
+
+    writer.writeAt(payloadSizeOffset, static_cast<std::uint32_t>(writer.size() - payloadOffset));
+}
+
+std::expected<void, Utils::ErrorString> Nes::VirtualMachine::loadState(std::span<const Byte> snapshot) {
+    Utils::StateReader reader(snapshot);
+    if (reader.read<std::uint32_t>() != Const::SaveState::magic) {
+        return std::unexpected("Not a save state");
+    }
+
+    if (reader.read<std::uint16_t>() != Const::SaveState::version) {
+        return std::unexpected("Unsupported save state version");
+    }
+
+    if (reader.read<std::uint32_t>() != m_cartridge.checksum()) {
+        return std::unexpected("Save state was taken with a different ROM");
+    }
+
+    // Validated up front so a damaged snapshot never leaves the machine half restored
+    const auto payloadSize = reader.read<std::uint32_t>();
+    if (reader.failed() || payloadSize != reader.remaining()) {
+        return std::unexpected("Save state is truncated or corrupted");
+    }
+
+    m_scheduler.loadState(reader);
+    m_cpu.loadState(reader);
+    m_ppu.loadState(reader);
+    m_apu.loadState(reader);
+    m_mmu.loadState(reader);
+    m_firstJoypad.loadState(reader);
+    m_secondJoypad.loadState(reader);
+    m_cartridge.loadState(reader);
+    m_mmu.refreshCartridgePages();
+
+    if (reader.failed() || reader.remaining() != 0) {
+        return std::unexpected("Save state is truncated or corrupted");
+    }
+
+    return {};
+}
+
+const Nes::FrameBuffer& Nes::VirtualMachine::frameBuffer() const {
+    if (m_runAheadInstance) {
+        return m_runAheadInstance->frameBuffer();
+    }
+
+    return m_ppu.frameBuffer();
+}
+
+void Nes::VirtualMachine::setFrameTarget(FrameBuffer* target) {
+    m_frameTarget = target;
+    m_ppu.setFrameTarget(target);
+
+    if (m_runAheadInstance) {
+        m_runAheadInstance->setFrameTarget(target);
+    }
+}
+
+std::span<const Nes::Byte> Nes::VirtualMachine::internalRAM() const {
+    return m_mmu.viewMemory(Const::AddrRange::internalRAM);
+}
+
+std::span<const Nes::Byte> Nes::VirtualMachine::workRAM() const {
+    return m_mmu.viewMemory(Const::AddrRange::workRAM);
 }
@@ -20,13 +20,17 @@
 #define CAIQUE_NES_VIRTUALMACHINE_HPP
 
 #include <expected>
+#include <memory>
+#include <span>
 #include <string>
+#include <vector>
 #include "Core/Cartridge.hpp"
 #include "Core/Joypad.hpp"
 #include "Core/MMU.hpp"
 #include "Core/CPU.hpp"
 #include "Core/PPU.hpp"
 #include "Core/APU.hpp"
+#include "Core/Scheduler.hpp"
 
 #ifdef TESTING_ENVIRONMENT_NESTEST
 #include "../../Tests/External/NesTest/NesTest.TestUtils.hpp"
@@ -35,6 +39,11 @@
 namespace Nes {
     namespace Const {
         constexpr CycleCount cyclesPerFrame = 29780;
+
+        namespace SaveState {
+            constexpr std::uint32_t magic   = 0x53534E43; // "CNSS"
+            constexpr std::uint16_t version = 6;
+        }
     }
 
     class VirtualMachine {
@@ -43,20 +52,72 @@ namespace Nes {
 
         std::expected<void, Utils::ErrorString> loadRom(const std::string& path);
 
+        // Header corrections from a ROM library index, applied by the following loadRom calls
+        void setRomIndex(std::shared_ptr<const RomIndex> romIndex);
+
+        // Emulates until the current frame has been completed
         void tick();
 
+        // Emulates a frame without drawing it, only the PPU state which affects emulation is evaluated
+        void skipFrame();
+
+        // Fast-forward support, tick only draws every (skippedFrames + 1)-th frame
+        void setFrameSkip(int skippedFrames);
+
+        // Presents the frame `frames` frames ahead of the emulated state, hiding the game's input lag. The lookahead
+        // either runs on this machine and is rolled back with a save state, or on a second instance which keeps the
+        // rollback out of the main machine at the cost of a second ROM load. Running ahead is turned off again when
+        // that load fails, here or in a later loadRom.
+        std::expected<void, Utils::ErrorString> setRunAhead(int frames, bool useSecondInstance = false);
+
+        // Receives the samples of every emulated frame at Const::Audio::sampleRate, called from the emulating thread
+        void setAudioCallback(AudioFunction callback);
+
+        // Lets the audio consumer speed up or slow down sample production slightly, see Utils::DynamicRateControl
+        void setAudioRateRatio(double ratio);
+
+        // Button state is host input, it is left out of save states and survives restoring one
         void handleKeyPress(JoypadButton button);
         void handleKeyRelease(JoypadButton button);
+        bool isKeyPressed(JoypadButton button) const;
+
+        const FrameBuffer& frameBuffer() const;
+        void setFrameTarget(FrameBuffer* target);
+        std::span<const Byte> internalRAM() const;
+        std::span<const Byte> workRAM() const;
+
+        // Snapshots are only valid for the ROM they were taken with. Saving reuses the capacity of the given buffer and
+        // restoring does not allocate.
+        void saveState(std::vector<Byte>& snapshot) const;
+        std::expected<void, Utils::ErrorString> loadState(std::span<const Byte> snapshot);
 
     private:
+        DrawFunction m_drawCallback;
+        std::string  m_romPath{};
+        std::shared_ptr<const RomIndex> m_romIndex{};
+        FrameBuffer* m_frameTarget = nullptr;
+
+        Scheduler m_scheduler;
         Cartridge m_cartridge;
         MMU m_mmu;
+        APU m_apu;
         Joypad m_firstJoypad;
         Joypad m_secondJoypad;
-        APU m_apu;
         PPU m_ppu;
         CPU m_cpu;
 
+        int m_frameSkip     = 0;
+        int m_skippedFrames = 0;
+
+        /* Run-ahead */
+        int m_runAheadFrames = 0;
+        std::unique_ptr<VirtualMachine> m_runAheadInstance{};
+        std::vector<Byte> m_runAheadSnapshot{};
+
+        void runFrame();
+        void runFramesAhead(int frames);
+        std::expected<void, Utils::ErrorString> loadRunAheadInstance();
+
 #if defined(TESTING_ENVIRONMENT_NESTEST) | defined(TESTING_ENVIRONMENT_PACMAN)
     public:
         PPU* accessPPU() {
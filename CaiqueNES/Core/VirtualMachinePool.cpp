@@ -0,0 +1,88 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include "Core/VirtualMachinePool.hpp"
+
+Nes::VirtualMachinePool::VirtualMachinePool(std::size_t instanceCount, std::size_t threadCount) :
+    m_threadPool(threadCount)
+{
+    m_instances.reserve(instanceCount);
+    for (std::size_t i = 0; i < instanceCount; i++) {
+        // Frames are read through frameBuffer() once a batch finished, so nothing has to happen on draw
+        m_instances.push_back(std::make_unique<VirtualMachine>([](const FrameBuffer&) {}));
+    }
+}
+
+std::size_t Nes::VirtualMachinePool::size() const {
+    return m_instances.size();
+}
+
+std::expected<void, Utils::ErrorString> Nes::VirtualMachinePool::loadRom(const std::string& path) {
+    for (std::size_t i = 0; i < m_instances.size(); i++) {
+        const auto loadResult = loadRom(i, path);
+        if (!loadResult.has_value()) {
+            return loadResult;
+        }
+    }
+
+    return {};
+}
+
+std::expected<void, Utils::ErrorString> Nes::VirtualMachinePool::loadRom(std::size_t instance, const std::string& path) {
+    const auto loadResult = m_instances.at(instance)->loadRom(path);
+    if (!loadResult.has_value()) {
+        return std::unexpected("Instance " + std::to_string(instance) + ": " + loadResult.error());
+    }
+
+    return {};
+}
+
+void Nes::VirtualMachinePool::runFrames(int frameCount) {
+    if (frameCount <= 0) {
+        return;
+    }
+
+    for (std::size_t i = 0; i < m_instances.size(); i++) {
+        scheduleFrame(i, frameCount);
+    }
+
+    m_threadPool.wait();
+}
+
+void Nes::VirtualMachinePool::scheduleFrame(std::size_t instance, int remainingFrames) {
+    m_threadPool.submit([this, instance, remainingFrames] {
+        m_instances[instance]->tick();
+
+        // The next frame of this instance is queued on the current worker, idle workers steal it from there
+        if (remainingFrames > 1) {
+            scheduleFrame(instance, remainingFrames - 1);
+        }
+    });
+}
+
+Nes::VirtualMachine& Nes::VirtualMachinePool::accessInstance(std::size_t instance) {
+    return *m_instances.at(instance);
+}
+
+const Nes::FrameBuffer& Nes::VirtualMachinePool::frameBuffer(std::size_t instance) const {
+    return m_instances.at(instance)->frameBuffer();
+}
+
+std::span<const Nes::Byte> Nes::VirtualMachinePool::internalRAM(std::size_t instance) const {
+    return m_instances.at(instance)->internalRAM();
+}
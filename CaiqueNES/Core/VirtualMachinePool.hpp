@@ -0,0 +1,61 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#ifndef CAIQUE_NES_VIRTUALMACHINEPOOL_HPP
+#define CAIQUE_NES_VIRTUALMACHINEPOOL_HPP
+
+#include <expected>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+#include "Core/VirtualMachine.hpp"
+#include "Utils/ThreadPool.hpp"
+#include "Utils/Types.hpp"
+
+namespace Nes {
+    // Owns independent virtual machines and steps them in parallel, one frame of one machine per task. Frame buffers and
+    // RAM are exposed as views into the machines and stay valid for the lifetime of the pool, they must not be read
+    // while runFrames is in progress.
+    class VirtualMachinePool {
+    public:
+        explicit VirtualMachinePool(std::size_t instanceCount,
+                                    std::size_t threadCount = std::thread::hardware_concurrency());
+
+        std::size_t size() const;
+
+        std::expected<void, Utils::ErrorString> loadRom(const std::string& path);
+        std::expected<void, Utils::ErrorString> loadRom(std::size_t instance, const std::string& path);
+
+        // Advances every instance by frameCount frames and blocks until all of them are done
+        void runFrames(int frameCount);
+
+        VirtualMachine& accessInstance(std::size_t instance);
+
+        const FrameBuffer& frameBuffer(std::size_t instance) const;
+        std::span<const Byte> internalRAM(std::size_t instance) const;
+
+    private:
+        std::vector<std::unique_ptr<VirtualMachine>> m_instances;
+        Utils::ThreadPool m_threadPool;
+
+        void scheduleFrame(std::size_t instance, int remainingFrames);
+    };
+}
+
+#endif //CAIQUE_NES_VIRTUALMACHINEPOOL_HPP
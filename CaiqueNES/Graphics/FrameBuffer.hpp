@@ -20,7 +20,7 @@
 #define CAIQUE_NES_FRAMEBUFFER_HPP
 
 #include <array>
-#include "Graphics/Texture.hpp"
+#include "Utils/Types.hpp"
 
 namespace Graphics {
     template <int width, int height>
@@ -29,10 +29,19 @@ namespace Graphics {
         bool withinBounds(int x, int y) const;
 
         void updatePixel(int x, int y, PixelColor rawValue);
-        void copyToTexture(Texture& targetTexture) const;
+        void updateLine(int y, const std::array<PixelColor, width>& line);
+        const PixelColor* data() const;
+        constexpr int pitch() const;
 
     private:
         std::array<PixelColor, width * height> m_pixels{0};
+
+#ifdef TESTING_ENVIRONMENT_PPU
+    public:
+        PixelColor getPixel(int x, int y) const {
+            return m_pixels.at((y * width) + x);
+        }
+#endif
     };
 }
 
@@ -19,6 +19,7 @@
 #ifndef CAIQUE_NES_FRAMEBUFFER_TPP
 #define CAIQUE_NES_FRAMEBUFFER_TPP
 
+#include <algorithm>
 #include "Graphics/FrameBuffer.hpp"
 #include "Utils/Data.hpp"
 
@@ -40,8 +41,18 @@ void Graphics::FrameBuffer<width, height>::updatePixel(int x, int y, PixelColor
 }
 
 template <int width, int height>
-void Graphics::FrameBuffer<width, height>::copyToTexture(Graphics::Texture& targetTexture) const {
-    targetTexture.update(reinterpret_cast<const PixelColor*>(m_pixels.data()), width * sizeof(PixelColor));
+void Graphics::FrameBuffer<width, height>::updateLine(int y, const std::array<PixelColor, width>& line) {
+    std::copy(line.cbegin(), line.cend(), m_pixels.begin() + Utils::convert2DIndexTo1DIndex(width, 0, y));
+}
+
+template <int width, int height>
+const Graphics::PixelColor* Graphics::FrameBuffer<width, height>::data() const {
+    return m_pixels.data();
+}
+
+template <int width, int height>
+constexpr int Graphics::FrameBuffer<width, height>::pitch() const {
+    return width * sizeof(PixelColor);
 }
 
 #endif //CAIQUE_NES_FRAMEBUFFER_TPP
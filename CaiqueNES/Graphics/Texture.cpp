@@ -16,6 +16,7 @@
 *
 ***********************************************************************************************************************/
 
+#include <cstring>
 #include "Graphics/Renderer.hpp"
 #include "Texture.hpp"
 
@@ -26,7 +27,9 @@ Graphics::Texture::Texture(SDL_Texture* texture) :
 
 Graphics::Texture::Texture(const Graphics::Renderer& renderer, TextureFormat format, TextureAccess access, int width, int height) :
     m_sdlTexture(SDL_CreateTexture(renderer.wrappedObject(), static_cast<std::int32_t>(format),
-                                   static_cast<std::int32_t>(access), width, height), SDL_DestroyTexture)
+                                   static_cast<std::int32_t>(access), width, height), SDL_DestroyTexture),
+    m_access(access),
+    m_height(height)
 {
 }
 
@@ -39,5 +42,39 @@ SDL_Texture* Graphics::Texture::wrappedObject() const {
 }
 
 void Graphics::Texture::update(const PixelColor* pixels, int widthBytes) {
-    SDL_UpdateTexture(m_sdlTexture.get(), nullptr, pixels, widthBytes);
+    const auto locked = lock();
+    if (!locked.has_value()) {
+        SDL_UpdateTexture(m_sdlTexture.get(), nullptr, pixels, widthBytes);
+        return;
+    }
+
+    const auto* source = reinterpret_cast<const std::uint8_t*>(pixels);
+    auto* destination  = reinterpret_cast<std::uint8_t*>(locked->pixels);
+    if (locked->pitch == widthBytes) {
+        std::memcpy(destination, source, static_cast<std::size_t>(widthBytes) * m_height);
+    } else {
+        for (auto y = 0; y < m_height; y++) {
+            std::memcpy(destination + y * locked->pitch, source + y * widthBytes, widthBytes);
+        }
+    }
+
+    unlock();
+}
+
+std::optional<Graphics::LockedPixels> Graphics::Texture::lock() {
+    if (m_access != TextureAccess::Streaming) {
+        return std::nullopt;
+    }
+
+    void* pixels = nullptr;
+    int pitch    = 0;
+    if (SDL_LockTexture(m_sdlTexture.get(), nullptr, &pixels, &pitch) != 0) {
+        return std::nullopt;
+    }
+
+    return LockedPixels{static_cast<PixelColor*>(pixels), pitch};
+}
+
+void Graphics::Texture::unlock() {
+    SDL_UnlockTexture(m_sdlTexture.get());
 }
@@ -21,6 +21,7 @@
 
 #include <SDL2/SDL.h>
 #include <cstdint>
+#include <optional>
 #include "Utils/Types.hpp"
 
 namespace Graphics {
@@ -31,7 +32,13 @@ namespace Graphics {
     };
 
     enum class TextureAccess {
-        Static = SDL_TEXTUREACCESS_STATIC
+        Static    = SDL_TEXTUREACCESS_STATIC,
+        Streaming = SDL_TEXTUREACCESS_STREAMING
+    };
+
+    struct LockedPixels {
+        PixelColor* pixels;
+        int pitch;
     };
 
     class Texture {
@@ -42,10 +49,18 @@ namespace Graphics {
         bool isValid() const;
         SDL_Texture* wrappedObject() const;
 
+        // Streaming textures are written through lock/unlock, static ones or a failed lock fall back to a plain upload
         void update(const PixelColor* pixels, int widthBytes);
 
+        // Only available for streaming textures, the locked memory is write-only and valid until unlock
+        std::optional<LockedPixels> lock();
+        void unlock();
+
     private:
         Utils::CTypeUniquePtr<SDL_Texture> m_sdlTexture;
+
+        TextureAccess m_access = TextureAccess::Static;
+        int m_height = 0;
     };
 }
 
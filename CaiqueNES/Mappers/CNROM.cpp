@@ -0,0 +1,54 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+
+#include "CNROM.hpp"
+
+Nes::CNROM::CNROM(Cartridge& cartridge, int sizeOfPRG, int sizeOfCHR) :
+        BaseMapper(cartridge, sizeOfPRG, sizeOfCHR, static_cast<Byte>(Mapper::CNROM), &CNROM::validate)
+{
+    mapPRG(0, Const::CNROM::prgBankSize, 0);
+    mapPRG(2, Const::CNROM::prgBankSize, -1);
+    mapCHR(0, Const::CNROM::chrBankSize, m_bank);
+}
+
+void Nes::CNROM::writePRG(Addr, Byte value) {
+    // Scanlines the PPU still has to render were fetched from the previous bank
+    synchronizePPU();
+
+    m_bank = value;
+    mapCHR(0, Const::CNROM::chrBankSize, m_bank);
+}
+
+void Nes::CNROM::saveState(Utils::StateWriter& writer) const {
+    writer.write(m_bank);
+}
+
+void Nes::CNROM::loadState(Utils::StateReader& reader) {
+    reader.read(m_bank);
+    mapCHR(0, Const::CNROM::chrBankSize, m_bank);
+}
+
+bool Nes::CNROM::validate(int sizeOfPRG, int sizeOfCHR) {
+    const bool validPRGSize = sizeOfPRG > 0 && sizeOfPRG <= Const::CNROM::maximumPRGSize &&
+                              isWholeBanks(sizeOfPRG, Const::CNROM::prgBankSize);
+    const bool validCHRSize = sizeOfCHR > 0 && sizeOfCHR <= Const::CNROM::maximumCHRSize &&
+                              isWholeBanks(sizeOfCHR, Const::CNROM::chrBankSize);
+
+    return validPRGSize && validCHRSize;
+}
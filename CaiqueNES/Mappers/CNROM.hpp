@@ -0,0 +1,53 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+
+#ifndef CAIQUE_NES_CNROM_HPP
+#define CAIQUE_NES_CNROM_HPP
+
+#include "Core/Cartridge.hpp"
+#include "Core/BaseMapper.hpp"
+
+namespace Nes {
+    namespace Const::CNROM {
+        constexpr std::size_t prgBankSize = Utils::kilobytesToBytes(16);
+        constexpr std::size_t chrBankSize = Utils::kilobytesToBytes(8);
+
+        constexpr int maximumPRGSize = 32;
+        constexpr int maximumCHRSize = 2048;
+    }
+
+    // Fixed PRG laid out like NROM, the whole 8 KB of CHR is switched at once
+    class CNROM : public BaseMapper {
+    public:
+        CNROM(Cartridge& cartridge, int sizeOfPRG, int sizeOfCHR);
+        ~CNROM() override = default;
+
+        void writePRG(Addr addr, Byte value) override;
+
+        static bool validate(int sizeOfPRG, int sizeOfCHR);
+
+        void saveState(Utils::StateWriter& writer) const override;
+        void loadState(Utils::StateReader& reader) override;
+
+    private:
+        Byte m_bank = 0;
+    };
+}
+
+#endif //CAIQUE_NES_CNROM_HPP
@@ -0,0 +1,132 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+
+#include "MMC1.hpp"
+
+Nes::MMC1::MMC1(Cartridge& cartridge, int sizeOfPRG, int sizeOfCHR) :
+        BaseMapper(cartridge, sizeOfPRG, sizeOfCHR, static_cast<Byte>(Mapper::MMC1), &MMC1::validate)
+{
+    updateBanks();
+}
+
+void Nes::MMC1::writePRG(Addr addr, Byte value) {
+    if ((value & Const::MMC1::resetBit) != 0) {
+        m_shiftRegister = 0;
+        m_shiftCount    = 0;
+        writeRegister(MMC1Register::Control, m_control | Const::MMC1::controlOnReset);
+        return;
+    }
+
+    // Bits arrive least significant first
+    m_shiftRegister |= (value & 1) << m_shiftCount;
+    if (++m_shiftCount < Const::MMC1::shiftRegisterWidth) {
+        return;
+    }
+
+    const auto mmc1Register = (addr >> Const::MMC1::registerSelectShift) & Const::MMC1::registerSelectMask;
+    writeRegister(static_cast<MMC1Register>(mmc1Register), m_shiftRegister);
+
+    m_shiftRegister = 0;
+    m_shiftCount    = 0;
+}
+
+void Nes::MMC1::saveState(Utils::StateWriter& writer) const {
+    writer.write(m_shiftRegister);
+    writer.write(m_shiftCount);
+    writer.write(m_control);
+    writer.write(m_chrBank0);
+    writer.write(m_chrBank1);
+    writer.write(m_prgBank);
+}
+
+void Nes::MMC1::loadState(Utils::StateReader& reader) {
+    reader.read(m_shiftRegister);
+    reader.read(m_shiftCount);
+    reader.read(m_control);
+    reader.read(m_chrBank0);
+    reader.read(m_chrBank1);
+    reader.read(m_prgBank);
+
+    updateBanks();
+}
+
+void Nes::MMC1::writeRegister(MMC1Register mmc1Register, Byte value) {
+    // Scanlines the PPU still has to render were fetched with the previous banks and mirroring
+    synchronizePPU();
+
+    switch (mmc1Register) {
+        case MMC1Register::Control:  m_control  = value; break;
+        case MMC1Register::CHRBank0: m_chrBank0 = value; break;
+        case MMC1Register::CHRBank1: m_chrBank1 = value; break;
+        case MMC1Register::PRGBank:  m_prgBank  = value; break;
+    }
+
+    updateBanks();
+}
+
+void Nes::MMC1::updateBanks() {
+    switch (m_control & Const::MMC1::ControlMask::mirroring) {
+        case 0:  setMirroring(Mirroring::SingleScreenLower); break;
+        case 1:  setMirroring(Mirroring::SingleScreenUpper); break;
+        case 2:  setMirroring(Mirroring::Vertical);          break;
+        default: setMirroring(Mirroring::Horizontal);        break;
+    }
+
+    // Counted in 16 KB banks, the outer bank picks the 256 KB half on boards large enough to have one
+    const bool hasOuterBank = m_cartridge.accessPRG().size() > Const::MMC1::prgOuterBankSize;
+    const int outerBank     = hasOuterBank && (m_chrBank0 & Const::MMC1::prgOuterBankMask) != 0 ?
+                              Const::MMC1::prgOuterBankSize / Const::MMC1::prgBankSize : 0;
+    const int prgBank       = outerBank + (m_prgBank & Const::MMC1::prgBankMask);
+    const int lastPrgBank   = hasOuterBank ? outerBank + Const::MMC1::prgBankMask : -1;
+
+    switch ((m_control & Const::MMC1::ControlMask::prgMode) >> 2) {
+        case 0:
+        case 1:
+            mapPRG(0, Const::MMC1::prgBankSize, prgBank & ~1);
+            mapPRG(2, Const::MMC1::prgBankSize, prgBank | 1);
+            break;
+
+        case 2:
+            mapPRG(0, Const::MMC1::prgBankSize, outerBank);
+            mapPRG(2, Const::MMC1::prgBankSize, prgBank);
+            break;
+
+        default:
+            mapPRG(0, Const::MMC1::prgBankSize, prgBank);
+            mapPRG(2, Const::MMC1::prgBankSize, lastPrgBank);
+            break;
+    }
+
+    if ((m_control & Const::MMC1::ControlMask::chrMode) != 0) {
+        mapCHR(0, Const::MMC1::chrBankSize, m_chrBank0);
+        mapCHR(4, Const::MMC1::chrBankSize, m_chrBank1);
+    } else {
+        mapCHR(0, Const::MMC1::chrBankSize, m_chrBank0 & ~1);
+        mapCHR(4, Const::MMC1::chrBankSize, m_chrBank0 | 1);
+    }
+}
+
+bool Nes::MMC1::validate(int sizeOfPRG, int sizeOfCHR) {
+    const bool validPRGSize = sizeOfPRG > 0 && sizeOfPRG <= Const::MMC1::maximumPRGSize &&
+                              isWholeBanks(sizeOfPRG, Const::MMC1::prgBankSize);
+    const bool validCHRSize = sizeOfCHR <= Const::MMC1::maximumCHRSize &&
+                              isWholeBanks(sizeOfCHR, Const::MMC1::chrBankSize);
+
+    return validPRGSize && validCHRSize;
+}
@@ -0,0 +1,88 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+
+#ifndef CAIQUE_NES_MMC1_HPP
+#define CAIQUE_NES_MMC1_HPP
+
+#include "Core/Cartridge.hpp"
+#include "Core/BaseMapper.hpp"
+
+namespace Nes {
+    namespace Const::MMC1 {
+        constexpr std::size_t prgBankSize      = Utils::kilobytesToBytes(16);
+        constexpr std::size_t chrBankSize      = Utils::kilobytesToBytes(4);
+        constexpr std::size_t prgOuterBankSize = Utils::kilobytesToBytes(256);
+
+        constexpr int maximumPRGSize = 512;
+        constexpr int maximumCHRSize = 128;
+
+        constexpr int  shiftRegisterWidth = 5;
+        constexpr Byte resetBit           = 0x80;
+        constexpr Byte controlOnReset     = 0x0C;
+
+        // The register written by the fifth bit is selected by address lines 13 and 14
+        constexpr int registerSelectShift = 13;
+        constexpr Byte registerSelectMask = 0b11;
+
+        namespace ControlMask {
+            constexpr Byte mirroring = 0b00011;
+            constexpr Byte prgMode   = 0b01100;
+            constexpr Byte chrMode   = 0b10000;
+        }
+
+        constexpr Byte prgBankMask      = 0x0F;
+        constexpr Byte prgOuterBankMask = 0x10;
+    }
+
+    enum class MMC1Register {
+        Control,
+        CHRBank0,
+        CHRBank1,
+        PRGBank
+    };
+
+    // Registers are loaded one bit per write through a serial shift register. PRG is switched in 16 or 32 KB banks and
+    // CHR in 4 or 8 KB ones, 512 KB boards use the CHR registers to select the upper half of PRG.
+    class MMC1 : public BaseMapper {
+    public:
+        MMC1(Cartridge& cartridge, int sizeOfPRG, int sizeOfCHR);
+        ~MMC1() override = default;
+
+        void writePRG(Addr addr, Byte value) override;
+
+        static bool validate(int sizeOfPRG, int sizeOfCHR);
+
+        void saveState(Utils::StateWriter& writer) const override;
+        void loadState(Utils::StateReader& reader) override;
+
+    private:
+        Byte m_shiftRegister = 0;
+        int  m_shiftCount    = 0;
+
+        Byte m_control  = Const::MMC1::controlOnReset;
+        Byte m_chrBank0 = 0;
+        Byte m_chrBank1 = 0;
+        Byte m_prgBank  = 0;
+
+        void writeRegister(MMC1Register mmc1Register, Byte value);
+        void updateBanks();
+    };
+}
+
+#endif //CAIQUE_NES_MMC1_HPP
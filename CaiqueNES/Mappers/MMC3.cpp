@@ -0,0 +1,177 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+
+#include "MMC3.hpp"
+
+Nes::MMC3::MMC3(Cartridge& cartridge, int sizeOfPRG, int sizeOfCHR) :
+        BaseMapper(cartridge, sizeOfPRG, sizeOfCHR, static_cast<Byte>(Mapper::MMC3), &MMC3::validate),
+        m_fourScreen(cartridge.mirroring() == Mirroring::FourScreen)
+{
+    updateBanks();
+}
+
+void Nes::MMC3::writePRG(Addr addr, Byte value) {
+    const bool odd = (addr & 1) != 0;
+
+    switch ((addr >> Const::MMC3::registerSelectShift) & Const::MMC3::registerSelectMask) {
+        case 0:
+            // The lagging PPU renders its pending scanlines before the banks change under it, as does a mirroring write
+            synchronizePPU();
+
+            if (odd) {
+                m_bankRegisters[m_bankSelect & Const::MMC3::BankSelectMask::bankRegister] = value;
+            } else {
+                m_bankSelect = value;
+            }
+
+            updateBanks();
+            break;
+
+        case 1:
+            // PRG RAM protection is not emulated, work RAM is always accessible
+            if (!odd) {
+                synchronizePPU();
+
+                m_mirroring = value;
+                updateMirroring();
+            }
+
+            break;
+
+        default:
+            writeIrqRegister(addr, value);
+            break;
+    }
+}
+
+// The counter is reloaded when it is zero or a reload was requested, otherwise it counts down. Either way reaching
+// zero fires the IRQ, so a zero latch fires on every rise.
+void Nes::MMC3::handleA12Rise() {
+    if (m_irqCounter == 0 || m_irqReload) {
+        m_irqCounter = m_irqLatch;
+        m_irqReload  = false;
+    } else {
+        m_irqCounter--;
+    }
+
+    if (m_irqCounter == 0 && m_irqEnabled) {
+        raiseIrq();
+    }
+}
+
+std::optional<int> Nes::MMC3::a12RisesUntilIrq() const {
+    if (!m_irqEnabled) {
+        return std::nullopt;
+    }
+
+    if (m_irqCounter == 0 || m_irqReload) {
+        return m_irqLatch + 1;
+    }
+
+    return m_irqCounter;
+}
+
+void Nes::MMC3::saveState(Utils::StateWriter& writer) const {
+    writer.write(m_bankSelect);
+    writer.writeBytes(m_bankRegisters);
+    writer.write(m_mirroring);
+
+    writer.write(m_irqLatch);
+    writer.write(m_irqCounter);
+    writer.write(m_irqReload);
+    writer.write(m_irqEnabled);
+}
+
+void Nes::MMC3::loadState(Utils::StateReader& reader) {
+    reader.read(m_bankSelect);
+    reader.readBytes(m_bankRegisters);
+    reader.read(m_mirroring);
+
+    reader.read(m_irqLatch);
+    reader.read(m_irqCounter);
+    reader.read(m_irqReload);
+    reader.read(m_irqEnabled);
+
+    updateBanks();
+    updateMirroring();
+}
+
+void Nes::MMC3::updateBanks() {
+    const auto& banks = m_bankRegisters;
+
+    // R6 is either at $8000 with the second to last bank fixed at $C000, or the other way round
+    const bool prgSwapped = (m_bankSelect & Const::MMC3::BankSelectMask::prgMode) != 0;
+    mapPRG(prgSwapped ? 2 : 0, Const::MMC3::prgBankSize, banks[6]);
+    mapPRG(1, Const::MMC3::prgBankSize, banks[7]);
+    mapPRG(prgSwapped ? 0 : 2, Const::MMC3::prgBankSize, -2);
+    mapPRG(3, Const::MMC3::prgBankSize, -1);
+
+    // R0 and R1 select 2 KB banks in one pattern table and R2 to R5 1 KB banks in the other, inversion swaps the tables
+    const int largeBanksAt = (m_bankSelect & Const::MMC3::BankSelectMask::chrInversion) != 0 ? 4 : 0;
+    const int smallBanksAt = 4 - largeBanksAt;
+    mapCHR(largeBanksAt,     Const::MMC3::chrLargeBankSize, banks[0] >> 1);
+    mapCHR(largeBanksAt + 2, Const::MMC3::chrLargeBankSize, banks[1] >> 1);
+    for (auto i = 0; i < 4; i++) {
+        mapCHR(smallBanksAt + i, Const::MMC3::chrSmallBankSize, banks[2 + i]);
+    }
+}
+
+// Boards wired for four screen mirroring ignore the mirroring register
+void Nes::MMC3::updateMirroring() {
+    if (m_fourScreen) {
+        return;
+    }
+
+    setMirroring((m_mirroring & 1) != 0 ? Mirroring::Horizontal : Mirroring::Vertical);
+}
+
+void Nes::MMC3::writeIrqRegister(Addr addr, Byte value) {
+    // Scanlines the PPU still has to render have to be counted with the old configuration, and its next catch-up
+    // point has to be moved according to the new one
+    synchronizePPU();
+
+    const bool odd = (addr & 1) != 0;
+
+    if (((addr >> Const::MMC3::registerSelectShift) & Const::MMC3::registerSelectMask) == 2) {
+        // $C000 sets the latch, $C001 has the counter reloaded on the next rise
+        if (odd) {
+            m_irqCounter = 0;
+            m_irqReload  = true;
+        } else {
+            m_irqLatch = value;
+        }
+    } else {
+        // $E000 disables the IRQ and acknowledges a pending one, $E001 enables it
+        m_irqEnabled = odd;
+        if (!odd) {
+            acknowledgeIrq();
+        }
+    }
+
+    synchronizePPU();
+}
+
+bool Nes::MMC3::validate(int sizeOfPRG, int sizeOfCHR) {
+    const bool validPRGSize = sizeOfPRG > 0 && sizeOfPRG <= Const::MMC3::maximumPRGSize &&
+                              isWholeBanks(sizeOfPRG, Const::MMC3::prgBankSize);
+    const bool validCHRSize = sizeOfCHR <= Const::MMC3::maximumCHRSize &&
+                              isWholeBanks(sizeOfCHR, Const::MMC3::chrSmallBankSize);
+
+    return validPRGSize && validCHRSize;
+}
@@ -0,0 +1,84 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+
+#ifndef CAIQUE_NES_MMC3_HPP
+#define CAIQUE_NES_MMC3_HPP
+
+#include <array>
+#include "Core/Cartridge.hpp"
+#include "Core/BaseMapper.hpp"
+
+namespace Nes {
+    namespace Const::MMC3 {
+        constexpr std::size_t prgBankSize      = Utils::kilobytesToBytes(8);
+        constexpr std::size_t chrSmallBankSize = Utils::kilobytesToBytes(1);
+        constexpr std::size_t chrLargeBankSize = Utils::kilobytesToBytes(2);
+
+        constexpr int maximumPRGSize = 512;
+        constexpr int maximumCHRSize = 256;
+
+        constexpr int bankRegisterCount = 8;
+
+        // Registers come in pairs at every 8 KB of $8000-$FFFF, told apart by the lowest address bit
+        constexpr int registerSelectShift = 13;
+        constexpr Byte registerSelectMask = 0b11;
+
+        namespace BankSelectMask {
+            constexpr Byte bankRegister = 0b00000111;
+            constexpr Byte prgMode      = 0b01000000;
+            constexpr Byte chrInversion = 0b10000000;
+        }
+    }
+
+    // PRG is switched in 8 KB and CHR in 1 and 2 KB banks through eight bank registers. The IRQ counter is clocked by
+    // rising edges of PPU A12 and fires when it is decremented or reloaded to zero.
+    class MMC3 : public BaseMapper {
+    public:
+        MMC3(Cartridge& cartridge, int sizeOfPRG, int sizeOfCHR);
+        ~MMC3() override = default;
+
+        void writePRG(Addr addr, Byte value) override;
+
+        static bool validate(int sizeOfPRG, int sizeOfCHR);
+
+        void handleA12Rise() override;
+        std::optional<int> a12RisesUntilIrq() const override;
+
+        void saveState(Utils::StateWriter& writer) const override;
+        void loadState(Utils::StateReader& reader) override;
+
+    private:
+        Byte m_bankSelect = 0;
+        std::array<Byte, Const::MMC3::bankRegisterCount> m_bankRegisters{0};
+        Byte m_mirroring = 0;
+
+        Byte m_irqLatch   = 0;
+        Byte m_irqCounter = 0;
+        bool m_irqReload  = false;
+        bool m_irqEnabled = false;
+
+        bool m_fourScreen;
+
+        void updateBanks();
+        void updateMirroring();
+        void writeIrqRegister(Addr addr, Byte value);
+    };
+}
+
+#endif //CAIQUE_NES_MMC3_HPP
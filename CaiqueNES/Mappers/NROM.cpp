@@ -24,34 +24,21 @@
 Nes::NROM::NROM(Cartridge& cartridge, int sizeOfPRG, int sizeOfCHR) :
         BaseMapper(cartridge, sizeOfPRG, sizeOfCHR, 0, &NROM::validate)
 {
-    m_dualBankMode = sizeOfPRG == Const::dualBankPRGSize;
-}
-
-Nes::Byte Nes::NROM::readPRG(Addr addr) const {
-    if (!m_dualBankMode && addr >= Const::bankSeparationAddr) {
-        addr -= Const::bankSeparationAddr;
-    }
-
-    return m_cartridge.directReadPRG(addr);
+    // A single 16 KB bank is mirrored into both halves
+    mapPRG(0, Const::nromBankSize, 0);
+    mapPRG(2, Const::nromBankSize, -1);
+    mapCHR(0, Utils::kilobytesToBytes(Const::Validation::CHRSize), 0);
 }
 
 void Nes::NROM::writePRG(Addr addr, Byte value) {
     Utils::log("Attempted to write to NROM mapped cartridge PRG");
 }
 
-Nes::Byte Nes::NROM::readCHR(Addr addr) const {
-    return m_cartridge.directReadCHR(addr);
-}
-
-void Nes::NROM::writeCHR(Addr addr, Byte value) {
-    Utils::log("Attempted to write to NROM mapped cartridge CHR");
-}
-
 bool Nes::NROM::validate(int sizeOfPRG, int sizeOfCHR) {
     bool validPRGSize = std::any_of(Const::Validation::PRGSizes.cbegin(), Const::Validation::PRGSizes.cend(), [&](int validSize) {
         return sizeOfPRG == validSize;
     });
-    bool validCHRSize = sizeOfCHR == Const::Validation::CHRSize;
+    bool validCHRSize = sizeOfCHR == Const::Validation::CHRSize || sizeOfCHR == 0;
 
     return validPRGSize && validCHRSize;
 }
@@ -30,8 +30,7 @@ namespace Nes {
             constexpr int CHRSize = 8;
         }
 
-        constexpr int dualBankPRGSize    = Validation::PRGSizes[1];
-        constexpr int bankSeparationAddr = Utils::kilobytesToBytes(16);
+        constexpr std::size_t nromBankSize = Utils::kilobytesToBytes(16);
     }
 
     class NROM : public BaseMapper {
@@ -39,15 +38,8 @@ namespace Nes {
         NROM(Cartridge& cartridge, int sizeOfPRG, int sizeOfCHR);
         ~NROM() override = default;
 
-        Byte readPRG(Addr addr) const override;
         void writePRG(Addr addr, Byte value) override;
 
-        Byte readCHR(Addr addr) const override;
-        void writeCHR(Addr addr, Byte value) override;
-
-    private:
-        bool m_dualBankMode;
-
         static bool validate(int sizeOfPRG, int sizeOfCHR);
     };
 }
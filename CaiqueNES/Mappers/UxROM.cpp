@@ -0,0 +1,54 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+
+#include "UxROM.hpp"
+
+Nes::UxROM::UxROM(Cartridge& cartridge, int sizeOfPRG, int sizeOfCHR) :
+        BaseMapper(cartridge, sizeOfPRG, sizeOfCHR, static_cast<Byte>(Mapper::UxROM), &UxROM::validate)
+{
+    mapCHR(0, Utils::kilobytesToBytes(Const::UxROM::CHRSize), 0);
+    updateBanks();
+}
+
+void Nes::UxROM::writePRG(Addr, Byte value) {
+    m_bank = value;
+    updateBanks();
+}
+
+void Nes::UxROM::saveState(Utils::StateWriter& writer) const {
+    writer.write(m_bank);
+}
+
+void Nes::UxROM::loadState(Utils::StateReader& reader) {
+    reader.read(m_bank);
+    updateBanks();
+}
+
+void Nes::UxROM::updateBanks() {
+    mapPRG(0, Const::UxROM::bankSize, m_bank);
+    mapPRG(2, Const::UxROM::bankSize, -1);
+}
+
+bool Nes::UxROM::validate(int sizeOfPRG, int sizeOfCHR) {
+    const bool validPRGSize = sizeOfPRG > 0 && sizeOfPRG <= Const::UxROM::maximumPRGSize &&
+                              isWholeBanks(sizeOfPRG, Const::UxROM::bankSize);
+    const bool validCHRSize = sizeOfCHR == Const::UxROM::CHRSize || sizeOfCHR == 0;
+
+    return validPRGSize && validCHRSize;
+}
@@ -0,0 +1,54 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+
+#ifndef CAIQUE_NES_UXROM_HPP
+#define CAIQUE_NES_UXROM_HPP
+
+#include "Core/Cartridge.hpp"
+#include "Core/BaseMapper.hpp"
+
+namespace Nes {
+    namespace Const::UxROM {
+        constexpr std::size_t bankSize = Utils::kilobytesToBytes(16);
+
+        constexpr int maximumPRGSize = 4096;
+        constexpr int CHRSize        = 8;
+    }
+
+    // Switchable 16 KB PRG bank at $8000 and the last one fixed at $C000, CHR is a single unbanked 8 KB
+    class UxROM : public BaseMapper {
+    public:
+        UxROM(Cartridge& cartridge, int sizeOfPRG, int sizeOfCHR);
+        ~UxROM() override = default;
+
+        void writePRG(Addr addr, Byte value) override;
+
+        static bool validate(int sizeOfPRG, int sizeOfCHR);
+
+        void saveState(Utils::StateWriter& writer) const override;
+        void loadState(Utils::StateReader& reader) override;
+
+    private:
+        Byte m_bank = 0;
+
+        void updateBanks();
+    };
+}
+
+#endif //CAIQUE_NES_UXROM_HPP
@@ -21,12 +21,15 @@
 #include <QMessageBox>
 #include <QKeySequence>
 #include <QKeyEvent>
+#include "Core/RomIndex.hpp"
+#include "Utils/Log.hpp"
 #include "GameWidget.hpp"
 
-UserInterface::GameWidget::GameWidget(const std::string& romPath, QWidget* parent) :
+UserInterface::GameWidget::GameWidget(const std::string& romPath, QWidget* parent, const GameOptions& options) :
     QWidget(parent),
     m_virtualMachine(std::bind(&GameWidget::draw, this, std::placeholders::_1)),
-    m_frameRateBlocker(Nes::Const::frameRate),
+    m_pacingMode(options.pacingMode),
+    m_framePacer(Utils::Const::Pacing::ntscFrameRate),
     m_window(Graphics::Window::fromExternalSource(Utils::genericMemoryCast(winId()))),
     m_renderer(nullptr), // Render can only be created after m_window is confirmed to be valid later in constructor,
     m_screenTexture(nullptr) // Texture can only be created after m_renderer is confirmed to be valid later in constructor,
@@ -45,8 +48,14 @@ UserInterface::GameWidget::GameWidget(const std::string& romPath, QWidget* paren
         throw std::runtime_error("Unable to initialise SDL2 renderer");
     }
 
-    m_screenTexture = Graphics::Texture(m_renderer, Graphics::TextureFormat::ARGBBytes, Graphics::TextureAccess::Static,
+    m_screenTexture = Graphics::Texture(m_renderer, Graphics::TextureFormat::ARGBBytes, Graphics::TextureAccess::Streaming,
                                         Nes::Const::screenWidth, Nes::Const::screenHeight);
+    if (!m_screenTexture.isValid()) {
+        m_screenTexture = Graphics::Texture(m_renderer, Graphics::TextureFormat::ARGBBytes,
+                                            Graphics::TextureAccess::Static, Nes::Const::screenWidth,
+                                            Nes::Const::screenHeight);
+    }
+
     if (!m_screenTexture.isValid()) {
         throw std::runtime_error("Unable to initialise SDL2 texture");
     }
@@ -54,6 +63,17 @@ UserInterface::GameWidget::GameWidget(const std::string& romPath, QWidget* paren
     m_renderer.clear();
     m_renderer.present();
 
+    // Header corrections are a nicety, a ROM with a correct header runs the same without them
+    if (!options.romIndexPath.empty()) {
+        auto indexResult = Nes::RomIndex::loadFromFilesystem(options.romIndexPath);
+        if (indexResult.has_value()) {
+            m_virtualMachine.setRomIndex(std::make_shared<const Nes::RomIndex>(std::move(indexResult.value())));
+        } else {
+            QMessageBox::warning(this, "Warning", QString::fromStdString("Unable to load ROM index at: " +
+                                 options.romIndexPath + " due to " + indexResult.error()));
+        }
+    }
+
     auto romLoadResult = m_virtualMachine.loadRom(romPath);
     if (!romLoadResult.has_value()) {
         QMessageBox::critical(this, "Error", QString::fromStdString("Unable to load ROM file at: " + romPath +
@@ -61,6 +81,30 @@ UserInterface::GameWidget::GameWidget(const std::string& romPath, QWidget* paren
         QApplication::exit();
     }
 
+    // Playing with the game's own input lag is preferable to not playing at all
+    const auto runAheadResult = m_virtualMachine.setRunAhead(options.runAheadFrames);
+    if (!runAheadResult.has_value()) {
+        QMessageBox::warning(this, "Warning", QString::fromStdString("Unable to enable run-ahead due to " +
+                             runAheadResult.error()));
+    }
+
+    m_virtualMachine.setFrameTarget(&m_frames.writeBuffer());
+
+    // Playing without sound is preferable to not playing at all
+    if (m_audioDevice.isValid()) {
+        m_virtualMachine.setAudioCallback([this](std::span<const Utils::AudioSample> samples) {
+            (void) m_samples.push(samples);
+        });
+        m_audioDevice.setPaused(false);
+    } else {
+        Utils::log(std::string("Unable to open SDL2 audio device: ") + SDL_GetError());
+        m_pacingMode = PacingMode::FramePacer;
+    }
+
+    m_presentTimer.setTimerType(Qt::PreciseTimer);
+    connect(&m_presentTimer, &QTimer::timeout, this, &GameWidget::present);
+    m_presentTimer.start(Const::presentIntervalMs);
+
     m_emulatorThread = std::make_unique<std::thread>(&GameWidget::emulatorThreadFunction, this);
 }
 
@@ -71,14 +115,67 @@ UserInterface::GameWidget::~GameWidget() {
 
 void UserInterface::GameWidget::emulatorThreadFunction() {
     while (m_emulatorRunning) {
-        m_frameRateBlocker.startOfLoop();
-        m_virtualMachine.tick();
-        m_frameRateBlocker.endOfLoop();
+        applyFastForward();
+
+        // Rewinding restores the previous frame's state and replays it so that frame gets drawn again
+        if (m_rewinding) {
+            if (m_rewindBuffer.rewind(m_virtualMachine)) {
+                m_virtualMachine.tick();
+            }
+        } else {
+            m_rewindBuffer.capture(m_virtualMachine);
+            m_virtualMachine.tick();
+        }
+
+        waitForNextFrame();
     }
 }
 
-void UserInterface::GameWidget::draw(const Nes::FrameBuffer& frameBuffer) {
-    frameBuffer.copyToTexture(m_screenTexture);
+void UserInterface::GameWidget::waitForNextFrame() {
+    if (m_pacingMode == PacingMode::FramePacer || m_fastForwardApplied) {
+        m_framePacer.waitForNextFrame();
+        return;
+    }
+
+    // Measured right after the frame's samples were queued, before any waiting could bring the queue to the target
+    m_virtualMachine.setAudioRateRatio(m_rateControl.update(m_samples.size()));
+
+    // Clocks further apart than the ratio can make up for would eventually overflow the queue
+    while (m_samples.size() > Const::audioOverflowSamples && m_emulatorRunning) {
+        std::this_thread::sleep_for(Const::audioWaitInterval);
+    }
+
+    m_framePacer.waitForNextFrame();
+}
+
+// Requested from the UI thread but applied here, the virtual machine and pacer belong to the emulator thread
+void UserInterface::GameWidget::applyFastForward() {
+    const bool fastForwarding = m_fastForwarding;
+    if (fastForwarding == m_fastForwardApplied) {
+        return;
+    }
+
+    m_fastForwardApplied = fastForwarding;
+    m_virtualMachine.setFrameSkip(fastForwarding ? Const::fastForwardFrameSkip : 0);
+    m_virtualMachine.setAudioRateRatio(1.0);
+    m_rateControl.reset();
+    m_framePacer.setSpeedMultiplier(fastForwarding ? Const::fastForwardMultiplier : 1.0);
+}
+
+// The PPU renders straight into the triple buffer, publishing hands the finished frame over and a fresh buffer is
+// swapped in for the next one
+void UserInterface::GameWidget::draw(const Nes::FrameBuffer&) {
+    m_frames.publish();
+    m_virtualMachine.setFrameTarget(&m_frames.writeBuffer());
+}
+
+void UserInterface::GameWidget::present() {
+    if (!m_frames.consume()) {
+        return;
+    }
+
+    const auto& frameBuffer = m_frames.readBuffer();
+    m_screenTexture.update(frameBuffer.data(), frameBuffer.pitch());
 
     m_renderer.clear();
     m_renderer.copyTexture(m_screenTexture);
@@ -104,6 +201,10 @@ void UserInterface::GameWidget::keyPressEvent(QKeyEvent* event) {
         m_virtualMachine.handleKeyPress(Nes::JoypadButton::Left);
     } else if (key == "Right") {
         m_virtualMachine.handleKeyPress(Nes::JoypadButton::Right);
+    } else if (key == "Backspace") {
+        m_rewinding = true;
+    } else if (key == "Space") {
+        m_fastForwarding = true;
     }
 }
 
@@ -126,6 +227,10 @@ void UserInterface::GameWidget::keyReleaseEvent(QKeyEvent* event)  {
         m_virtualMachine.handleKeyRelease(Nes::JoypadButton::Left);
     } else if (key == "Right") {
         m_virtualMachine.handleKeyRelease(Nes::JoypadButton::Right);
+    } else if (key == "Backspace") {
+        m_rewinding = false;
+    } else if (key == "Space") {
+        m_fastForwarding = false;
     }
 }
 
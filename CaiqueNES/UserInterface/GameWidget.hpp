@@ -20,19 +20,60 @@
 #define CAIQUE_NES_GAMEWIDGET_HPP
 
 #include <QWidget>
+#include <QTimer>
 #include <thread>
 #include <atomic>
 #include <memory>
+#include "Audio/AudioDevice.hpp"
+#include "Core/RewindBuffer.hpp"
 #include "Core/VirtualMachine.hpp"
 #include "Graphics/Window.hpp"
 #include "Graphics/Renderer.hpp"
 #include "Graphics/Texture.hpp"
-#include "Graphics/Timing.hpp"
+#include "Utils/FramePacer.hpp"
+#include "Utils/RateControl.hpp"
+#include "Utils/TripleBuffer.hpp"
 
 namespace UserInterface {
+    namespace Const {
+        // Fast-forward emulates four times faster but keeps presenting at the normal rate
+        constexpr double fastForwardMultiplier = 4.0;
+        constexpr int fastForwardFrameSkip     = 3;
+
+        // Polled twice per emulated frame so a published frame waits at most half a frame to be presented
+        constexpr int presentIntervalMs = 1000 / (2 * Nes::Const::frameRate);
+
+        // Around ten frames of samples may queue up, the device pulls a bit over ten milliseconds at a time
+        constexpr int audioQueueSamples  = 8192;
+        constexpr int audioDeviceSamples = 512;
+
+        // Paced by the audio clock, the queue is kept around this level, which is roughly two device buffers ahead.
+        // Emulation only ever waits on the queue once it is twice as full.
+        constexpr std::size_t audioTargetSamples   = 4 * audioDeviceSamples;
+        constexpr std::size_t audioOverflowSamples = 2 * audioTargetSamples;
+        constexpr auto audioWaitInterval = std::chrono::milliseconds(1);
+    }
+
+    enum class PacingMode {
+        // Sleeps until each frame's deadline, audio follows along as well as the clocks agree
+        FramePacer,
+
+        // Follows the audio device's clock through the resampling ratio. Frames keep the pacer's timing and dynamic
+        // rate control produces slightly more or fewer samples per frame, so that the queue neither runs dry nor
+        // fills up. Falls back to the plain frame pacer without an audio device or while fast-forwarding.
+        AudioClock
+    };
+
+    // Chosen on the command line, see Application
+    struct GameOptions {
+        PacingMode  pacingMode     = PacingMode::AudioClock;
+        int         runAheadFrames = 0;
+        std::string romIndexPath;
+    };
+
     class GameWidget : public QWidget {
     public:
-        explicit GameWidget(const std::string& romPath, QWidget* parent);
+        GameWidget(const std::string& romPath, QWidget* parent, const GameOptions& options = {});
         ~GameWidget() override;
 
     private:
@@ -40,14 +81,33 @@ namespace UserInterface {
         std::unique_ptr<std::thread> m_emulatorThread;
         std::atomic<bool>            m_emulatorRunning = true;
 
-        Graphics::FrameRateBlocker m_frameRateBlocker;
+        Nes::RewindBuffer m_rewindBuffer;
+        std::atomic<bool> m_rewinding = false;
+
+        std::atomic<bool> m_fastForwarding = false;
+        bool m_fastForwardApplied = false;
+
+        PacingMode                 m_pacingMode;
+        Utils::FramePacer          m_framePacer;
+        Utils::DynamicRateControl  m_rateControl{Const::audioTargetSamples};
         Graphics::Window           m_window;
         Graphics::Renderer         m_renderer;
         Graphics::Texture          m_screenTexture;
 
+        // Frames travel from the emulator thread to the UI thread, which does the texture upload and present
+        Utils::TripleBuffer<Nes::FrameBuffer> m_frames;
+        QTimer m_presentTimer;
+
+        // Samples travel from the emulator thread to the audio device's thread
+        Audio::SampleQueue m_samples{Const::audioQueueSamples};
+        Audio::AudioDevice m_audioDevice{m_samples, Nes::Const::Audio::sampleRate, Const::audioDeviceSamples};
+
         void emulatorThreadFunction();
+        void applyFastForward();
+        void waitForNextFrame();
 
         void draw(const Nes::FrameBuffer& frameBuffer);
+        void present();
 
         void keyPressEvent(QKeyEvent* event) override;
         void keyReleaseEvent(QKeyEvent* event) override;
@@ -19,11 +19,11 @@
 #include "MainWindow.hpp"
 #include "ui_MainWindow.h"
 
-UserInterface::MainWindow::MainWindow(const std::string& romPath, QWidget* parent) :
+UserInterface::MainWindow::MainWindow(const std::string& romPath, const GameOptions& options, QWidget* parent) :
     QMainWindow(parent),
     ui(new Ui::MainWindow)
 {
-    m_graphicsWidget = std::make_unique<GameWidget>(romPath, this);
+    m_graphicsWidget = std::make_unique<GameWidget>(romPath, this, options);
 
     ui->setupUi(this);
     ui->centralwidget->layout()->addWidget(m_graphicsWidget.get());
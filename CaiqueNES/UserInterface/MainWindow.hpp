@@ -32,7 +32,7 @@ namespace UserInterface {
         Q_OBJECT
 
     public:
-        explicit MainWindow(const std::string& romPath, QWidget* parent = nullptr);
+        explicit MainWindow(const std::string& romPath, const GameOptions& options = {}, QWidget* parent = nullptr);
         ~MainWindow() override;
 
     private:
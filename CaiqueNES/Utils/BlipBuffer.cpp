@@ -0,0 +1,134 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include "Utils/BlipBuffer.hpp"
+
+namespace {
+    using Kernel = std::array<std::array<std::int32_t, Utils::Const::Blip::kernelWidth>, Utils::Const::Blip::phaseCount>;
+
+    // Blackman windowed sinc, cut off slightly below the output Nyquist frequency. Every phase is normalised to the
+    // exact unit so a step always settles on precisely its delta.
+    Kernel buildKernel() {
+        constexpr double cutoff     = 0.9;
+        constexpr double halfWidth  = Utils::Const::Blip::kernelWidth / 2.0;
+        constexpr std::int32_t unit = 1 << Utils::Const::Blip::kernelBits;
+
+        Kernel kernel{};
+        for (auto phase = 0; phase < Utils::Const::Blip::phaseCount; phase++) {
+            std::array<double, Utils::Const::Blip::kernelWidth> taps{};
+            double sum = 0.0;
+
+            for (auto i = 0; i < Utils::Const::Blip::kernelWidth; i++) {
+                const double t = i - halfWidth + 1.0 - static_cast<double>(phase) / Utils::Const::Blip::phaseCount;
+                const double x = std::numbers::pi * cutoff * t;
+                const double sinc   = x == 0.0 ? 1.0 : std::sin(x) / x;
+                const double window = 0.42 + 0.5 * std::cos(std::numbers::pi * t / halfWidth) +
+                                      0.08 * std::cos(2.0 * std::numbers::pi * t / halfWidth);
+
+                taps[i] = sinc * window;
+                sum += taps[i];
+            }
+
+            std::int32_t total = 0;
+            for (auto i = 0; i < Utils::Const::Blip::kernelWidth; i++) {
+                kernel[phase][i] = static_cast<std::int32_t>(std::lround(taps[i] / sum * unit));
+                total += kernel[phase][i];
+            }
+
+            kernel[phase][Utils::Const::Blip::kernelWidth / 2 - 1] += unit - total;
+        }
+
+        return kernel;
+    }
+
+    const Kernel& kernel() {
+        static const Kernel instance = buildKernel();
+        return instance;
+    }
+}
+
+Utils::BlipBuffer::BlipBuffer(double clockRate, int sampleRate, std::size_t sampleCapacity) :
+    m_buffer(sampleCapacity + Const::Blip::kernelWidth, 0)
+{
+    setRates(clockRate, sampleRate);
+}
+
+void Utils::BlipBuffer::setRates(double clockRate, int sampleRate) {
+    m_factor = static_cast<std::uint64_t>(std::llround(sampleRate / clockRate * std::ldexp(1.0, Const::Blip::timeBits)));
+}
+
+void Utils::BlipBuffer::addDelta(std::uint64_t clockTime, int delta) {
+    const auto position = m_offset + clockTime * m_factor;
+    const auto index    = static_cast<std::size_t>(position >> Const::Blip::timeBits);
+    const auto phase    = (position >> (Const::Blip::timeBits - Const::Blip::phaseBits)) & (Const::Blip::phaseCount - 1);
+
+    // Only possible when a frame runs far longer than the capacity, the step is lost rather than overrunning
+    if (index + Const::Blip::kernelWidth > m_buffer.size()) {
+        return;
+    }
+
+    const auto& taps = kernel()[phase];
+    auto* destination = m_buffer.data() + index;
+    for (auto i = 0; i < Const::Blip::kernelWidth; i++) {
+        destination[i] += taps[i] * delta;
+    }
+}
+
+void Utils::BlipBuffer::endFrame(std::uint64_t clockDuration) {
+    m_offset += clockDuration * m_factor;
+
+    const auto limit = static_cast<std::uint64_t>(m_buffer.size() - Const::Blip::kernelWidth) << Const::Blip::timeBits;
+    m_offset = std::min(m_offset, limit);
+}
+
+std::size_t Utils::BlipBuffer::samplesAvailable() const {
+    return static_cast<std::size_t>(m_offset >> Const::Blip::timeBits);
+}
+
+// Integrates the steps back into a waveform, the leaky integrator doubles as the high-pass
+std::size_t Utils::BlipBuffer::readSamples(std::span<AudioSample> destination) {
+    const auto count = std::min(samplesAvailable(), destination.size());
+
+    for (std::size_t i = 0; i < count; i++) {
+        m_integrator += m_buffer[i];
+
+        const auto sample = m_integrator >> Const::Blip::kernelBits;
+        m_integrator -= sample << (Const::Blip::kernelBits - Const::Blip::bassShift);
+
+        destination[i] = static_cast<AudioSample>(std::clamp<std::int64_t>(sample, std::numeric_limits<AudioSample>::min(),
+                                                                           std::numeric_limits<AudioSample>::max()));
+    }
+
+    const auto remaining = samplesAvailable() + Const::Blip::kernelWidth;
+    std::copy(m_buffer.begin() + count, m_buffer.begin() + remaining, m_buffer.begin());
+    std::fill(m_buffer.begin() + (remaining - count), m_buffer.begin() + remaining, 0);
+
+    m_offset -= static_cast<std::uint64_t>(count) << Const::Blip::timeBits;
+    return count;
+}
+
+void Utils::BlipBuffer::clear() {
+    std::fill(m_buffer.begin(), m_buffer.end(), 0);
+    m_offset     = 0;
+    m_integrator = 0;
+}
@@ -0,0 +1,70 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#ifndef CAIQUE_NES_BLIPBUFFER_HPP
+#define CAIQUE_NES_BLIPBUFFER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Utils {
+    namespace Const::Blip {
+        // Sub-sample resolution of a step and the width of its band-limited kernel, in output samples
+        constexpr int phaseBits = 5;
+        constexpr int phaseCount = 1 << phaseBits;
+        constexpr int kernelWidth = 16;
+
+        constexpr int kernelBits = 13;
+        constexpr int timeBits   = 32;
+
+        // Strength of the high-pass which keeps the output centred around zero
+        constexpr int bassShift = 9;
+    }
+
+    using AudioSample = std::int16_t;
+
+    // Band-limited step synthesis. The source only reports amplitude changes at its own clock, each one is spread
+    // over the surrounding output samples as a windowed sinc step, which resamples without aliasing and costs nothing
+    // while the amplitude stays constant. Times are counted in source clocks since the start of the current frame.
+    class BlipBuffer {
+    public:
+        BlipBuffer(double clockRate, int sampleRate, std::size_t sampleCapacity);
+
+        void setRates(double clockRate, int sampleRate);
+
+        void addDelta(std::uint64_t clockTime, int delta);
+
+        // Completes the frame after the given number of clocks, its samples become readable
+        void endFrame(std::uint64_t clockDuration);
+
+        std::size_t samplesAvailable() const;
+        std::size_t readSamples(std::span<AudioSample> destination);
+
+        void clear();
+
+    private:
+        std::vector<std::int32_t> m_buffer;
+        std::uint64_t m_factor = 0;
+        std::uint64_t m_offset = 0;
+        std::int64_t  m_integrator = 0;
+    };
+}
+
+#endif //CAIQUE_NES_BLIPBUFFER_HPP
@@ -0,0 +1,217 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include "Utils/Checksum.hpp"
+
+namespace {
+    constexpr std::uint32_t crc32Polynomial = 0xEDB88320;
+    constexpr std::uint32_t adler32Modulo   = 65521;
+
+    constexpr std::uint64_t fnvOffsetBasis = 0xCBF29CE484222325;
+    constexpr std::uint64_t fnvPrime       = 0x00000100000001B3;
+
+    constexpr std::array<std::uint32_t, 5> sha1InitialState = {
+        0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0
+    };
+
+    // Table n gives the CRC of a byte followed by n zero bytes, which lets crc32 consume eight bytes per step
+    // ("slicing-by-8") instead of one
+    constexpr std::array<std::array<std::uint32_t, 256>, 8> createCrc32Tables() {
+        std::array<std::array<std::uint32_t, 256>, 8> tables{};
+        for (std::uint32_t i = 0; i < 256; i++) {
+            std::uint32_t value = i;
+            for (auto bit = 0; bit < 8; bit++) {
+                value = (value & 1) ? (value >> 1) ^ crc32Polynomial : value >> 1;
+            }
+
+            tables[0][i] = value;
+        }
+
+        for (std::uint32_t i = 0; i < 256; i++) {
+            for (std::size_t slice = 1; slice < tables.size(); slice++) {
+                const auto previous = tables[slice - 1][i];
+                tables[slice][i] = tables[0][previous & 0xFF] ^ (previous >> 8);
+            }
+        }
+
+        return tables;
+    }
+
+    constexpr auto crc32Tables = createCrc32Tables();
+
+    std::uint32_t rotateLeft(std::uint32_t value, int count) {
+        return (value << count) | (value >> (32 - count));
+    }
+
+    std::uint32_t readBigEndian(const std::uint8_t* bytes) {
+        return (bytes[0] << 24) | (bytes[1] << 16) | (bytes[2] << 8) | bytes[3];
+    }
+}
+
+std::uint32_t Utils::crc32(const std::uint8_t* data, std::size_t size, std::uint32_t initialValue) {
+    const auto& t = crc32Tables;
+
+    std::uint32_t crc = ~initialValue;
+    for (; size >= 8; data += 8, size -= 8) {
+        const std::uint32_t low  = crc ^ (data[0] | (data[1] << 8) | (data[2] << 16) | (data[3] << 24));
+        const std::uint32_t high = data[4] | (data[5] << 8) | (data[6] << 16) | (data[7] << 24);
+
+        crc = t[7][low & 0xFF] ^ t[6][(low >> 8) & 0xFF] ^ t[5][(low >> 16) & 0xFF] ^ t[4][low >> 24] ^
+              t[3][high & 0xFF] ^ t[2][(high >> 8) & 0xFF] ^ t[1][(high >> 16) & 0xFF] ^ t[0][high >> 24];
+    }
+
+    for (; size > 0; data++, size--) {
+        crc = t[0][(crc ^ *data) & 0xFF] ^ (crc >> 8);
+    }
+
+    return ~crc;
+}
+
+std::uint32_t Utils::adler32(const std::uint8_t* data, std::size_t size, std::uint32_t initialValue) {
+    std::uint32_t lower = initialValue & 0xFFFF;
+    std::uint32_t upper = initialValue >> 16;
+    for (std::size_t i = 0; i < size; i++) {
+        lower = (lower + data[i]) % adler32Modulo;
+        upper = (upper + lower) % adler32Modulo;
+    }
+
+    return (upper << 16) | lower;
+}
+
+std::uint64_t Utils::fnv1a64(const std::uint8_t* data, std::size_t size) {
+    std::uint64_t hash = fnvOffsetBasis;
+    for (std::size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= fnvPrime;
+    }
+
+    return hash;
+}
+
+Utils::Sha1::Sha1() :
+    m_state(sha1InitialState)
+{
+}
+
+void Utils::Sha1::update(const std::uint8_t* data, std::size_t size) {
+    m_length += size;
+
+    if (m_blockSize > 0) {
+        const auto taken = std::min(size, m_block.size() - m_blockSize);
+        std::copy_n(data, taken, m_block.begin() + m_blockSize);
+        m_blockSize += taken;
+        data        += taken;
+        size        -= taken;
+
+        if (m_blockSize < m_block.size()) {
+            return;
+        }
+
+        processBlock(m_block.data());
+        m_blockSize = 0;
+    }
+
+    // Whole blocks are hashed straight from the input
+    for (; size >= m_block.size(); data += m_block.size(), size -= m_block.size()) {
+        processBlock(data);
+    }
+
+    std::copy_n(data, size, m_block.begin());
+    m_blockSize = size;
+}
+
+Utils::Sha1Digest Utils::Sha1::digest() {
+    const std::uint64_t lengthInBits = m_length * 8;
+
+    // A single 1 bit, zeroes up to the last 8 bytes of a block and the message length
+    const std::uint8_t padding = 0x80;
+    update(&padding, 1);
+
+    const std::uint8_t zero = 0x00;
+    while (m_blockSize != m_block.size() - sizeof(lengthInBits)) {
+        update(&zero, 1);
+    }
+
+    std::array<std::uint8_t, sizeof(lengthInBits)> lengthBytes{};
+    for (std::size_t i = 0; i < lengthBytes.size(); i++) {
+        lengthBytes[i] = lengthInBits >> (8 * (lengthBytes.size() - 1 - i));
+    }
+
+    update(lengthBytes.data(), lengthBytes.size());
+
+    Sha1Digest digest{};
+    for (std::size_t i = 0; i < m_state.size(); i++) {
+        for (auto byte = 0; byte < 4; byte++) {
+            digest[i * 4 + byte] = m_state[i] >> (24 - byte * 8);
+        }
+    }
+
+    return digest;
+}
+
+void Utils::Sha1::processBlock(const std::uint8_t* block) {
+    std::array<std::uint32_t, 80> words{};
+    for (auto i = 0; i < 16; i++) {
+        words[i] = readBigEndian(block + i * 4);
+    }
+
+    for (auto i = 16; i < 80; i++) {
+        words[i] = rotateLeft(words[i - 3] ^ words[i - 8] ^ words[i - 14] ^ words[i - 16], 1);
+    }
+
+    auto [a, b, c, d, e] = m_state;
+    for (auto i = 0; i < 80; i++) {
+        std::uint32_t f = 0;
+        std::uint32_t k = 0;
+        if (i < 20) {
+            f = (b & c) | (~b & d);
+            k = 0x5A827999;
+        } else if (i < 40) {
+            f = b ^ c ^ d;
+            k = 0x6ED9EBA1;
+        } else if (i < 60) {
+            f = (b & c) | (b & d) | (c & d);
+            k = 0x8F1BBCDC;
+        } else {
+            f = b ^ c ^ d;
+            k = 0xCA62C1D6;
+        }
+
+        const auto temp = rotateLeft(a, 5) + f + e + k + words[i];
+        e = d;
+        d = c;
+        c = rotateLeft(b, 30);
+        b = a;
+        a = temp;
+    }
+
+    m_state[0] += a;
+    m_state[1] += b;
+    m_state[2] += c;
+    m_state[3] += d;
+    m_state[4] += e;
+}
+
+Utils::Sha1Digest Utils::sha1(const std::uint8_t* data, std::size_t size) {
+    Sha1 hash;
+    hash.update(data, size);
+
+    return hash.digest();
+}
@@ -0,0 +1,57 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#ifndef CAIQUE_NES_CHECKSUM_HPP
+#define CAIQUE_NES_CHECKSUM_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Utils {
+    // CRC-32 as used by zlib/PNG, pass the previous result as initialValue to continue a running checksum
+    std::uint32_t crc32(const std::uint8_t* data, std::size_t size, std::uint32_t initialValue = 0);
+
+    std::uint32_t adler32(const std::uint8_t* data, std::size_t size, std::uint32_t initialValue = 1);
+
+    // 64-bit FNV-1a, cheap enough to hash every frame
+    std::uint64_t fnv1a64(const std::uint8_t* data, std::size_t size);
+
+    using Sha1Digest = std::array<std::uint8_t, 20>;
+
+    // SHA-1 fed in pieces, as ROM databases identify dumps by it
+    class Sha1 {
+    public:
+        Sha1();
+
+        void update(const std::uint8_t* data, std::size_t size);
+        Sha1Digest digest();
+
+    private:
+        std::array<std::uint32_t, 5> m_state;
+        std::array<std::uint8_t, 64> m_block{};
+        std::size_t   m_blockSize = 0;
+        std::uint64_t m_length    = 0;
+
+        void processBlock(const std::uint8_t* block);
+    };
+
+    Sha1Digest sha1(const std::uint8_t* data, std::size_t size);
+}
+
+#endif //CAIQUE_NES_CHECKSUM_HPP
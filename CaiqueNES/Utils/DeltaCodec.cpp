@@ -0,0 +1,107 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <algorithm>
+#include "Utils/DeltaCodec.hpp"
+
+namespace {
+    constexpr std::uint8_t varintPayloadMask  = 0x7F;
+    constexpr std::uint8_t varintContinueFlag = 0x80;
+    constexpr int varintPayloadBits           = 7;
+    constexpr int varintMaxBytes              = 5;
+
+    void writeVarint(std::vector<std::uint8_t>& output, std::size_t value) {
+        while (value > varintPayloadMask) {
+            output.push_back(static_cast<std::uint8_t>(value & varintPayloadMask) | varintContinueFlag);
+            value >>= varintPayloadBits;
+        }
+
+        output.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    bool readVarint(std::span<const std::uint8_t> input, std::size_t& offset, std::size_t& value) {
+        value = 0;
+        for (auto i = 0; i < varintMaxBytes && offset < input.size(); i++) {
+            const auto byte = input[offset++];
+            value |= static_cast<std::size_t>(byte & varintPayloadMask) << (i * varintPayloadBits);
+
+            if (!(byte & varintContinueFlag)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+}
+
+void Utils::encodeDelta(std::span<const std::uint8_t> base, std::span<const std::uint8_t> target,
+                        std::vector<std::uint8_t>& delta) {
+    delta.clear();
+
+    std::size_t i = 0;
+    while (i < target.size()) {
+        const auto zeroStart = i;
+        while (i < target.size() && base[i] == target[i]) {
+            i++;
+        }
+
+        const auto literalStart = i;
+        while (i < target.size() && base[i] != target[i]) {
+            i++;
+        }
+
+        writeVarint(delta, literalStart - zeroStart);
+        writeVarint(delta, i - literalStart);
+        for (auto j = literalStart; j < i; j++) {
+            delta.push_back(base[j] ^ target[j]);
+        }
+    }
+}
+
+bool Utils::decodeDelta(std::span<const std::uint8_t> base, std::span<const std::uint8_t> delta,
+                        std::span<std::uint8_t> target) {
+    if (base.size() != target.size()) {
+        return false;
+    }
+
+    std::size_t deltaOffset  = 0;
+    std::size_t targetOffset = 0;
+    while (deltaOffset < delta.size()) {
+        std::size_t zeroRun    = 0;
+        std::size_t literalRun = 0;
+        if (!readVarint(delta, deltaOffset, zeroRun) || !readVarint(delta, deltaOffset, literalRun)) {
+            return false;
+        }
+
+        if (zeroRun > target.size() - targetOffset || literalRun > target.size() - targetOffset - zeroRun ||
+            literalRun > delta.size() - deltaOffset) {
+            return false;
+        }
+
+        std::copy_n(base.begin() + targetOffset, zeroRun, target.begin() + targetOffset);
+        targetOffset += zeroRun;
+
+        for (std::size_t i = 0; i < literalRun; i++, targetOffset++) {
+            target[targetOffset] = base[targetOffset] ^ delta[deltaOffset++];
+        }
+    }
+
+    std::copy(base.begin() + targetOffset, base.end(), target.begin() + targetOffset);
+
+    return true;
+}
@@ -16,31 +16,22 @@
 *
 ***********************************************************************************************************************/
 
-#include "Tile.hpp"
-#include "Utils/Data.hpp"
-
-Nes::Tile::Tile(std::array<Byte, Const::tileSize> bytes, const Palette& palette) :
-    m_bytes(std::move(bytes)),
-    m_palette(palette)
-{
-}
-
-bool Nes::Tile::skipDrawingSpritePixel(int x, int y) const {
-    return getColorId(x, y) == 0;
-}
-
-Graphics::PixelColor Nes::Tile::getColor(int x, int y) const {
-    const auto colorId = getColorId(x, y);
-    return m_palette.getColor(colorId);
+#ifndef CAIQUE_NES_DELTACODEC_HPP
+#define CAIQUE_NES_DELTACODEC_HPP
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Utils {
+    // XORs target against base and run-length encodes the result as alternating (zero run, literal run) pairs with
+    // LEB128 lengths. Both inputs must have the same size. The output buffer is cleared, its capacity is kept.
+    void encodeDelta(std::span<const std::uint8_t> base, std::span<const std::uint8_t> target,
+                     std::vector<std::uint8_t>& delta);
+
+    // Rebuilds target into the given buffer, which must be as large as base. Returns false on malformed input.
+    bool decodeDelta(std::span<const std::uint8_t> base, std::span<const std::uint8_t> delta,
+                     std::span<std::uint8_t> target);
 }
 
-int Nes::Tile::getColorId(int x, int y) const {
-    const auto shiftMagnitude = (Const::tileDimension - 1) - x;
-
-    const Byte lower = m_bytes[y]                        >> shiftMagnitude;
-    const Byte upper = m_bytes[y + Const::tileDimension] >> shiftMagnitude;
-
-    const auto colorId = Utils::combineBits(Utils::isBitSet(upper, 0), Utils::isBitSet(lower, 0));
-
-    return colorId;
-}
+#endif //CAIQUE_NES_DELTACODEC_HPP
@@ -0,0 +1,122 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <algorithm>
+#include <thread>
+#include "Utils/FramePacer.hpp"
+
+Utils::FramePacer::FramePacer(double frameRate) :
+    m_frameRate(frameRate)
+{
+}
+
+void Utils::FramePacer::setFrameRate(double frameRate) {
+    m_frameRate = frameRate;
+    m_started   = false;
+}
+
+void Utils::FramePacer::setRefreshRate(RefreshRate refreshRate) {
+    setFrameRate(refreshRate == RefreshRate::PAL ? Const::Pacing::palFrameRate : Const::Pacing::ntscFrameRate);
+}
+
+void Utils::FramePacer::setSpeedMultiplier(double multiplier) {
+    m_speedMultiplier = std::max(multiplier, 0.0);
+    m_started         = false;
+}
+
+void Utils::FramePacer::waitForNextFrame() {
+    auto now = Clock::now();
+
+    if (m_speedMultiplier == 0.0 || !m_started) {
+        m_started  = true;
+        m_deadline = now;
+        recordFrame(now, std::chrono::nanoseconds{0}, std::chrono::nanoseconds{0});
+        return;
+    }
+
+    const auto period = framePeriod();
+    m_deadline += period;
+
+    std::chrono::nanoseconds dropped{0};
+    if (now > m_deadline + Const::Pacing::maximumLagFrames * period) {
+        dropped    = now - m_deadline;
+        m_deadline = now;
+    } else {
+        sleepUntil(m_deadline);
+        now = Clock::now();
+    }
+
+    recordFrame(now, now - m_deadline, dropped);
+}
+
+void Utils::FramePacer::reset() {
+    m_started   = false;
+    m_lastFrame = {};
+
+    std::lock_guard lock(m_statisticsMutex);
+    m_statistics     = {};
+    m_totalFrameTime = std::chrono::nanoseconds{0};
+}
+
+Utils::FrameTimingStatistics Utils::FramePacer::statistics() const {
+    std::lock_guard lock(m_statisticsMutex);
+    return m_statistics;
+}
+
+Utils::FramePacer::Clock::duration Utils::FramePacer::framePeriod() const {
+    const std::chrono::duration<double> period(1.0 / (m_frameRate * m_speedMultiplier));
+    return std::chrono::duration_cast<Clock::duration>(period);
+}
+
+void Utils::FramePacer::recordFrame(Clock::time_point now, std::chrono::nanoseconds lateness,
+                                    std::chrono::nanoseconds dropped) {
+    const auto previousFrame = m_lastFrame;
+    m_lastFrame = now;
+
+    std::lock_guard lock(m_statisticsMutex);
+    m_statistics.lastLateness = lateness;
+    m_statistics.droppedTime += dropped;
+
+    // The first frame only establishes the starting point
+    if (previousFrame == Clock::time_point{}) {
+        return;
+    }
+
+    const std::chrono::nanoseconds frameTime = now - previousFrame;
+    m_statistics.minimumFrameTime = m_statistics.frameCount == 0 ? frameTime :
+                                    std::min(m_statistics.minimumFrameTime, frameTime);
+    m_statistics.maximumFrameTime = std::max(m_statistics.maximumFrameTime, frameTime);
+
+    m_statistics.frameCount++;
+    m_totalFrameTime += frameTime;
+    m_statistics.averageFrameTime = m_totalFrameTime / m_statistics.frameCount;
+
+    const auto bucket = std::min<std::int64_t>(frameTime / Const::Pacing::histogramBucketWidth,
+                                               Const::Pacing::histogramBucketCount - 1);
+    m_statistics.histogram[bucket]++;
+}
+
+void Utils::FramePacer::sleepUntil(Clock::time_point deadline) {
+    if (deadline - Clock::now() > Const::Pacing::spinThreshold) {
+        std::this_thread::sleep_until(deadline - Const::Pacing::spinThreshold);
+    }
+
+    while (Clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+}
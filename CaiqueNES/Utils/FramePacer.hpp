@@ -0,0 +1,104 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#ifndef CAIQUE_NES_FRAMEPACER_HPP
+#define CAIQUE_NES_FRAMEPACER_HPP
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+namespace Utils {
+    namespace Const::Pacing {
+        constexpr double ntscFrameRate = 60.0988;
+        constexpr double palFrameRate  = 50.0070;
+
+        // Sleeping is only trusted up to this close to the deadline, the rest is spun away
+        constexpr std::chrono::microseconds spinThreshold{2000};
+
+        // Falling further behind than this many frames drops the backlog instead of racing to catch up
+        constexpr int maximumLagFrames = 4;
+
+        constexpr std::chrono::microseconds histogramBucketWidth{500};
+        constexpr int histogramBucketCount = 64;
+    }
+
+    enum class RefreshRate {
+        NTSC,
+        PAL
+    };
+
+    using FrameTimeHistogram = std::array<std::uint64_t, Const::Pacing::histogramBucketCount>;
+
+    struct FrameTimingStatistics {
+        std::uint64_t frameCount = 0;
+
+        std::chrono::nanoseconds minimumFrameTime{0};
+        std::chrono::nanoseconds maximumFrameTime{0};
+        std::chrono::nanoseconds averageFrameTime{0};
+
+        // How late the last frame was released and the total time given up by resynchronising after stalls
+        std::chrono::nanoseconds lastLateness{0};
+        std::chrono::nanoseconds droppedTime{0};
+
+        // Frame times in buckets of histogramBucketWidth, the last bucket holds everything longer
+        FrameTimeHistogram histogram{};
+    };
+
+    // Paces a loop against absolute deadlines advanced by exactly one period per frame, so rounding never adds up to
+    // drift. Waiting sleeps for the bulk of the remaining time and spins for the last stretch.
+    class FramePacer {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        explicit FramePacer(double frameRate = Const::Pacing::ntscFrameRate);
+
+        void setFrameRate(double frameRate);
+        void setRefreshRate(RefreshRate refreshRate);
+
+        // Scales the frame rate, 0 runs unthrottled
+        void setSpeedMultiplier(double multiplier);
+
+        // Blocks until the deadline of the next frame, called once per emulated frame
+        void waitForNextFrame();
+        void reset();
+
+        // Safe to call from any thread
+        FrameTimingStatistics statistics() const;
+
+    private:
+        double m_frameRate;
+        double m_speedMultiplier = 1.0;
+
+        bool m_started = false;
+        Clock::time_point m_deadline{};
+        Clock::time_point m_lastFrame{};
+
+        mutable std::mutex m_statisticsMutex;
+        FrameTimingStatistics m_statistics{};
+        std::chrono::nanoseconds m_totalFrameTime{0};
+
+        Clock::duration framePeriod() const;
+        void recordFrame(Clock::time_point now, std::chrono::nanoseconds lateness, std::chrono::nanoseconds dropped);
+
+        static void sleepUntil(Clock::time_point deadline);
+    };
+}
+
+#endif //CAIQUE_NES_FRAMEPACER_HPP
@@ -17,7 +17,6 @@
 ***********************************************************************************************************************/
 
 #include <stdexcept>
-#include <iterator>
 #include <fstream>
 #include "Utils/Host.hpp"
 
@@ -27,18 +26,12 @@ std::expected<std::vector<std::uint8_t>, Utils::ErrorString> Utils::loadExternal
         return std::unexpected("unable to open file at: " + path);
     }
 
-    file.unsetf(std::ios::skipws);
-
     file.seekg(0, std::ios::end);
     const std::size_t file_size = file.tellg();
     file.seekg(0, std::ios::beg);
 
-    std::vector<std::uint8_t> bytes;
-    bytes.reserve(file_size);
-
-    try {
-        bytes.insert(bytes.begin(), std::istream_iterator<std::uint8_t>(file), std::istream_iterator<std::uint8_t>());
-    } catch (const std::exception& e) {
+    std::vector<std::uint8_t> bytes(file_size);
+    if (!file.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(file_size))) {
         return std::unexpected("unable to read file at: " + path);
     }
 
@@ -0,0 +1,114 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <fstream>
+#include <utility>
+#include "Utils/MappedFile.hpp"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+std::expected<Utils::MappedFile, Utils::ErrorString> Utils::MappedFile::open(const std::string& path) {
+    MappedFile file;
+
+#ifndef _WIN32
+    const int descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        return std::unexpected("unable to open file at: " + path);
+    }
+
+    struct stat status{};
+    if (::fstat(descriptor, &status) != 0) {
+        ::close(descriptor);
+        return std::unexpected("unable to read file at: " + path);
+    }
+
+    file.m_size = static_cast<std::size_t>(status.st_size);
+
+    // Mapping nothing is an error, an empty file is simply left unmapped
+    if (file.m_size > 0) {
+        void* mapping = ::mmap(nullptr, file.m_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (mapping == MAP_FAILED) {
+            ::close(descriptor);
+            return std::unexpected("unable to map file at: " + path);
+        }
+
+        file.m_data = static_cast<const std::uint8_t*>(mapping);
+    }
+
+    // The mapping stays valid without the descriptor
+    ::close(descriptor);
+#else
+    std::ifstream stream(path, std::ios::binary | std::ios::ate);
+    if (!stream.good()) {
+        return std::unexpected("unable to open file at: " + path);
+    }
+
+    file.m_fallback.resize(static_cast<std::size_t>(stream.tellg()));
+    stream.seekg(0, std::ios::beg);
+    if (!stream.read(reinterpret_cast<char*>(file.m_fallback.data()), file.m_fallback.size())) {
+        return std::unexpected("unable to read file at: " + path);
+    }
+
+    file.m_data = file.m_fallback.data();
+    file.m_size = file.m_fallback.size();
+#endif
+
+    return file;
+}
+
+Utils::MappedFile::MappedFile(MappedFile&& other) noexcept :
+    m_data(std::exchange(other.m_data, nullptr)),
+    m_size(std::exchange(other.m_size, 0)),
+    m_fallback(std::move(other.m_fallback))
+{
+}
+
+Utils::MappedFile& Utils::MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        unmap();
+        m_data     = std::exchange(other.m_data, nullptr);
+        m_size     = std::exchange(other.m_size, 0);
+        m_fallback = std::move(other.m_fallback);
+    }
+
+    return *this;
+}
+
+Utils::MappedFile::~MappedFile() {
+    unmap();
+}
+
+std::span<const std::uint8_t> Utils::MappedFile::bytes() const {
+    return {m_data, m_size};
+}
+
+void Utils::MappedFile::unmap() {
+#ifndef _WIN32
+    if (m_data != nullptr) {
+        ::munmap(const_cast<std::uint8_t*>(m_data), m_size);
+    }
+#endif
+
+    m_data = nullptr;
+    m_size = 0;
+}
@@ -0,0 +1,57 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#ifndef CAIQUE_NES_MAPPEDFILE_HPP
+#define CAIQUE_NES_MAPPEDFILE_HPP
+
+#include <cstdint>
+#include <expected>
+#include <span>
+#include <string>
+#include <vector>
+#include "Types.hpp"
+
+namespace Utils {
+    // Read-only view of a whole file. The file is memory mapped where the host allows it, so pages are only read
+    // once touched and are shared with every other mapping of the same file.
+    class MappedFile {
+    public:
+        static std::expected<MappedFile, ErrorString> open(const std::string& path);
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+        ~MappedFile();
+
+        std::span<const std::uint8_t> bytes() const;
+
+    private:
+        MappedFile() = default;
+
+        const std::uint8_t* m_data = nullptr;
+        std::size_t         m_size = 0;
+
+        // Hosts without mmap read the file into memory instead
+        std::vector<std::uint8_t> m_fallback{};
+
+        void unmap();
+    };
+}
+
+#endif //CAIQUE_NES_MAPPEDFILE_HPP
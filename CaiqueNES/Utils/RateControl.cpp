@@ -0,0 +1,47 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <algorithm>
+#include "Utils/RateControl.hpp"
+
+Utils::DynamicRateControl::DynamicRateControl(std::size_t targetFill, double maximumDeviation) :
+    m_targetFill(std::max<std::size_t>(targetFill, 1)),
+    m_maximumDeviation(maximumDeviation),
+    m_averageFill(static_cast<double>(m_targetFill))
+{
+}
+
+double Utils::DynamicRateControl::ratio(std::size_t fill) const {
+    const auto target = static_cast<double>(m_targetFill);
+    const auto error  = std::clamp((target - static_cast<double>(fill)) / target, -1.0, 1.0);
+
+    return 1.0 + m_maximumDeviation * error;
+}
+
+double Utils::DynamicRateControl::update(std::size_t fill) {
+    m_averageFill += (static_cast<double>(fill) - m_averageFill) / Const::RateControl::averagedMeasurements;
+    return ratio(static_cast<std::size_t>(m_averageFill));
+}
+
+void Utils::DynamicRateControl::reset() {
+    m_averageFill = static_cast<double>(m_targetFill);
+}
+
+std::size_t Utils::DynamicRateControl::targetFill() const {
+    return m_targetFill;
+}
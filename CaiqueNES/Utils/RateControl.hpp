@@ -0,0 +1,56 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#ifndef CAIQUE_NES_RATECONTROL_HPP
+#define CAIQUE_NES_RATECONTROL_HPP
+
+#include <cstddef>
+
+namespace Utils {
+    namespace Const::RateControl {
+        // Small enough for the pitch change to go unnoticed
+        constexpr double maximumDeviation = 0.005;
+
+        // Devices drain the queue in bursts, a single measurement is off by up to a device buffer
+        constexpr int averagedMeasurements = 16;
+    }
+
+    // Dynamic rate control. The emulator's and the audio device's clocks never agree exactly, so instead of letting the
+    // sample queue slowly run dry or overflow the resampling ratio is nudged towards keeping it at a target fill level.
+    class DynamicRateControl {
+    public:
+        explicit DynamicRateControl(std::size_t targetFill,
+                                    double maximumDeviation = Const::RateControl::maximumDeviation);
+
+        // Samples to produce per nominal sample, above 1 while the queue is below its target and below 1 above it
+        double ratio(std::size_t fill) const;
+
+        // Ratio for the fill averaged over the recent measurements, meant to be called once per emulated frame
+        double update(std::size_t fill);
+        void reset();
+
+        std::size_t targetFill() const;
+
+    private:
+        std::size_t m_targetFill;
+        double      m_maximumDeviation;
+        double      m_averageFill;
+    };
+}
+
+#endif //CAIQUE_NES_RATECONTROL_HPP
@@ -0,0 +1,57 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#ifndef CAIQUE_NES_RINGBUFFER_HPP
+#define CAIQUE_NES_RINGBUFFER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace Utils {
+    // Lock-free FIFO between a single producer and a single consumer. Neither side ever waits: pushing into a full
+    // buffer keeps only what fits and popping from an empty one returns nothing. The capacity is rounded up to a
+    // power of two so positions wrap with a mask, both positions only ever grow.
+    template <typename T>
+    class RingBuffer {
+    public:
+        explicit RingBuffer(std::size_t capacity);
+
+        /* Producer */
+        std::size_t push(std::span<const T> values);
+
+        /* Consumer */
+        std::size_t pop(std::span<T> destination);
+
+        // Only exact from the producer or consumer thread, the other side may move it at any time
+        std::size_t size() const;
+        std::size_t capacity() const;
+
+    private:
+        std::vector<T> m_values;
+        std::size_t    m_mask;
+
+        alignas(64) std::atomic<std::size_t> m_writePosition = 0;
+        alignas(64) std::atomic<std::size_t> m_readPosition  = 0;
+    };
+}
+
+#include "Utils/RingBuffer.tpp"
+
+#endif //CAIQUE_NES_RINGBUFFER_HPP
@@ -0,0 +1,71 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#ifndef CAIQUE_NES_RINGBUFFER_TPP
+#define CAIQUE_NES_RINGBUFFER_TPP
+
+#include <algorithm>
+#include <bit>
+#include "Utils/RingBuffer.hpp"
+
+template <typename T>
+Utils::RingBuffer<T>::RingBuffer(std::size_t capacity) :
+    m_values(std::bit_ceil(std::max<std::size_t>(capacity, 1))),
+    m_mask(m_values.size() - 1)
+{
+}
+
+template <typename T>
+std::size_t Utils::RingBuffer<T>::push(std::span<const T> values) {
+    const auto writePosition = m_writePosition.load(std::memory_order_relaxed);
+    const auto readPosition  = m_readPosition.load(std::memory_order_acquire);
+
+    const auto count = std::min(values.size(), m_values.size() - (writePosition - readPosition));
+    for (std::size_t i = 0; i < count; i++) {
+        m_values[(writePosition + i) & m_mask] = values[i];
+    }
+
+    m_writePosition.store(writePosition + count, std::memory_order_release);
+    return count;
+}
+
+template <typename T>
+std::size_t Utils::RingBuffer<T>::pop(std::span<T> destination) {
+    const auto readPosition  = m_readPosition.load(std::memory_order_relaxed);
+    const auto writePosition = m_writePosition.load(std::memory_order_acquire);
+
+    const auto count = std::min(destination.size(), writePosition - readPosition);
+    for (std::size_t i = 0; i < count; i++) {
+        destination[i] = m_values[(readPosition + i) & m_mask];
+    }
+
+    m_readPosition.store(readPosition + count, std::memory_order_release);
+    return count;
+}
+
+template <typename T>
+std::size_t Utils::RingBuffer<T>::size() const {
+    return m_writePosition.load(std::memory_order_acquire) - m_readPosition.load(std::memory_order_acquire);
+}
+
+template <typename T>
+std::size_t Utils::RingBuffer<T>::capacity() const {
+    return m_values.size();
+}
+
+#endif //CAIQUE_NES_RINGBUFFER_TPP
@@ -0,0 +1,65 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <algorithm>
+#include "Utils/StateStream.hpp"
+
+Utils::StateWriter::StateWriter(std::vector<std::uint8_t>& buffer) :
+    m_buffer(buffer)
+{
+}
+
+void Utils::StateWriter::writeBytes(std::span<const std::uint8_t> bytes) {
+    m_buffer.insert(m_buffer.end(), bytes.begin(), bytes.end());
+}
+
+std::size_t Utils::StateWriter::size() const {
+    return m_buffer.size();
+}
+
+Utils::StateReader::StateReader(std::span<const std::uint8_t> data) :
+    m_data(data)
+{
+}
+
+void Utils::StateReader::readBytes(std::span<std::uint8_t> destination) {
+    if (!reserve(destination.size())) {
+        std::fill(destination.begin(), destination.end(), 0);
+        return;
+    }
+
+    std::copy_n(m_data.begin() + m_offset, destination.size(), destination.begin());
+    m_offset += destination.size();
+}
+
+bool Utils::StateReader::failed() const {
+    return m_failed;
+}
+
+std::size_t Utils::StateReader::remaining() const {
+    return m_data.size() - m_offset;
+}
+
+bool Utils::StateReader::reserve(std::size_t size) {
+    if (m_failed || size > remaining()) {
+        m_failed = true;
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,79 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#ifndef CAIQUE_NES_STATESTREAM_HPP
+#define CAIQUE_NES_STATESTREAM_HPP
+
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace Utils {
+    template <typename T>
+    concept StateValueType = std::is_trivially_copyable_v<T>;
+
+    // Appends raw values to a byte buffer, clearing the buffer beforehand keeps its capacity for the next snapshot
+    class StateWriter {
+    public:
+        explicit StateWriter(std::vector<std::uint8_t>& buffer);
+
+        template <StateValueType T>
+        void write(const T& value);
+
+        void writeBytes(std::span<const std::uint8_t> bytes);
+
+        // Overwrites an already written value, used to patch sizes into headers
+        template <StateValueType T>
+        void writeAt(std::size_t offset, const T& value);
+
+        std::size_t size() const;
+
+    private:
+        std::vector<std::uint8_t>& m_buffer;
+    };
+
+    // Reads values back in the order they were written. Reading past the end never throws, it marks the reader as
+    // failed and yields zeroes so callers can check once after restoring everything.
+    class StateReader {
+    public:
+        explicit StateReader(std::span<const std::uint8_t> data);
+
+        template <StateValueType T>
+        T read();
+
+        template <StateValueType T>
+        void read(T& value);
+
+        void readBytes(std::span<std::uint8_t> destination);
+
+        bool failed() const;
+        std::size_t remaining() const;
+
+    private:
+        std::span<const std::uint8_t> m_data;
+        std::size_t m_offset = 0;
+        bool m_failed = false;
+
+        bool reserve(std::size_t size);
+    };
+}
+
+#include "Utils/StateStream.tpp"
+
+#endif //CAIQUE_NES_STATESTREAM_HPP
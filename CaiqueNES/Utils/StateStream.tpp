@@ -0,0 +1,56 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#ifndef CAIQUE_NES_STATESTREAM_TPP
+#define CAIQUE_NES_STATESTREAM_TPP
+
+#include <cstring>
+#include "Utils/StateStream.hpp"
+
+template <Utils::StateValueType T>
+void Utils::StateWriter::write(const T& value) {
+    const auto offset = m_buffer.size();
+    m_buffer.resize(offset + sizeof(T));
+    std::memcpy(m_buffer.data() + offset, &value, sizeof(T));
+}
+
+template <Utils::StateValueType T>
+void Utils::StateWriter::writeAt(std::size_t offset, const T& value) {
+    std::memcpy(m_buffer.data() + offset, &value, sizeof(T));
+}
+
+template <Utils::StateValueType T>
+T Utils::StateReader::read() {
+    T value{};
+    read(value);
+
+    return value;
+}
+
+template <Utils::StateValueType T>
+void Utils::StateReader::read(T& value) {
+    if (!reserve(sizeof(T))) {
+        value = T{};
+        return;
+    }
+
+    std::memcpy(&value, m_data.data() + m_offset, sizeof(T));
+    m_offset += sizeof(T);
+}
+
+#endif //CAIQUE_NES_STATESTREAM_TPP
@@ -0,0 +1,158 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <algorithm>
+#include <utility>
+#include "Utils/ThreadPool.hpp"
+
+namespace {
+    struct WorkerIdentity {
+        const Utils::ThreadPool* pool = nullptr;
+        std::size_t index = 0;
+    };
+
+    thread_local WorkerIdentity currentWorker{};
+}
+
+Utils::ThreadPool::ThreadPool(std::size_t threadCount) {
+    threadCount = std::max<std::size_t>(threadCount, 1);
+
+    for (std::size_t i = 0; i < threadCount; i++) {
+        m_queues.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    for (std::size_t i = 0; i < threadCount; i++) {
+        m_workers.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+Utils::ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard lock(m_stateMutex);
+        m_stopping = true;
+    }
+
+    m_taskAvailable.notify_all();
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+}
+
+std::size_t Utils::ThreadPool::threadCount() const {
+    return m_workers.size();
+}
+
+void Utils::ThreadPool::submit(Task task) {
+    m_pendingTasks++;
+
+    // Tasks submitted by a worker of this pool stay local to it, outside submissions are spread round robin
+    const auto queueIndex = currentWorker.pool == this ? currentWorker.index : m_nextQueue++ % m_queues.size();
+    pushTask(queueIndex, std::move(task));
+}
+
+void Utils::ThreadPool::wait() {
+    std::unique_lock lock(m_stateMutex);
+    m_tasksFinished.wait(lock, [&] { return m_pendingTasks == 0; });
+
+    if (m_firstException != nullptr) {
+        std::rethrow_exception(std::exchange(m_firstException, nullptr));
+    }
+}
+
+void Utils::ThreadPool::workerLoop(std::size_t workerIndex) {
+    currentWorker = {this, workerIndex};
+
+    while (true) {
+        Task task;
+        if (popLocalTask(workerIndex, task) || stealTask(workerIndex, task)) {
+            try {
+                task();
+            } catch (...) {
+                std::lock_guard lock(m_stateMutex);
+                if (m_firstException == nullptr) {
+                    m_firstException = std::current_exception();
+                }
+            }
+
+            finishTask();
+            continue;
+        }
+
+        std::unique_lock lock(m_stateMutex);
+        m_taskAvailable.wait(lock, [&] { return m_stopping || m_queuedTasks > 0; });
+        if (m_stopping && m_queuedTasks == 0) {
+            return;
+        }
+    }
+}
+
+bool Utils::ThreadPool::popLocalTask(std::size_t workerIndex, Task& task) {
+    auto& queue = *m_queues[workerIndex];
+
+    std::lock_guard lock(queue.mutex);
+    if (queue.tasks.empty()) {
+        return false;
+    }
+
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    m_queuedTasks--;
+
+    return true;
+}
+
+bool Utils::ThreadPool::stealTask(std::size_t workerIndex, Task& task) {
+    for (std::size_t offset = 1; offset < m_queues.size(); offset++) {
+        auto& queue = *m_queues[(workerIndex + offset) % m_queues.size()];
+
+        std::lock_guard lock(queue.mutex);
+        if (queue.tasks.empty()) {
+            continue;
+        }
+
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+        m_queuedTasks--;
+
+        return true;
+    }
+
+    return false;
+}
+
+void Utils::ThreadPool::pushTask(std::size_t queueIndex, Task task) {
+    {
+        auto& queue = *m_queues[queueIndex];
+        std::lock_guard lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+        m_queuedTasks++;
+    }
+
+    // Taking the state lock orders the push before any worker checking m_queuedTasks and going to sleep
+    {
+        std::lock_guard lock(m_stateMutex);
+    }
+    m_taskAvailable.notify_one();
+}
+
+void Utils::ThreadPool::finishTask() {
+    if (--m_pendingTasks == 0) {
+        std::lock_guard lock(m_stateMutex);
+        m_tasksFinished.notify_all();
+    }
+}
@@ -0,0 +1,81 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#ifndef CAIQUE_NES_THREADPOOL_HPP
+#define CAIQUE_NES_THREADPOOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Utils {
+    using Task = std::function<void()>;
+
+    // Every worker owns a deque of tasks. Workers take their own newest task first and steal the oldest task of another
+    // worker when they run dry, so tasks submitted from inside a task stay on the submitting worker unless others idle.
+    class ThreadPool {
+    public:
+        explicit ThreadPool(std::size_t threadCount = std::thread::hardware_concurrency());
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        std::size_t threadCount() const;
+
+        void submit(Task task);
+
+        // Blocks until every submitted task, including tasks submitted by tasks, has finished. Rethrows the first
+        // exception thrown by a task.
+        void wait();
+
+    private:
+        struct WorkerQueue {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+        std::vector<std::thread> m_workers;
+
+        std::atomic<std::size_t> m_queuedTasks  = 0;
+        std::atomic<std::size_t> m_pendingTasks = 0;
+        std::atomic<std::size_t> m_nextQueue    = 0;
+
+        std::mutex m_stateMutex;
+        std::condition_variable m_taskAvailable;
+        std::condition_variable m_tasksFinished;
+        std::exception_ptr m_firstException = nullptr;
+        bool m_stopping = false;
+
+        void workerLoop(std::size_t workerIndex);
+
+        bool popLocalTask(std::size_t workerIndex, Task& task);
+        bool stealTask(std::size_t workerIndex, Task& task);
+        void pushTask(std::size_t queueIndex, Task task);
+        void finishTask();
+    };
+}
+
+#endif //CAIQUE_NES_THREADPOOL_HPP
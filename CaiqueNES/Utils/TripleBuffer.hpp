@@ -0,0 +1,56 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#ifndef CAIQUE_NES_TRIPLEBUFFER_HPP
+#define CAIQUE_NES_TRIPLEBUFFER_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace Utils {
+    // Lock-free handoff between a single producer and a single consumer. The producer fills the write buffer and
+    // publishes it by swapping it with the shared middle slot, the consumer swaps the middle slot with its read buffer
+    // when a newer one is available. Neither side ever waits on the other and the consumer never sees a buffer which
+    // is still being written, frames published in between two reads are simply dropped.
+    template <typename T>
+    class TripleBuffer {
+    public:
+        /* Producer */
+        T& writeBuffer();
+        void publish();
+
+        /* Consumer */
+        bool consume();
+        const T& readBuffer() const;
+
+    private:
+        static constexpr std::uint8_t indexMask = 0b011;
+        static constexpr std::uint8_t freshFlag = 0b100;
+
+        std::array<T, 3> m_buffers{};
+
+        std::uint8_t m_writeIndex = 0;
+        std::uint8_t m_readIndex  = 1;
+        std::atomic<std::uint8_t> m_middle = 2;
+    };
+}
+
+#include "Utils/TripleBuffer.tpp"
+
+#endif //CAIQUE_NES_TRIPLEBUFFER_HPP
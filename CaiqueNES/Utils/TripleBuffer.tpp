@@ -0,0 +1,52 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#ifndef CAIQUE_NES_TRIPLEBUFFER_TPP
+#define CAIQUE_NES_TRIPLEBUFFER_TPP
+
+#include "Utils/TripleBuffer.hpp"
+
+template <typename T>
+T& Utils::TripleBuffer<T>::writeBuffer() {
+    return m_buffers[m_writeIndex];
+}
+
+template <typename T>
+void Utils::TripleBuffer<T>::publish() {
+    const auto previous = m_middle.exchange(m_writeIndex | freshFlag, std::memory_order_acq_rel);
+    m_writeIndex = previous & indexMask;
+}
+
+template <typename T>
+bool Utils::TripleBuffer<T>::consume() {
+    if (!(m_middle.load(std::memory_order_relaxed) & freshFlag)) {
+        return false;
+    }
+
+    const auto previous = m_middle.exchange(m_readIndex, std::memory_order_acq_rel);
+    m_readIndex = previous & indexMask;
+
+    return true;
+}
+
+template <typename T>
+const T& Utils::TripleBuffer<T>::readBuffer() const {
+    return m_buffers[m_readIndex];
+}
+
+#endif //CAIQUE_NES_TRIPLEBUFFER_TPP
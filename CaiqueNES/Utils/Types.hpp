@@ -64,6 +64,11 @@ namespace Utils {
     }
 
     using ErrorString = std::string;
+
+    template <typename... Callables>
+    struct Overloaded : Callables... {
+        using Callables::operator()...;
+    };
 }
 
 namespace Graphics {
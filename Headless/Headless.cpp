@@ -16,25 +16,25 @@
 *
 ***********************************************************************************************************************/
 
-#include <cmath>
-#include "Timing.hpp"
+#include <iostream>
+#include <string>
+#include <vector>
+#include "HeadlessRunner.hpp"
 
-Graphics::FrameRateBlocker::FrameRateBlocker(int frameRate) :
-    m_frameTime(1000.0 / frameRate)
-{
-}
-
-void Graphics::FrameRateBlocker::startOfLoop() {
-    m_startTime = SDL_GetPerformanceCounter();
-}
+int main(int argc, char** argv) {
+    const auto options = Headless::HeadlessRunner::parseArguments(std::vector<std::string>(argv + 1, argv + argc));
+    if (!options.has_value()) {
+        std::cerr << options.error() << "\n\n" << Headless::Const::usage;
+        return 1;
+    }
 
-void Graphics::FrameRateBlocker::endOfLoop() {
-    m_endTime = SDL_GetPerformanceCounter();
+    Headless::HeadlessRunner runner(options.value());
 
-    waitUntilFrameTime();
-}
+    const auto result = runner.run();
+    if (!result.has_value()) {
+        std::cerr << result.error() << std::endl;
+        return 1;
+    }
 
-void Graphics::FrameRateBlocker::waitUntilFrameTime() const {
-    const float elapsed = (float) (m_endTime - m_startTime) / (float) SDL_GetPerformanceFrequency() * 1000.0f;
-    SDL_Delay(static_cast<std::uint32_t>(std::floor(m_frameTime - elapsed)));
+    return 0;
 }
@@ -0,0 +1,199 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include "Utils/Checksum.hpp"
+#include "HeadlessRunner.hpp"
+#include "PngWriter.hpp"
+
+namespace {
+    std::expected<int, Utils::ErrorString> parsePositiveNumber(const std::string& option, const std::string& value) {
+        try {
+            const auto number = std::stoi(value);
+            if (number > 0) {
+                return number;
+            }
+        } catch (const std::exception&) {}
+
+        return std::unexpected("expected a positive number for " + option + ", got: " + value);
+    }
+}
+
+std::expected<Headless::RunnerOptions, Utils::ErrorString> Headless::HeadlessRunner::parseArguments(
+    const std::vector<std::string>& args)
+{
+    if (args.empty()) {
+        return std::unexpected("No ROM path provided");
+    }
+
+    RunnerOptions options;
+    options.romPath = args.at(0);
+
+    for (std::size_t i = 1; i < args.size(); i += 2) {
+        const auto& option = args[i];
+        if (i + 1 >= args.size()) {
+            return std::unexpected("Missing value for " + option);
+        }
+
+        const auto& value = args[i + 1];
+        if (option == "--input") {
+            options.inputScriptPath = value;
+        } else if (option == "--png-dir") {
+            options.pngDirectory = value;
+        } else if (option == "--rom-index") {
+            options.romIndexPath = value;
+        } else if (option == "--frames" || option == "--hash-every" || option == "--png-every" ||
+                   option == "--run-ahead") {
+            const auto number = parsePositiveNumber(option, value);
+            if (!number.has_value()) {
+                return std::unexpected(number.error());
+            }
+
+            auto& target = option == "--frames" ? options.frameCount :
+                           option == "--hash-every" ? options.hashInterval :
+                           option == "--png-every" ? options.pngInterval : options.runAheadFrames;
+            target = number.value();
+        } else {
+            return std::unexpected("Unknown command line argument: " + option);
+        }
+    }
+
+    return options;
+}
+
+Headless::HeadlessRunner::HeadlessRunner(RunnerOptions options) :
+    m_options(std::move(options))
+{
+}
+
+std::expected<void, Utils::ErrorString> Headless::HeadlessRunner::run() {
+    if (!m_options.inputScriptPath.empty()) {
+        auto scriptResult = InputScript::loadFromFilesystem(m_options.inputScriptPath);
+        if (!scriptResult.has_value()) {
+            return std::unexpected("Unable to load input script: " + scriptResult.error());
+        }
+
+        m_inputScript = std::move(scriptResult.value());
+    }
+
+    if (!m_options.pngDirectory.empty()) {
+        std::error_code error;
+        std::filesystem::create_directories(m_options.pngDirectory, error);
+        if (error) {
+            return std::unexpected("Unable to create PNG directory: " + error.message());
+        }
+    }
+
+    Nes::VirtualMachine virtualMachine([this](const Nes::FrameBuffer& frameBuffer) {
+        handleFrame(frameBuffer);
+    });
+
+    if (!m_options.romIndexPath.empty()) {
+        auto indexResult = Nes::RomIndex::loadFromFilesystem(m_options.romIndexPath);
+        if (!indexResult.has_value()) {
+            return std::unexpected("Unable to load ROM index: " + indexResult.error());
+        }
+
+        virtualMachine.setRomIndex(std::make_shared<const Nes::RomIndex>(std::move(indexResult.value())));
+    }
+
+    const auto loadResult = virtualMachine.loadRom(m_options.romPath);
+    if (!loadResult.has_value()) {
+        return std::unexpected("Unable to load ROM file at: " + m_options.romPath + " due to " + loadResult.error());
+    }
+
+    // Like in the GUI the ROM still runs, only without running ahead
+    const auto runAheadResult = virtualMachine.setRunAhead(m_options.runAheadFrames);
+    if (!runAheadResult.has_value()) {
+        std::cerr << "Unable to enable run-ahead due to " << runAheadResult.error() << '\n';
+    }
+
+    ButtonSet heldButtons;
+
+    const auto start = std::chrono::steady_clock::now();
+    while (m_framesRun < m_options.frameCount && m_frameResult.has_value()) {
+        applyInput(virtualMachine, heldButtons);
+        m_framesRun++;
+
+        if (needsDrawing()) {
+            virtualMachine.tick();
+        } else {
+            virtualMachine.skipFrame();
+        }
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cerr << m_framesRun << " frames in " << elapsed.count() << "s ("
+              << m_framesRun / elapsed.count() << " frames/s)" << std::endl;
+
+    return m_frameResult;
+}
+
+void Headless::HeadlessRunner::handleFrame(const Nes::FrameBuffer& frameBuffer) {
+    if (!m_frameResult.has_value()) {
+        return;
+    }
+
+    if (isOutputFrame(m_options.hashInterval)) {
+        const auto hash = Utils::fnv1a64(reinterpret_cast<const std::uint8_t*>(frameBuffer.data()),
+                                         Nes::Const::screenWidth * Nes::Const::screenHeight * sizeof(Graphics::PixelColor));
+        std::printf("%d %016llx\n", m_framesRun, static_cast<unsigned long long>(hash));
+    }
+
+    if (!m_options.pngDirectory.empty() && isOutputFrame(m_options.pngInterval)) {
+        char fileName[32];
+        std::snprintf(fileName, sizeof(fileName), "frame_%06d.png", m_framesRun);
+
+        const auto path = std::filesystem::path(m_options.pngDirectory) / fileName;
+        m_frameResult = writePng(path.string(), Nes::Const::screenWidth, Nes::Const::screenHeight, frameBuffer.data());
+    }
+}
+
+void Headless::HeadlessRunner::applyInput(Nes::VirtualMachine& virtualMachine, ButtonSet& heldButtons) const {
+    const auto& buttons = m_inputScript.buttonsAt(m_framesRun);
+    if (buttons == heldButtons) {
+        return;
+    }
+
+    for (const auto button : heldButtons) {
+        if (!buttons.contains(button)) {
+            virtualMachine.handleKeyRelease(button);
+        }
+    }
+
+    for (const auto button : buttons) {
+        if (!heldButtons.contains(button)) {
+            virtualMachine.handleKeyPress(button);
+        }
+    }
+
+    heldButtons = buttons;
+}
+
+bool Headless::HeadlessRunner::isOutputFrame(int interval) const {
+    const bool lastFrame = m_framesRun == m_options.frameCount;
+    return lastFrame || (interval > 0 && m_framesRun % interval == 0);
+}
+
+bool Headless::HeadlessRunner::needsDrawing() const {
+    return isOutputFrame(m_options.hashInterval) ||
+           (!m_options.pngDirectory.empty() && isOutputFrame(m_options.pngInterval));
+}
@@ -0,0 +1,81 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#ifndef CAIQUE_NES_HEADLESSRUNNER_HPP
+#define CAIQUE_NES_HEADLESSRUNNER_HPP
+
+#include <expected>
+#include <string>
+#include <vector>
+#include "Core/VirtualMachine.hpp"
+#include "Utils/Types.hpp"
+#include "InputScript.hpp"
+
+namespace Headless {
+    namespace Const {
+        constexpr int defaultFrameCount = 600;
+
+        constexpr const char* usage =
+            "Usage: caique-nes-headless <rom> [options]\n"
+            "  --frames <count>     Number of frames to run (default 600)\n"
+            "  --input <file>       Input script, lines of \"<frame> [A B Select Start Up Down Left Right]\"\n"
+            "  --hash-every <n>     Print the frame buffer hash every n frames, the last frame is always printed\n"
+            "  --png-dir <dir>      Write frames as PNG files into this directory\n"
+            "  --png-every <n>      Write every n-th frame instead of only the last one\n"
+            "  --run-ahead <n>      Present the frame n frames ahead of the emulated state\n"
+            "  --rom-index <file>   Apply header corrections from an index written by caique-nes-indexer\n";
+    }
+
+    struct RunnerOptions {
+        std::string romPath;
+        std::string inputScriptPath;
+        std::string pngDirectory;
+        std::string romIndexPath;
+
+        int frameCount     = Const::defaultFrameCount;
+        int hashInterval   = 0;
+        int pngInterval    = 0;
+        int runAheadFrames = 0;
+    };
+
+    // Runs a ROM for a fixed number of frames as fast as possible, without any display or audio device. Only frames
+    // which get hashed or written out are drawn.
+    class HeadlessRunner {
+    public:
+        static std::expected<RunnerOptions, Utils::ErrorString> parseArguments(const std::vector<std::string>& args);
+
+        explicit HeadlessRunner(RunnerOptions options);
+
+        std::expected<void, Utils::ErrorString> run();
+
+    private:
+        RunnerOptions m_options;
+        InputScript   m_inputScript;
+
+        int m_framesRun = 0;
+        std::expected<void, Utils::ErrorString> m_frameResult{};
+
+        void handleFrame(const Nes::FrameBuffer& frameBuffer);
+        void applyInput(Nes::VirtualMachine& virtualMachine, ButtonSet& heldButtons) const;
+
+        bool isOutputFrame(int interval) const;
+        bool needsDrawing() const;
+    };
+}
+
+#endif //CAIQUE_NES_HEADLESSRUNNER_HPP
@@ -0,0 +1,94 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <fstream>
+#include <sstream>
+#include "InputScript.hpp"
+
+namespace {
+    const std::map<std::string, Nes::JoypadButton> buttonNames = {
+        {"A",      Nes::JoypadButton::A},
+        {"B",      Nes::JoypadButton::B},
+        {"Select", Nes::JoypadButton::Select},
+        {"Start",  Nes::JoypadButton::Start},
+        {"Up",     Nes::JoypadButton::Up},
+        {"Down",   Nes::JoypadButton::Down},
+        {"Left",   Nes::JoypadButton::Left},
+        {"Right",  Nes::JoypadButton::Right},
+    };
+
+    const Headless::ButtonSet noButtons{};
+}
+
+std::expected<Headless::InputScript, Utils::ErrorString> Headless::InputScript::loadFromFilesystem(const std::string& path) {
+    std::ifstream file(path);
+    if (!file.good()) {
+        return std::unexpected("unable to open file at: " + path);
+    }
+
+    return parse(file);
+}
+
+std::expected<Headless::InputScript, Utils::ErrorString> Headless::InputScript::parse(std::istream& stream) {
+    InputScript script;
+
+    std::string line;
+    for (auto lineNumber = 1; std::getline(stream, line); lineNumber++) {
+        std::istringstream lineStream(line);
+
+        std::string frameToken;
+        if (!(lineStream >> frameToken) || frameToken.starts_with('#')) {
+            continue;
+        }
+
+        int frame = 0;
+        try {
+            frame = std::stoi(frameToken);
+        } catch (const std::exception&) {
+            return std::unexpected("invalid frame number on line " + std::to_string(lineNumber) + ": " + frameToken);
+        }
+
+        if (frame < 0) {
+            return std::unexpected("negative frame number on line " + std::to_string(lineNumber));
+        }
+
+        ButtonSet buttons;
+        std::string buttonName;
+        while (lineStream >> buttonName) {
+            const auto button = buttonNames.find(buttonName);
+            if (button == buttonNames.cend()) {
+                return std::unexpected("unknown button on line " + std::to_string(lineNumber) + ": " + buttonName);
+            }
+
+            buttons.insert(button->second);
+        }
+
+        script.m_entries[frame] = std::move(buttons);
+    }
+
+    return script;
+}
+
+const Headless::ButtonSet& Headless::InputScript::buttonsAt(int frame) const {
+    auto entry = m_entries.upper_bound(frame);
+    if (entry == m_entries.cbegin()) {
+        return noButtons;
+    }
+
+    return std::prev(entry)->second;
+}
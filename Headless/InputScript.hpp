@@ -0,0 +1,47 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#ifndef CAIQUE_NES_INPUTSCRIPT_HPP
+#define CAIQUE_NES_INPUTSCRIPT_HPP
+
+#include <expected>
+#include <istream>
+#include <map>
+#include <set>
+#include <string>
+#include "Core/Joypad.hpp"
+#include "Utils/Types.hpp"
+
+namespace Headless {
+    using ButtonSet = std::set<Nes::JoypadButton>;
+
+    // Scripted input for the first joypad. Every line is "<frame> [button...]" and holds the listed buttons from that
+    // frame until the next line, an empty button list releases everything. Lines starting with '#' are comments.
+    class InputScript {
+    public:
+        static std::expected<InputScript, Utils::ErrorString> loadFromFilesystem(const std::string& path);
+        static std::expected<InputScript, Utils::ErrorString> parse(std::istream& stream);
+
+        const ButtonSet& buttonsAt(int frame) const;
+
+    private:
+        std::map<int, ButtonSet> m_entries{};
+    };
+}
+
+#endif //CAIQUE_NES_INPUTSCRIPT_HPP
@@ -0,0 +1,114 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <algorithm>
+#include <fstream>
+#include <vector>
+#include "Utils/Checksum.hpp"
+#include "PngWriter.hpp"
+
+namespace {
+    constexpr std::uint8_t pngSignature[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+    constexpr std::uint8_t bitDepth     = 8;
+    constexpr std::uint8_t colorTypeRGB = 2;
+    constexpr std::uint8_t filterNone   = 0;
+    constexpr int bytesPerPixel         = 3;
+
+    constexpr std::uint8_t zlibHeader[] = {0x78, 0x01};
+    constexpr std::size_t maxStoredBlock = 65535;
+
+    void appendBigEndian(std::vector<std::uint8_t>& bytes, std::uint32_t value) {
+        bytes.push_back(value >> 24);
+        bytes.push_back(value >> 16);
+        bytes.push_back(value >> 8);
+        bytes.push_back(value);
+    }
+
+    void appendChunk(std::vector<std::uint8_t>& png, const char* type, const std::vector<std::uint8_t>& data) {
+        appendBigEndian(png, data.size());
+
+        const auto typeStart = png.size();
+        png.insert(png.end(), type, type + 4);
+        png.insert(png.end(), data.cbegin(), data.cend());
+
+        appendBigEndian(png, Utils::crc32(png.data() + typeStart, png.size() - typeStart));
+    }
+
+    std::vector<std::uint8_t> createZlibStream(const std::vector<std::uint8_t>& raw) {
+        std::vector<std::uint8_t> stream(std::begin(zlibHeader), std::end(zlibHeader));
+
+        std::size_t offset = 0;
+        do {
+            const auto blockSize = std::min(maxStoredBlock, raw.size() - offset);
+            const bool lastBlock = offset + blockSize == raw.size();
+
+            stream.push_back(lastBlock ? 1 : 0);
+            stream.push_back(blockSize & 0xFF);
+            stream.push_back(blockSize >> 8);
+            stream.push_back(~blockSize & 0xFF);
+            stream.push_back((~blockSize >> 8) & 0xFF);
+            stream.insert(stream.end(), raw.cbegin() + offset, raw.cbegin() + offset + blockSize);
+
+            offset += blockSize;
+        } while (offset < raw.size());
+
+        appendBigEndian(stream, Utils::adler32(raw.data(), raw.size()));
+
+        return stream;
+    }
+}
+
+std::expected<void, Utils::ErrorString> Headless::writePng(const std::string& path, int width, int height,
+                                                           const Graphics::PixelColor* pixels)
+{
+    std::vector<std::uint8_t> raw;
+    raw.reserve(height * (1 + width * bytesPerPixel));
+
+    for (auto y = 0; y < height; y++) {
+        raw.push_back(filterNone);
+        for (auto x = 0; x < width; x++) {
+            const auto color = pixels[y * width + x];
+            raw.push_back(color >> 16);
+            raw.push_back(color >> 8);
+            raw.push_back(color);
+        }
+    }
+
+    std::vector<std::uint8_t> header;
+    appendBigEndian(header, width);
+    appendBigEndian(header, height);
+    header.insert(header.end(), {bitDepth, colorTypeRGB, 0, 0, 0});
+
+    std::vector<std::uint8_t> png(std::begin(pngSignature), std::end(pngSignature));
+    appendChunk(png, "IHDR", header);
+    appendChunk(png, "IDAT", createZlibStream(raw));
+    appendChunk(png, "IEND", {});
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file.good()) {
+        return std::unexpected("unable to open file at: " + path);
+    }
+
+    file.write(reinterpret_cast<const char*>(png.data()), static_cast<std::streamsize>(png.size()));
+    if (!file.good()) {
+        return std::unexpected("unable to write file at: " + path);
+    }
+
+    return {};
+}
@@ -16,30 +16,17 @@
 *
 ***********************************************************************************************************************/
 
-#ifndef CAIQUE_NES_TIMING_HPP
-#define CAIQUE_NES_TIMING_HPP
+#ifndef CAIQUE_NES_PNGWRITER_HPP
+#define CAIQUE_NES_PNGWRITER_HPP
 
-#include <SDL2/SDL.h>
-#include <cstdint>
+#include <expected>
+#include <string>
+#include "Utils/Types.hpp"
 
-namespace Graphics {
-    using MomentInTime = std::uint64_t;
-
-    class FrameRateBlocker {
-    public:
-        explicit FrameRateBlocker(int frameRate);
-
-        void startOfLoop();
-        void endOfLoop();
-
-    private:
-        double m_frameTime = 0;
-
-        MomentInTime m_startTime = 0;
-        MomentInTime m_endTime = 0;
-
-        void waitUntilFrameTime() const;
-    };
+namespace Headless {
+    // Writes ARGB pixels as an 8-bit RGB PNG. The image data is stored uncompressed so no zlib is needed.
+    std::expected<void, Utils::ErrorString> writePng(const std::string& path, int width, int height,
+                                                     const Graphics::PixelColor* pixels);
 }
 
-#endif //CAIQUE_NES_TIMING_HPP
+#endif //CAIQUE_NES_PNGWRITER_HPP
@@ -0,0 +1,97 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <fstream>
+#include <map>
+#include <sstream>
+#include "GameDatabase.hpp"
+
+namespace {
+    const std::map<std::string, Nes::Mirroring> mirroringNames = {
+        {"H", Nes::Mirroring::Horizontal},
+        {"V", Nes::Mirroring::Vertical},
+        {"4", Nes::Mirroring::FourScreen},
+    };
+}
+
+std::expected<Indexer::GameDatabase, Utils::ErrorString> Indexer::GameDatabase::loadFromFilesystem(
+    const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file.good()) {
+        return std::unexpected("unable to open file at: " + path);
+    }
+
+    return parse(file);
+}
+
+std::expected<Indexer::GameDatabase, Utils::ErrorString> Indexer::GameDatabase::parse(std::istream& stream) {
+    GameDatabase database;
+
+    std::string line;
+    for (auto lineNumber = 1; std::getline(stream, line); lineNumber++) {
+        std::istringstream lineStream(line);
+
+        std::string checksumToken;
+        if (!(lineStream >> checksumToken) || checksumToken.starts_with('#')) {
+            continue;
+        }
+
+        std::string mapperToken;
+        std::string mirroringToken;
+        if (!(lineStream >> mapperToken >> mirroringToken)) {
+            return std::unexpected("missing mapper or mirroring on line " + std::to_string(lineNumber));
+        }
+
+        std::uint32_t checksum = 0;
+        GameDatabaseEntry entry;
+        try {
+            checksum = std::stoul(checksumToken, nullptr, 16);
+
+            const auto mapperId = std::stoi(mapperToken);
+            if (mapperId < 0 || mapperId > 0xFFF) {
+                throw std::out_of_range(mapperToken);
+            }
+
+            entry.mapperId = mapperId;
+        } catch (const std::exception&) {
+            return std::unexpected("invalid checksum or mapper on line " + std::to_string(lineNumber));
+        }
+
+        const auto mirroring = mirroringNames.find(mirroringToken);
+        if (mirroring == mirroringNames.cend()) {
+            return std::unexpected("unknown mirroring on line " + std::to_string(lineNumber) + ": " + mirroringToken);
+        }
+
+        entry.mirroring = mirroring->second;
+
+        std::getline(lineStream >> std::ws, entry.name);
+        database.m_entries.insert_or_assign(checksum, std::move(entry));
+    }
+
+    return database;
+}
+
+const Indexer::GameDatabaseEntry* Indexer::GameDatabase::find(std::uint32_t checksum) const {
+    const auto entry = m_entries.find(checksum);
+    return entry != m_entries.cend() ? &entry->second : nullptr;
+}
+
+std::size_t Indexer::GameDatabase::size() const {
+    return m_entries.size();
+}
@@ -0,0 +1,52 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#ifndef CAIQUE_NES_GAMEDATABASE_HPP
+#define CAIQUE_NES_GAMEDATABASE_HPP
+
+#include <cstdint>
+#include <expected>
+#include <istream>
+#include <string>
+#include <unordered_map>
+#include "Core/RomHeader.hpp"
+#include "Utils/Types.hpp"
+
+namespace Indexer {
+    struct GameDatabaseEntry {
+        std::uint16_t  mapperId  = 0;
+        Nes::Mirroring mirroring = Nes::Mirroring::Horizontal;
+        std::string    name;
+    };
+
+    // Known dumps with the header values they are meant to have. Every line is "<crc32> <mapper> <H|V|4> [name]",
+    // the CRC-32 being RomHeader::checksum in hex. Lines starting with '#' are comments.
+    class GameDatabase {
+    public:
+        static std::expected<GameDatabase, Utils::ErrorString> loadFromFilesystem(const std::string& path);
+        static std::expected<GameDatabase, Utils::ErrorString> parse(std::istream& stream);
+
+        const GameDatabaseEntry* find(std::uint32_t checksum) const;
+        std::size_t size() const;
+
+    private:
+        std::unordered_map<std::uint32_t, GameDatabaseEntry> m_entries{};
+    };
+}
+
+#endif //CAIQUE_NES_GAMEDATABASE_HPP
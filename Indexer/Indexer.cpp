@@ -16,33 +16,25 @@
 *
 ***********************************************************************************************************************/
 
-#ifndef CAIQUE_NES_TILE_HPP
-#define CAIQUE_NES_TILE_HPP
-
-#include <array>
-#include "Core/Palette.hpp"
-#include "Utils/Types.hpp"
-
-namespace Nes {
-    namespace Const {
-        constexpr int tileSize      = 16;
-        constexpr int tileDimension = 8;
+#include <iostream>
+#include <string>
+#include <vector>
+#include "LibraryIndexer.hpp"
+
+int main(int argc, char** argv) {
+    const auto options = Indexer::LibraryIndexer::parseArguments(std::vector<std::string>(argv + 1, argv + argc));
+    if (!options.has_value()) {
+        std::cerr << options.error() << "\n\n" << Indexer::Const::usage;
+        return 1;
     }
 
-    class Tile {
-    public:
-        Tile(std::array<Byte, Const::tileSize> bytes, const Palette& palette);
-
-        bool skipDrawingSpritePixel(int x, int y) const;
+    Indexer::LibraryIndexer indexer(options.value());
 
-        Graphics::PixelColor getColor(int x, int y) const;
-
-    private:
-        std::array<Byte, Const::tileSize> m_bytes;
-        const Palette& m_palette;
+    const auto result = indexer.run();
+    if (!result.has_value()) {
+        std::cerr << result.error() << std::endl;
+        return 1;
+    }
 
-        int getColorId(int x, int y) const;
-    };
+    return 0;
 }
-
-#endif //CAIQUE_NES_TILE_HPP
@@ -0,0 +1,214 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include "Utils/MappedFile.hpp"
+#include "Utils/ThreadPool.hpp"
+#include "LibraryIndexer.hpp"
+
+namespace {
+    bool hasRomExtension(const std::filesystem::path& path) {
+        auto extension = path.extension().string();
+        std::ranges::transform(extension, extension.begin(), [](unsigned char c) { return std::tolower(c); });
+
+        return extension == ".nes";
+    }
+}
+
+std::expected<Indexer::IndexerOptions, Utils::ErrorString> Indexer::LibraryIndexer::parseArguments(
+    const std::vector<std::string>& args)
+{
+    if (args.size() < 2) {
+        return std::unexpected("No library directory or index file provided");
+    }
+
+    IndexerOptions options;
+    options.libraryDirectory = args.at(0);
+    options.indexPath        = args.at(1);
+
+    for (std::size_t i = 2; i < args.size(); i += 2) {
+        const auto& option = args[i];
+        if (i + 1 >= args.size()) {
+            return std::unexpected("Missing value for " + option);
+        }
+
+        const auto& value = args[i + 1];
+        if (option == "--database") {
+            options.databasePath = value;
+        } else if (option == "--threads") {
+            try {
+                const auto threadCount = std::stoi(value);
+                if (threadCount <= 0) {
+                    throw std::out_of_range(value);
+                }
+
+                options.threadCount = threadCount;
+            } catch (const std::exception&) {
+                return std::unexpected("expected a positive number for " + option + ", got: " + value);
+            }
+        } else {
+            return std::unexpected("Unknown command line argument: " + option);
+        }
+    }
+
+    return options;
+}
+
+Indexer::LibraryIndexer::LibraryIndexer(IndexerOptions options) :
+    m_options(std::move(options))
+{
+}
+
+std::expected<void, Utils::ErrorString> Indexer::LibraryIndexer::run() {
+    if (!m_options.databasePath.empty()) {
+        auto databaseResult = GameDatabase::loadFromFilesystem(m_options.databasePath);
+        if (!databaseResult.has_value()) {
+            return std::unexpected("Unable to load game database: " + databaseResult.error());
+        }
+
+        m_database = std::move(databaseResult.value());
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    auto findResult = findRoms();
+    if (!findResult.has_value()) {
+        return std::unexpected(findResult.error());
+    }
+
+    auto& results = findResult.value();
+
+    // Every task owns its slice of the results, the workers never share anything they write
+    {
+        Utils::ThreadPool pool(m_options.threadCount);
+        for (std::size_t first = 0; first < results.size(); first += Const::filesPerTask) {
+            const auto last = std::min(first + Const::filesPerTask, results.size());
+            pool.submit([this, &results, first, last] {
+                for (auto i = first; i < last; i++) {
+                    scanRom(results[i]);
+                }
+            });
+        }
+
+        pool.wait();
+    }
+
+    std::vector<Nes::RomIndexEntry> entries;
+    entries.reserve(results.size());
+
+    std::size_t runnable  = 0;
+    std::size_t corrected = 0;
+    for (const auto& result : results) {
+        if (result.problem != nullptr) {
+            std::cout << result.path << ": " << result.problem << "\n";
+            continue;
+        }
+
+        if (!result.entry.isRunnable()) {
+            std::cout << result.path << ": mapper " << result.entry.mapperId << " is not supported\n";
+        }
+
+        runnable  += result.entry.isRunnable();
+        corrected += result.entry.isCorrected();
+        entries.push_back(result.entry);
+    }
+
+    const auto indexedCount = entries.size();
+    const auto writeResult  = Nes::RomIndex::writeToFilesystem(m_options.indexPath, std::move(entries));
+    if (!writeResult.has_value()) {
+        return std::unexpected(writeResult.error());
+    }
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cerr << results.size() << " files in " << elapsed.count() << "s: " << indexedCount << " indexed, "
+              << runnable << " runnable, " << corrected << " corrected by the database" << std::endl;
+
+    return {};
+}
+
+std::expected<std::vector<Indexer::ScanResult>, Utils::ErrorString> Indexer::LibraryIndexer::findRoms() const {
+    std::vector<ScanResult> results;
+
+    std::error_code error;
+    std::filesystem::recursive_directory_iterator iterator(
+        m_options.libraryDirectory, std::filesystem::directory_options::skip_permission_denied, error);
+    if (error) {
+        return std::unexpected("Unable to scan " + m_options.libraryDirectory + ": " + error.message());
+    }
+
+    for (const auto& file : iterator) {
+        if (file.is_regular_file(error) && hasRomExtension(file.path())) {
+            ScanResult result;
+            result.path = file.path().string();
+            results.push_back(std::move(result));
+        }
+    }
+
+    // Sorted so that the first of several copies of a dump, which is the one the index keeps, does not depend on
+    // directory order
+    std::ranges::sort(results, {}, &ScanResult::path);
+
+    return results;
+}
+
+void Indexer::LibraryIndexer::scanRom(ScanResult& result) const {
+    const auto file = Utils::MappedFile::open(result.path);
+    if (!file.has_value()) {
+        result.problem = "unable to open file";
+        return;
+    }
+
+    const auto bytes  = file->bytes();
+    auto       header = Nes::RomHeader::parse(bytes);
+    if (!header.has_value()) {
+        result.problem = Nes::describeRomHeaderError(header.error());
+        return;
+    }
+
+    auto& entry = result.entry;
+    entry.checksum  = header->checksum(bytes);
+    entry.mapperId  = header->mapperId;
+    entry.submapper = header->submapper;
+    entry.mirroring = header->mirroring;
+    entry.path      = result.path;
+
+    // PRG and CHR ROM follow each other in the file, hashing them is a single pass
+    const auto prg = header->prgRom(bytes);
+    entry.sha1 = Utils::sha1(prg.data(), header->prgRomSize + header->chrRomSize);
+
+    if (const auto* known = m_database.find(entry.checksum); known != nullptr) {
+        if (known->mapperId != entry.mapperId || known->mirroring != entry.mirroring) {
+            entry.flags |= Nes::RomIndexFlag::corrected;
+        }
+
+        entry.mapperId  = known->mapperId;
+        entry.mirroring = known->mirroring;
+
+        header->mapperId  = known->mapperId;
+        header->mirroring = known->mirroring;
+    }
+
+    if (header->checkSupported().has_value()) {
+        entry.flags |= Nes::RomIndexFlag::runnable;
+    }
+}
@@ -0,0 +1,77 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#ifndef CAIQUE_NES_LIBRARYINDEXER_HPP
+#define CAIQUE_NES_LIBRARYINDEXER_HPP
+
+#include <algorithm>
+#include <expected>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Core/RomIndex.hpp"
+#include "Utils/Types.hpp"
+#include "GameDatabase.hpp"
+
+namespace Indexer {
+    namespace Const {
+        // Files are handed to the workers in batches, scanning a single header is far cheaper than a task
+        constexpr std::size_t filesPerTask = 32;
+
+        constexpr const char* usage =
+            "Usage: caique-nes-indexer <library-dir> <index-file> [options]\n"
+            "  --database <file>    Game database of \"<crc32> <mapper> <H|V|4> [name]\" lines to correct headers\n"
+            "  --threads <count>    Number of scanning threads (default: all hardware threads)\n";
+    }
+
+    struct IndexerOptions {
+        std::string libraryDirectory;
+        std::string indexPath;
+        std::string databasePath;
+
+        std::size_t threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    };
+
+    struct ScanResult {
+        std::string path;
+        Nes::RomIndexEntry entry;
+
+        // Why the file did not make it into the index, null for indexed ROMs
+        const char* problem = nullptr;
+    };
+
+    // Scans a directory tree of .nes files in parallel and writes the Nes::RomIndex of everything that parses. ROMs
+    // are identified by the CRC-32 of their PRG and CHR ROM, which is also what the game database is keyed by.
+    class LibraryIndexer {
+    public:
+        static std::expected<IndexerOptions, Utils::ErrorString> parseArguments(const std::vector<std::string>& args);
+
+        explicit LibraryIndexer(IndexerOptions options);
+
+        std::expected<void, Utils::ErrorString> run();
+
+    private:
+        IndexerOptions m_options;
+        GameDatabase   m_database;
+
+        std::expected<std::vector<ScanResult>, Utils::ErrorString> findRoms() const;
+        void scanRom(ScanResult& result) const;
+    };
+}
+
+#endif //CAIQUE_NES_LIBRARYINDEXER_HPP
@@ -0,0 +1,242 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+#include "Core/APU.hpp"
+#include "Core/Cartridge.hpp"
+#include "Core/Joypad.hpp"
+#include "Core/MMU.hpp"
+#include "Core/Scheduler.hpp"
+
+static constexpr Nes::Addr apuStatus    = 0x4015;
+static constexpr Nes::Addr frameCounter = 0x4017;
+
+static void runApu(Nes::Scheduler& scheduler, Nes::CycleCount cycles) {
+    for (auto i = 0; i < cycles; i++) {
+        scheduler.advance(1);
+        scheduler.dispatchDueEvents();
+    }
+}
+
+TEST(Core_APU, Status_ReflectsLengthCounters) {
+    Nes::Cartridge cartridge;
+    Nes::MMU mmu(cartridge);
+    Nes::Scheduler scheduler;
+    Nes::APU apu(mmu, scheduler);
+
+    apu.handleAPURegisterWrite(apuStatus, 0b0101);
+    apu.handleAPURegisterWrite(0x4003, 0x08);
+    apu.handleAPURegisterWrite(0x400B, 0x08);
+    apu.handleAPURegisterWrite(0x4007, 0x08);
+
+    ASSERT_EQ(apu.handleAPURegisterRead(apuStatus) & 0x0F, 0b0101);
+
+    apu.handleAPURegisterWrite(apuStatus, 0b0001);
+    ASSERT_EQ(apu.handleAPURegisterRead(apuStatus) & 0x0F, 0b0001);
+}
+
+TEST(Core_APU, LengthCounter_ExpiresOnHalfFrames) {
+    Nes::Cartridge cartridge;
+    Nes::MMU mmu(cartridge);
+    Nes::Scheduler scheduler;
+    Nes::APU apu(mmu, scheduler);
+
+    // Length index 0 loads 10 half frames, two of them per four step sequence
+    apu.handleAPURegisterWrite(apuStatus, 0b0001);
+    apu.handleAPURegisterWrite(0x4003, 0x00);
+
+    runApu(scheduler, Nes::Const::FrameCounter::fourStepPeriod * 4);
+    ASSERT_TRUE(apu.handleAPURegisterRead(apuStatus) & 0b0001);
+
+    runApu(scheduler, Nes::Const::FrameCounter::fourStepPeriod);
+    ASSERT_FALSE(apu.handleAPURegisterRead(apuStatus) & 0b0001);
+}
+
+TEST(Core_APU, FrameCounter_RaisesIrq) {
+    Nes::Cartridge cartridge;
+    Nes::MMU mmu(cartridge);
+    Nes::Scheduler scheduler;
+    Nes::APU apu(mmu, scheduler);
+
+    runApu(scheduler, Nes::Const::FrameCounter::fourStepSequence.back().at - 1);
+    ASSERT_FALSE(scheduler.isIrqAsserted());
+
+    runApu(scheduler, 1);
+    ASSERT_TRUE(scheduler.isIrqAsserted(Nes::IrqSource::FrameCounter));
+
+    // Reading the status acknowledges it
+    ASSERT_TRUE(apu.handleAPURegisterRead(apuStatus) & 0x40);
+    ASSERT_FALSE(scheduler.isIrqAsserted());
+}
+
+TEST(Core_APU, FrameCounter_IrqInhibit) {
+    Nes::Cartridge cartridge;
+    Nes::MMU mmu(cartridge);
+    Nes::Scheduler scheduler;
+    Nes::APU apu(mmu, scheduler);
+
+    apu.handleFrameCounterWrite(0x40);
+    runApu(scheduler, Nes::Const::FrameCounter::fourStepPeriod * 2);
+
+    ASSERT_FALSE(scheduler.isIrqAsserted());
+}
+
+TEST(Core_APU, FrameCounter_FiveStepModeNeverRaisesIrq) {
+    Nes::Cartridge cartridge;
+    Nes::MMU mmu(cartridge);
+    Nes::Scheduler scheduler;
+    Nes::APU apu(mmu, scheduler);
+
+    apu.handleFrameCounterWrite(0x80);
+    runApu(scheduler, Nes::Const::FrameCounter::fiveStepPeriod * 2);
+
+    ASSERT_FALSE(scheduler.isIrqAsserted());
+}
+
+TEST(Core_APU, FrameCounter_WrittenThroughSecondJoypadPort) {
+    Nes::Cartridge cartridge;
+    Nes::MMU mmu(cartridge);
+    Nes::Scheduler scheduler;
+    Nes::APU apu(mmu, scheduler);
+    Nes::Joypad secondJoypad(mmu, true, &apu);
+
+    mmu.write(frameCounter, 0x40);
+    runApu(scheduler, Nes::Const::FrameCounter::fourStepPeriod * 2);
+
+    ASSERT_FALSE(scheduler.isIrqAsserted());
+}
+
+TEST(Core_APU, Dmc_RaisesIrqAfterLastByte) {
+    Nes::Cartridge cartridge;
+    ASSERT_TRUE(cartridge.loadFromFilesystem(std::string(TEST_DIR_BLARGG) + "Instructions/Roms/01-basics.nes").has_value());
+    Nes::MMU mmu(cartridge);
+    Nes::Scheduler scheduler;
+    Nes::APU apu(mmu, scheduler);
+
+    // A single byte sample at the fastest rate, the byte is fetched as soon as the channel is enabled
+    apu.handleFrameCounterWrite(0x40);
+    apu.handleAPURegisterWrite(0x4010, 0x8F);
+    apu.handleAPURegisterWrite(0x4013, 0x00);
+    apu.handleAPURegisterWrite(apuStatus, 0x10);
+
+    ASSERT_TRUE(scheduler.isIrqAsserted(Nes::IrqSource::Dmc));
+    ASSERT_TRUE(apu.handleAPURegisterRead(apuStatus) & 0x80);
+
+    apu.handleAPURegisterWrite(apuStatus, 0x00);
+    ASSERT_FALSE(scheduler.isIrqAsserted());
+}
+
+TEST(Core_APU, Output_SilentWithoutChannels) {
+    Nes::Cartridge cartridge;
+    Nes::MMU mmu(cartridge);
+    Nes::Scheduler scheduler;
+    Nes::APU apu(mmu, scheduler);
+
+    std::vector<Utils::AudioSample> samples;
+    apu.setAudioCallback([&](auto frameSamples) { samples.assign(frameSamples.begin(), frameSamples.end()); });
+
+    runApu(scheduler, Nes::Const::FrameCounter::fourStepPeriod);
+    apu.endFrame();
+
+    ASSERT_NEAR(static_cast<double>(samples.size()),
+                Nes::Const::FrameCounter::fourStepPeriod * Nes::Const::Audio::sampleRate / Nes::Const::Audio::cpuClockRate, 1.0);
+    ASSERT_TRUE(std::all_of(samples.begin(), samples.end(), [](auto sample) { return sample == 0; }));
+}
+
+TEST(Core_APU, Output_PulseProducesSquareWave) {
+    Nes::Cartridge cartridge;
+    Nes::MMU mmu(cartridge);
+    Nes::Scheduler scheduler;
+    Nes::APU apu(mmu, scheduler);
+
+    std::vector<Utils::AudioSample> samples;
+    apu.setAudioCallback([&](auto frameSamples) { samples.insert(samples.end(), frameSamples.begin(), frameSamples.end()); });
+
+    // Constant volume 15, 50% duty, timer 253 which is roughly 440Hz
+    apu.handleAPURegisterWrite(apuStatus, 0b0001);
+    apu.handleAPURegisterWrite(0x4000, 0xBF);
+    apu.handleAPURegisterWrite(0x4002, 0xFD);
+    apu.handleAPURegisterWrite(0x4003, 0x08);
+
+    for (auto frame = 0; frame < 4; frame++) {
+        runApu(scheduler, Nes::Const::FrameCounter::fourStepPeriod);
+        apu.endFrame();
+    }
+
+    const auto [minimum, maximum] = std::minmax_element(samples.begin(), samples.end());
+    ASSERT_LT(*minimum, -1000);
+    ASSERT_GT(*maximum, 1000);
+
+    auto crossings = 0;
+    for (std::size_t i = 1; i < samples.size(); i++) {
+        crossings += (samples[i - 1] < 0) != (samples[i] < 0);
+    }
+
+    // Four frames at ~440Hz cross zero about 240 times
+    const double seconds = 4.0 * Nes::Const::FrameCounter::fourStepPeriod / Nes::Const::Audio::cpuClockRate;
+    ASSERT_NEAR(crossings, 2 * 440 * seconds, 10);
+}
+
+TEST(Core_APU, Output_DisabledDropsSamples) {
+    Nes::Cartridge cartridge;
+    Nes::MMU mmu(cartridge);
+    Nes::Scheduler scheduler;
+    Nes::APU apu(mmu, scheduler);
+
+    auto callbacks = 0;
+    apu.setAudioCallback([&](auto) { callbacks++; });
+
+    apu.setOutputEnabled(false);
+    runApu(scheduler, Nes::Const::FrameCounter::fourStepPeriod);
+    apu.endFrame();
+    ASSERT_EQ(callbacks, 0);
+
+    apu.setOutputEnabled(true);
+    runApu(scheduler, Nes::Const::FrameCounter::fourStepPeriod);
+    apu.endFrame();
+    ASSERT_EQ(callbacks, 1);
+}
+
+TEST(Core_APU, Output_SampleRateRatioAppliesNextFrame) {
+    Nes::Cartridge cartridge;
+    Nes::MMU mmu(cartridge);
+    Nes::Scheduler scheduler;
+    Nes::APU apu(mmu, scheduler);
+
+    std::size_t sampleCount = 0;
+    apu.setAudioCallback([&](auto frameSamples) { sampleCount += frameSamples.size(); });
+
+    constexpr auto frames = 60;
+    const double nominal = frames * Nes::Const::FrameCounter::fourStepPeriod / Nes::Const::Audio::cpuClockRate *
+                           Nes::Const::Audio::sampleRate;
+
+    apu.setSampleRateRatio(1.005);
+    runApu(scheduler, Nes::Const::FrameCounter::fourStepPeriod);
+    apu.endFrame();
+    ASSERT_NEAR(static_cast<double>(sampleCount), nominal / frames, 1.0);
+
+    sampleCount = 0;
+    for (auto frame = 0; frame < frames; frame++) {
+        runApu(scheduler, Nes::Const::FrameCounter::fourStepPeriod);
+        apu.endFrame();
+    }
+
+    ASSERT_NEAR(static_cast<double>(sampleCount), nominal * 1.005, 2.0);
+}
@@ -0,0 +1,47 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "Core/VirtualMachine.hpp"
+
+namespace {
+    const std::string testRomPath = std::string(TEST_DIR_BLARGG) + "Instructions/Roms/01-basics.nes";
+    constexpr int testFrameCount  = 120;
+}
+
+TEST(Core_CPU, Run_MatchesStepByStepTicks) {
+    Nes::VirtualMachine tickedMachine{[](auto){}};
+    Nes::VirtualMachine runMachine{[](auto){}};
+
+    ASSERT_TRUE(tickedMachine.loadRom(testRomPath).has_value());
+    ASSERT_TRUE(runMachine.loadRom(testRomPath).has_value());
+
+    for (auto frame = 0; frame < testFrameCount; frame++) {
+        Nes::CycleCount tickedCycles = 0;
+        while (tickedCycles < Nes::Const::cyclesPerFrame) {
+            tickedCycles += tickedMachine.accessCPU()->tick();
+        }
+
+        const auto runCycles = runMachine.accessCPU()->run(Nes::Const::cyclesPerFrame);
+
+        ASSERT_EQ(tickedCycles, runCycles) << "In frame: " << frame;
+        ASSERT_EQ(tickedMachine.accessCPU()->instructionsExecuted(), runMachine.accessCPU()->instructionsExecuted());
+    }
+
+    ASSERT_EQ(tickedMachine.accessCPU()->textOutput(), runMachine.accessCPU()->textOutput());
+}
@@ -0,0 +1,44 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#ifndef CAIQUE_NES_CORE_TESTUTILS_HPP
+#define CAIQUE_NES_CORE_TESTUTILS_HPP
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "Core/VirtualMachine.hpp"
+
+namespace CoreTestUtils {
+    // Runs the same way on every machine and renders, which is all the tests of whole machines need
+    inline const std::string testRom = std::string(TEST_DIR_BLARGG) + "Instructions/Roms/01-basics.nes";
+
+    inline std::vector<Nes::Byte> captureState(const Nes::VirtualMachine& vm) {
+        std::vector<Nes::Byte> snapshot;
+        vm.saveState(snapshot);
+
+        return snapshot;
+    }
+
+    inline bool framesMatch(const Nes::FrameBuffer& first, const Nes::FrameBuffer& second) {
+        return std::equal(first.data(), first.data() + Nes::Const::screenWidth * Nes::Const::screenHeight,
+                          second.data());
+    }
+}
+
+#endif //CAIQUE_NES_CORE_TESTUTILS_HPP
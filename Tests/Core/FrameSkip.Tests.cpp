@@ -0,0 +1,81 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "Core/VirtualMachine.hpp"
+#include "Core.TestUtils.hpp"
+
+TEST(Core_FrameSkip, DrawsEveryNthFrame) {
+    constexpr int frameSkip  = 3;
+    constexpr int frameCount = 40;
+
+    Nes::VirtualMachine reference([](auto) {});
+    ASSERT_TRUE(reference.loadRom(CoreTestUtils::testRom).has_value());
+
+    int framesDrawn = 0;
+    Nes::VirtualMachine vm([&](auto) { framesDrawn++; });
+    ASSERT_TRUE(vm.loadRom(CoreTestUtils::testRom).has_value());
+    vm.setFrameSkip(frameSkip);
+
+    for (auto i = 0; i < frameCount; i++) {
+        reference.tick();
+        vm.tick();
+    }
+
+    ASSERT_EQ(framesDrawn, frameCount / (frameSkip + 1));
+    ASSERT_EQ(CoreTestUtils::captureState(vm), CoreTestUtils::captureState(reference));
+    ASSERT_TRUE(CoreTestUtils::framesMatch(vm.frameBuffer(), reference.frameBuffer()));
+}
+
+TEST(Core_FrameSkip, SkipFrame) {
+    Nes::VirtualMachine reference([](auto) {});
+    ASSERT_TRUE(reference.loadRom(CoreTestUtils::testRom).has_value());
+
+    int framesDrawn = 0;
+    Nes::VirtualMachine vm([&](auto) { framesDrawn++; });
+    ASSERT_TRUE(vm.loadRom(CoreTestUtils::testRom).has_value());
+
+    for (auto i = 0; i < 20; i++) {
+        reference.tick();
+        vm.skipFrame();
+    }
+
+    ASSERT_EQ(framesDrawn, 0);
+    ASSERT_EQ(CoreTestUtils::captureState(vm), CoreTestUtils::captureState(reference));
+
+    reference.tick();
+    vm.tick();
+
+    ASSERT_EQ(framesDrawn, 1);
+    ASSERT_TRUE(CoreTestUtils::framesMatch(vm.frameBuffer(), reference.frameBuffer()));
+}
+
+TEST(Core_FrameSkip, Disable) {
+    int framesDrawn = 0;
+    Nes::VirtualMachine vm([&](auto) { framesDrawn++; });
+    ASSERT_TRUE(vm.loadRom(CoreTestUtils::testRom).has_value());
+
+    vm.setFrameSkip(5);
+    vm.setFrameSkip(0);
+    for (auto i = 0; i < 10; i++) {
+        vm.tick();
+    }
+
+    ASSERT_EQ(framesDrawn, 10);
+}
@@ -113,3 +113,40 @@ TEST(Core_MMU, ReadWrite_CustomAccessors_WithExternalMemory) {
     ASSERT_EQ(mockMemory, 0xAB);
     ASSERT_EQ(mmu.read(0xB000), 0xAB);
 }
+
+TEST(Core_MMU, ReadWrite_MirrorRegion) {
+    Nes::Cartridge mockCart;
+    Nes::MMU mmu(mockCart);
+
+    mmu.write(0x0805, 0xAB);
+    mmu.write(0x1FFF, 0xCD);
+
+    ASSERT_EQ(mmu.read(0x0005), 0xAB);
+    ASSERT_EQ(mmu.read(0x1005), 0xAB);
+    ASSERT_EQ(mmu.read(0x07FF), 0xCD);
+}
+
+TEST(Core_MMU, ReadWrite_RegionsSharingPage) {
+    Nes::Cartridge mockCart;
+    Nes::MMU mmu(mockCart);
+    mmu.clearMemoryRegions();
+
+    Nes::Byte mockMemory = 0x00;
+    mmu.addMemoryRegion(Utils::Range<Nes::Addr>{0xB000, 0xB007},
+                        [&](Nes::MemoryRegion*, Nes::MMU*,  Nes::Addr,  Nes::Byte value) {
+                            mockMemory = value;
+                        },
+                        [&]( Nes::MemoryRegion*, const Nes::MMU*,  Nes::Addr) {
+                            return mockMemory;
+                        },
+                        false);
+    mmu.addMemoryRegion(Utils::Range<Nes::Addr>{0xB008, 0xBFFF});
+
+    mmu.write(0xB003, 0xAB);
+    mmu.write(0xB008, 0xCD);
+
+    ASSERT_EQ(mockMemory, 0xAB);
+    ASSERT_EQ(mmu.read(0xB000), 0xAB);
+    ASSERT_EQ(mmu.read(0xB008), 0xCD);
+    ASSERT_EQ(mmu.read(0xB100), 0x00);
+}
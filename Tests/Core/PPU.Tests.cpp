@@ -17,16 +17,19 @@
 ***********************************************************************************************************************/
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #define TESTING_ENVIRONMENT_PPU 1
 #include "Core/Cartridge.hpp"
 #include "Core/MMU.hpp"
 #include "Core/PPU.hpp"
 #undef TESTING_ENVIRONMENT_PPU
+#include "../Mappers/Mappers.TestUtils.hpp"
 
 TEST(Core_PPU, Nametables_Write) {
     Nes::Cartridge cartridge;
     Nes::MMU mmu(cartridge);
-    Nes::PPU ppu(mmu, [&](auto){});
+    Nes::Scheduler scheduler;
+    Nes::PPU ppu(mmu, scheduler, [&](auto){});
 
     ppu.handlePPURegisterWrite(Nes::Const::RegisterAddress::addr, 0x23);
     ppu.handlePPURegisterWrite(Nes::Const::RegisterAddress::addr, 0x05);
@@ -38,7 +41,8 @@ TEST(Core_PPU, Nametables_Write) {
 TEST(Core_PPU, Nametables_Read) {
     Nes::Cartridge cartridge;
     Nes::MMU mmu(cartridge);
-    Nes::PPU ppu(mmu, [&](auto){});
+    Nes::Scheduler scheduler;
+    Nes::PPU ppu(mmu, scheduler, [&](auto){});
 
     ppu.handlePPURegisterWrite(Nes::Const::RegisterAddress::control, 0x00);
     ppu.accessNametables()[0x0305] = 0x66;
@@ -55,7 +59,8 @@ TEST(Core_PPU, Nametables_Read) {
 TEST(Core_PPU, Nametables_Read_CrossPage) {
     Nes::Cartridge cartridge;
     Nes::MMU mmu(cartridge);
-    Nes::PPU ppu(mmu, [&](auto){});
+    Nes::Scheduler scheduler;
+    Nes::PPU ppu(mmu, scheduler, [&](auto){});
 
     ppu.handlePPURegisterWrite(Nes::Const::RegisterAddress::control, 0x00);
     ppu.accessNametables()[0x01FF] = 0x66;
@@ -73,7 +78,8 @@ TEST(Core_PPU, Nametables_Read_CrossPage) {
 TEST(Core_PPU, Nametables_Read_Step) {
     Nes::Cartridge cartridge;
     Nes::MMU mmu(cartridge);
-    Nes::PPU ppu(mmu, [&](auto){});
+    Nes::Scheduler scheduler;
+    Nes::PPU ppu(mmu, scheduler, [&](auto){});
 
     ppu.handlePPURegisterWrite(Nes::Const::RegisterAddress::control, 0b100);
     ppu.accessNametables()[0x01FF] = 0x66;
@@ -95,7 +101,8 @@ TEST(Core_PPU, Nametables_Mirror_Horizontal) {
     cartridge.forceMirroring(Nes::Mirroring::Horizontal);
 
     Nes::MMU mmu(cartridge);
-    Nes::PPU ppu(mmu, [&](auto){});
+    Nes::Scheduler scheduler;
+    Nes::PPU ppu(mmu, scheduler, [&](auto){});
 
     ppu.handlePPURegisterWrite(Nes::Const::RegisterAddress::addr, 0x24);
     ppu.handlePPURegisterWrite(Nes::Const::RegisterAddress::addr, 0x05);
@@ -124,7 +131,8 @@ TEST(Core_PPU, Nametables_Mirror_Vertical) {
     cartridge.forceMirroring(Nes::Mirroring::Vertical);
 
     Nes::MMU mmu(cartridge);
-    Nes::PPU ppu(mmu, [&](auto){});
+    Nes::Scheduler scheduler;
+    Nes::PPU ppu(mmu, scheduler, [&](auto){});
 
     ppu.handlePPURegisterWrite(Nes::Const::RegisterAddress::addr, 0x20);
     ppu.handlePPURegisterWrite(Nes::Const::RegisterAddress::addr, 0x05);
@@ -151,7 +159,8 @@ TEST(Core_PPU, Nametables_Mirror_Vertical) {
 TEST(Core_PPU, Nametables_Mirroring) {
     Nes::Cartridge cartridge;
     Nes::MMU mmu(cartridge);
-    Nes::PPU ppu(mmu, [&](auto){});
+    Nes::Scheduler scheduler;
+    Nes::PPU ppu(mmu, scheduler, [&](auto){});
 
     ppu.handlePPURegisterWrite(Nes::Const::RegisterAddress::control, 0x00);
     ppu.accessNametables()[0x0305] = 0x66;
@@ -166,7 +175,8 @@ TEST(Core_PPU, Nametables_Mirroring) {
 TEST(Core_PPU, OAM_ReadWrite) {
     Nes::Cartridge cartridge;
     Nes::MMU mmu(cartridge);
-    Nes::PPU ppu(mmu, [&](auto){});
+    Nes::Scheduler scheduler;
+    Nes::PPU ppu(mmu, scheduler, [&](auto){});
 
     ppu.handlePPURegisterWrite(Nes::Const::RegisterAddress::oamAddr, 0x10);
     ppu.handlePPURegisterWrite(Nes::Const::RegisterAddress::oamData, 0x66);
@@ -182,7 +192,8 @@ TEST(Core_PPU, OAM_ReadWrite) {
 TEST(Core_PPU, Status_ResetsVBlank) {
     Nes::Cartridge cartridge;
     Nes::MMU mmu(cartridge);
-    Nes::PPU ppu(mmu, [&](auto){});
+    Nes::Scheduler scheduler;
+    Nes::PPU ppu(mmu, scheduler, [&](auto){});
 
     ppu.accesssStatus().setBit(Nes::StatusRegisterFlag::VBlank);
 
@@ -197,7 +208,8 @@ TEST(Core_PPU, Status_LatchReset) {
     cartridge.loadEmptyTestCartridge();
     cartridge.forceMirroring(Nes::Mirroring::Horizontal);
     Nes::MMU mmu(cartridge);
-    Nes::PPU ppu(mmu, [&](auto){});
+    Nes::Scheduler scheduler;
+    Nes::PPU ppu(mmu, scheduler, [&](auto){});
 
     ppu.accessNametables()[0x0305] = 0x66;
     ppu.handlePPURegisterWrite(Nes::Const::RegisterAddress::addr, 0x21);
@@ -215,3 +227,224 @@ TEST(Core_PPU, Status_LatchReset) {
     ppu.handlePPURegisterRead(Nes::Const::RegisterAddress::data);
     ASSERT_EQ(ppu.handlePPURegisterRead(Nes::Const::RegisterAddress::data), 0x66);
 }
+
+static void tickUntilFrameDrawn(Nes::PPU& ppu, const bool& frameDrawn) {
+    while (!frameDrawn) {
+        ppu.tick(1);
+    }
+}
+
+TEST(Core_PPU, Rendering_BackgroundScrollX) {
+    Nes::Cartridge cartridge;
+    cartridge.loadEmptyTestCartridge();
+    cartridge.forceMirroring(Nes::Mirroring::Vertical);
+    cartridge.directWriteCHR(0x0010, 0xFF);
+
+    bool frameDrawn = false;
+    Nes::FrameBuffer frame;
+
+    Nes::MMU mmu(cartridge);
+    Nes::Scheduler scheduler;
+    Nes::PPU ppu(mmu, scheduler, [&](const Nes::FrameBuffer& frameBuffer) {
+        frame = frameBuffer;
+        frameDrawn = true;
+    });
+
+    ppu.accessNametables()[0x0001] = 0x01;
+    ppu.accessPalettes()[0x00] = 0x0F;
+    ppu.accessPalettes()[0x01] = 0x30;
+
+    ppu.handlePPURegisterWrite(Nes::Const::RegisterAddress::mask, 0b1010);
+    ppu.handlePPURegisterWrite(Nes::Const::RegisterAddress::scroll, 4);
+    ppu.handlePPURegisterWrite(Nes::Const::RegisterAddress::scroll, 0);
+
+    tickUntilFrameDrawn(ppu, frameDrawn);
+
+    ASSERT_EQ(frame.getPixel(3, 0),  Nes::getSystemColor(0x0F));
+    ASSERT_EQ(frame.getPixel(4, 0),  Nes::getSystemColor(0x30));
+    ASSERT_EQ(frame.getPixel(11, 0), Nes::getSystemColor(0x30));
+    ASSERT_EQ(frame.getPixel(12, 0), Nes::getSystemColor(0x0F));
+    ASSERT_EQ(frame.getPixel(4, 1),  Nes::getSystemColor(0x0F));
+}
+
+TEST(Core_PPU, Rendering_SpriteZeroHit) {
+    Nes::Cartridge cartridge;
+    cartridge.loadEmptyTestCartridge();
+    cartridge.forceMirroring(Nes::Mirroring::Vertical);
+    cartridge.directWriteCHR(0x0010, 0xFF);
+
+    bool frameDrawn = false;
+    Nes::FrameBuffer frame;
+
+    Nes::MMU mmu(cartridge);
+    Nes::Scheduler scheduler;
+    Nes::PPU ppu(mmu, scheduler, [&](const Nes::FrameBuffer& frameBuffer) {
+        frame = frameBuffer;
+        frameDrawn = true;
+    });
+
+    ppu.accessNametables()[0x0021] = 0x01;
+    ppu.accessPalettes()[0x01] = 0x30;
+    ppu.accessPalettes()[0x11] = 0x16;
+
+    ppu.accessOam()[0] = 8;
+    ppu.accessOam()[1] = 0x01;
+    ppu.accessOam()[2] = 0x00;
+    ppu.accessOam()[3] = 12;
+
+    ppu.handlePPURegisterWrite(Nes::Const::RegisterAddress::mask, 0b11110);
+
+    bool spriteZeroHit = false;
+    while (!frameDrawn) {
+        ppu.tick(1);
+        spriteZeroHit |= ppu.accesssStatus().isBitSet(Nes::StatusRegisterFlag::SpriteHitZero);
+    }
+
+    ASSERT_TRUE(spriteZeroHit);
+
+    ASSERT_EQ(frame.getPixel(11, 8), Nes::getSystemColor(0x30));
+    ASSERT_EQ(frame.getPixel(12, 8), Nes::getSystemColor(0x16));
+    ASSERT_EQ(frame.getPixel(19, 8), Nes::getSystemColor(0x16));
+    ASSERT_EQ(frame.getPixel(12, 9), Nes::getSystemColor(0x00));
+}
+
+TEST(Core_PPU, Rendering_FrameTarget) {
+    Nes::Cartridge cartridge;
+    cartridge.loadEmptyTestCartridge();
+
+    Nes::FrameBuffer target;
+    const Nes::FrameBuffer* drawnFrame = nullptr;
+
+    bool frameDrawn = false;
+    Nes::MMU mmu(cartridge);
+    Nes::Scheduler scheduler;
+    Nes::PPU ppu(mmu, scheduler, [&](const Nes::FrameBuffer& frameBuffer) {
+        drawnFrame = &frameBuffer;
+        frameDrawn = true;
+    });
+
+    ppu.accessPalettes()[0x00] = 0x30;
+    ppu.setFrameTarget(&target);
+
+    tickUntilFrameDrawn(ppu, frameDrawn);
+
+    ASSERT_EQ(drawnFrame, &target);
+    ASSERT_EQ(&ppu.frameBuffer(), &target);
+    ASSERT_EQ(target.getPixel(0, 0), Nes::getSystemColor(0x30));
+    ASSERT_EQ(target.getPixel(255, 239), Nes::getSystemColor(0x30));
+
+    ppu.setFrameTarget(nullptr);
+    ASSERT_NE(&ppu.frameBuffer(), &target);
+}
+
+TEST(Core_PPU, CyclesUntilFrameEnd) {
+    Nes::Cartridge cartridge;
+    Nes::MMU mmu(cartridge);
+    Nes::Scheduler scheduler;
+
+    bool frameDrawn = false;
+    Nes::PPU ppu(mmu, scheduler, [&](auto) { frameDrawn = true; });
+
+    const auto cycles = ppu.cpuCyclesUntilFrameEnd();
+    for (auto i = 0; i < cycles - 1; i++) {
+        ppu.tick(1);
+    }
+
+    ASSERT_FALSE(frameDrawn);
+
+    ppu.tick(1);
+    ASSERT_TRUE(frameDrawn);
+}
+
+TEST(Core_PPU, Rendering_SpriteZeroHit_DrawDisabled) {
+    Nes::Cartridge cartridge;
+    cartridge.loadEmptyTestCartridge();
+    cartridge.forceMirroring(Nes::Mirroring::Vertical);
+    cartridge.directWriteCHR(0x0010, 0xFF);
+
+    bool frameDrawn = false;
+    Nes::MMU mmu(cartridge);
+    Nes::Scheduler scheduler;
+    Nes::PPU ppu(mmu, scheduler, [&](auto) { frameDrawn = true; });
+
+    ppu.accessNametables()[0x0021] = 0x01;
+    ppu.accessOam()[0] = 8;
+    ppu.accessOam()[1] = 0x01;
+    ppu.accessOam()[3] = 12;
+
+    ppu.handlePPURegisterWrite(Nes::Const::RegisterAddress::mask, 0b11110);
+    ppu.setDrawEnabled(false);
+
+    bool spriteZeroHit = false;
+    const auto cycles  = ppu.cpuCyclesUntilFrameEnd();
+    for (auto i = 0; i < cycles; i++) {
+        ppu.tick(1);
+        spriteZeroHit |= ppu.accesssStatus().isBitSet(Nes::StatusRegisterFlag::SpriteHitZero);
+    }
+
+    ASSERT_TRUE(spriteZeroHit);
+    ASSERT_FALSE(frameDrawn);
+}
+
+TEST(Core_PPU, Rendering_CHRSwitchMidFrame) {
+    // Tile 1 is solid in the first CHR bank and empty in the second one
+    auto bytes = MapperTestUtils::createMockROMBytes(3, 2, 2);
+    const auto chrStart = Nes::Const::headerSize + Utils::kilobytesToBytes(32);
+    std::fill_n(bytes.begin() + chrStart + Nes::Const::tileSize, 8, 0xFF);
+
+    Nes::Cartridge cartridge;
+    ASSERT_TRUE(cartridge.loadRawBytes(bytes).has_value());
+
+    bool frameDrawn = false;
+    Nes::FrameBuffer frame;
+
+    Nes::MMU mmu(cartridge);
+    Nes::Scheduler scheduler;
+    Nes::PPU ppu(mmu, scheduler, [&](const Nes::FrameBuffer& frameBuffer) {
+        frame = frameBuffer;
+        frameDrawn = true;
+    });
+
+    std::fill_n(ppu.accessNametables().begin(), 0x3C0, 0x01);
+    ppu.accessPalettes()[0x00] = 0x0F;
+    ppu.accessPalettes()[0x01] = 0x30;
+    ppu.handlePPURegisterWrite(Nes::Const::RegisterAddress::mask, 0b1010);
+
+    // Nothing is due before vblank, the PPU lags behind until the bank switch catches it up
+    const auto switchAt = 120 * Nes::Const::ppuCycleThreshold / Nes::Const::cpuToPpuCycleMultiplier;
+    while (scheduler.now() < switchAt) {
+        ppu.tick(1);
+    }
+
+    cartridge.mappedWritePRG(0x0000, 1);
+    tickUntilFrameDrawn(ppu, frameDrawn);
+
+    ASSERT_EQ(frame.getPixel(0, 8),   Nes::getSystemColor(0x30));
+    ASSERT_EQ(frame.getPixel(0, 100), Nes::getSystemColor(0x30));
+    ASSERT_EQ(frame.getPixel(0, 200), Nes::getSystemColor(0x0F));
+}
+
+TEST(Core_PPU, ScanlineCounter_IrqOnScanline) {
+    Nes::Cartridge cartridge;
+    ASSERT_TRUE(cartridge.loadRawBytes(MapperTestUtils::createMockROMBytes(4, 2, 1)).has_value());
+
+    Nes::MMU mmu(cartridge);
+    Nes::Scheduler scheduler;
+    Nes::PPU ppu(mmu, scheduler, [&](auto) {});
+
+    ppu.handlePPURegisterWrite(Nes::Const::RegisterAddress::control, 0b1000);
+    ppu.handlePPURegisterWrite(Nes::Const::RegisterAddress::mask, 0b11000);
+
+    // Reloaded on the first rise and counted down on the next ten, so it fires at the end of scanline 10
+    cartridge.mappedWritePRG(0x4000, 10);
+    cartridge.mappedWritePRG(0x4001, 0);
+    cartridge.mappedWritePRG(0x6001, 0);
+
+    while (!scheduler.isIrqAsserted(Nes::IrqSource::Mapper)) {
+        ppu.tick(1);
+    }
+
+    const auto expected = static_cast<double>(11 * Nes::Const::ppuCycleThreshold - Nes::Const::ppuInitialCycles) /
+                          Nes::Const::cpuToPpuCycleMultiplier;
+    ASSERT_NEAR(static_cast<double>(scheduler.now()), expected, 1.0);
+}
@@ -0,0 +1,112 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#define TESTING_ENVIRONMENT_PPU 1
+#include "Core/Cartridge.hpp"
+#include "Core/PatternCache.hpp"
+#undef TESTING_ENVIRONMENT_PPU
+#include "../Mappers/Mappers.TestUtils.hpp"
+
+TEST(Core_PatternCache, DecodeTile) {
+    std::array<Nes::Byte, Nes::Const::tileSize> bytes{0};
+    bytes[0] = 0b10000001;
+    bytes[8] = 0b00000011;
+    bytes[15] = 0b11111111;
+
+    Nes::PatternCache cache;
+    cache.decodeTile(3, bytes);
+
+    const Nes::PatternRow firstRow = {1, 0, 0, 0, 0, 0, 2, 3};
+    const Nes::PatternRow lastRow  = {2, 2, 2, 2, 2, 2, 2, 2};
+
+    ASSERT_TRUE(cache.isTileDecoded(3));
+    ASSERT_EQ(cache.getRow(3, 0), firstRow);
+    ASSERT_EQ(cache.getRow(3, 7), lastRow);
+}
+
+TEST(Core_PatternCache, InvalidateTile) {
+    Nes::PatternCache cache;
+    cache.decodeTile(1, {});
+    cache.decodeTile(2, {});
+
+    cache.invalidateTile(1);
+    ASSERT_FALSE(cache.isTileDecoded(1));
+    ASSERT_TRUE(cache.isTileDecoded(2));
+
+    cache.decodeTile(1, {});
+    cache.decodeTile(3, {});
+    cache.invalidateTiles(1, 2);
+    ASSERT_FALSE(cache.isTileDecoded(1));
+    ASSERT_FALSE(cache.isTileDecoded(2));
+    ASSERT_TRUE(cache.isTileDecoded(3));
+
+    cache.invalidate();
+    ASSERT_FALSE(cache.isTileDecoded(2));
+}
+
+TEST(Core_PatternCache, Cartridge_ReadPatternRow) {
+    Nes::Cartridge cartridge;
+    cartridge.loadEmptyTestCartridge();
+
+    cartridge.directWriteCHR(0x1010, 0xFF);
+    ASSERT_EQ(cartridge.mappedReadPatternRow(0x101, 0)[0], 1);
+
+    cartridge.directWriteCHR(0x1018, 0xFF);
+    ASSERT_EQ(cartridge.mappedReadPatternRow(0x101, 0)[0], 1);
+
+    cartridge.invalidatePatternCache();
+    ASSERT_EQ(cartridge.mappedReadPatternRow(0x101, 0)[0], 3);
+}
+
+TEST(Core_PatternCache, Cartridge_BankSwitchKeepsOtherWindows) {
+    Nes::Cartridge cartridge;
+    ASSERT_TRUE(cartridge.loadRawBytes(MapperTestUtils::createMockROMBytes(4, 2, 1)).has_value());
+
+    ASSERT_EQ(cartridge.mappedReadPatternRow(0x000, 0)[0], 0);
+    ASSERT_EQ(cartridge.mappedReadPatternRow(0x140, 0)[0], 0);
+
+    // Changes the data behind every window without telling the cache, only switched windows are decoded again
+    cartridge.directWriteCHR(0x0000, 0xFF);
+    cartridge.mappedWritePRG(0x0000, 2);
+    cartridge.mappedWritePRG(0x0001, 0);
+    ASSERT_EQ(cartridge.mappedReadPatternRow(0x000, 0)[0], 0);
+
+    cartridge.mappedWritePRG(0x0000, 3);
+    cartridge.mappedWritePRG(0x0001, 1);
+    cartridge.mappedWritePRG(0x0001, 0);
+    ASSERT_EQ(cartridge.mappedReadPatternRow(0x000, 0)[0], 0);
+    ASSERT_EQ(cartridge.mappedReadPatternRow(0x140, 0)[0], 1);
+}
+
+TEST(Core_PatternCache, Cartridge_CHRRamWriteInvalidatesEveryWindowOfBank) {
+    Nes::Cartridge cartridge;
+    ASSERT_TRUE(cartridge.loadRawBytes(MapperTestUtils::createMockROMBytes(4, 2, 0)).has_value());
+
+    // All bank registers start at zero, the first 1 KB of CHR RAM is seen through windows 0, 2, 4, 5, 6 and 7
+    ASSERT_EQ(cartridge.mappedReadPatternRow(0x000, 0)[0], 0);
+    ASSERT_EQ(cartridge.mappedReadPatternRow(0x100, 0)[0], 0);
+    ASSERT_EQ(cartridge.mappedReadPatternRow(0x1C0, 0)[0], 0);
+
+    cartridge.mappedWriteCHR(0x1000, 0xFF);
+
+    ASSERT_EQ(cartridge.mappedReadPatternRow(0x000, 0)[0], 1);
+    ASSERT_EQ(cartridge.mappedReadPatternRow(0x100, 0)[0], 1);
+    ASSERT_EQ(cartridge.mappedReadPatternRow(0x1C0, 0)[0], 1);
+    ASSERT_EQ(cartridge.mappedReadPatternRow(0x040, 0)[0], 0);
+}
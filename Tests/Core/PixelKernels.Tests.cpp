@@ -0,0 +1,63 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "Core/PixelKernels.hpp"
+
+TEST(Core_PixelKernels, DecodePatternRow_MatchesScalar) {
+    for (auto lowerPlane = 0; lowerPlane <= UINT8_MAX; lowerPlane++) {
+        for (auto upperPlane = 0; upperPlane <= UINT8_MAX; upperPlane++) {
+            Nes::PatternRow expected{0};
+            Nes::PatternRow actual{0};
+
+            Nes::PixelKernels::Scalar::decodePatternRow(lowerPlane, upperPlane, expected);
+            Nes::PixelKernels::decodePatternRow(lowerPlane, upperPlane, actual);
+
+            ASSERT_EQ(expected, actual);
+        }
+    }
+}
+
+TEST(Core_PixelKernels, DecodePatternRow_PixelOrder) {
+    Nes::PatternRow row{0};
+    Nes::PixelKernels::decodePatternRow(0b10000001, 0b00000011, row);
+
+    const Nes::PatternRow expected = {1, 0, 0, 0, 0, 0, 2, 3};
+    ASSERT_EQ(row, expected);
+}
+
+TEST(Core_PixelKernels, ResolveColors_MatchesScalar) {
+    Nes::PaletteColors colors{0};
+    for (auto i = 0; i < Nes::Const::paletteColorCount; i++) {
+        colors[i] = 0xFF000000 | (i * 0x010203);
+    }
+
+    // Odd length so the tail after the vectorized part is covered as well
+    std::array<Nes::Byte, 261> indexes{0};
+    for (std::size_t i = 0; i < indexes.size(); i++) {
+        indexes[i] = (i * 7) % Nes::Const::paletteColorCount;
+    }
+
+    std::array<Graphics::PixelColor, indexes.size()> expected{0};
+    std::array<Graphics::PixelColor, indexes.size()> actual{0};
+
+    Nes::PixelKernels::Scalar::resolveColors(indexes.data(), colors, expected.data(), indexes.size());
+    Nes::PixelKernels::resolveColors(indexes.data(), colors, actual.data(), indexes.size());
+
+    ASSERT_EQ(expected, actual);
+}
@@ -0,0 +1,144 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "Core/RewindBuffer.hpp"
+#include "Core.TestUtils.hpp"
+
+TEST(Core_RewindBuffer, RewindRestoresEveryFrame) {
+    constexpr int frameCount = 25;
+
+    Nes::VirtualMachine vm([](auto) {});
+    ASSERT_TRUE(vm.loadRom(CoreTestUtils::testRom).has_value());
+
+    Nes::RewindBuffer rewindBuffer(frameCount, 10);
+    std::vector<std::vector<Nes::Byte>> expectedStates;
+    for (auto i = 0; i < frameCount; i++) {
+        expectedStates.push_back(CoreTestUtils::captureState(vm));
+        rewindBuffer.capture(vm);
+        vm.tick();
+    }
+
+    ASSERT_EQ(rewindBuffer.size(), frameCount);
+    for (auto i = frameCount - 1; i >= 0; i--) {
+        ASSERT_TRUE(rewindBuffer.rewind(vm));
+        ASSERT_EQ(CoreTestUtils::captureState(vm), expectedStates[i]);
+    }
+
+    ASSERT_EQ(rewindBuffer.size(), 0);
+    ASSERT_FALSE(rewindBuffer.rewind(vm));
+}
+
+TEST(Core_RewindBuffer, CaptureAfterRewind) {
+    Nes::VirtualMachine vm([](auto) {});
+    ASSERT_TRUE(vm.loadRom(CoreTestUtils::testRom).has_value());
+
+    Nes::RewindBuffer rewindBuffer(20, 4);
+    for (auto i = 0; i < 6; i++) {
+        rewindBuffer.capture(vm);
+        vm.tick();
+    }
+
+    ASSERT_TRUE(rewindBuffer.rewind(vm));
+    ASSERT_TRUE(rewindBuffer.rewind(vm));
+
+    const auto expectedState = CoreTestUtils::captureState(vm);
+    rewindBuffer.capture(vm);
+    vm.tick();
+    rewindBuffer.capture(vm);
+
+    ASSERT_TRUE(rewindBuffer.rewind(vm));
+    ASSERT_TRUE(rewindBuffer.rewind(vm));
+    ASSERT_EQ(CoreTestUtils::captureState(vm), expectedState);
+    ASSERT_EQ(rewindBuffer.size(), 4);
+}
+
+TEST(Core_RewindBuffer, RewindKeepsHeldButtons) {
+    Nes::VirtualMachine vm([](auto) {});
+    ASSERT_TRUE(vm.loadRom(CoreTestUtils::testRom).has_value());
+
+    Nes::RewindBuffer rewindBuffer(8);
+    rewindBuffer.capture(vm);
+    vm.tick();
+
+    vm.handleKeyPress(Nes::JoypadButton::Left);
+    rewindBuffer.capture(vm);
+    vm.tick();
+
+    ASSERT_TRUE(rewindBuffer.rewind(vm));
+    ASSERT_TRUE(rewindBuffer.rewind(vm));
+    ASSERT_TRUE(vm.isKeyPressed(Nes::JoypadButton::Left));
+}
+
+TEST(Core_RewindBuffer, DropsOldestKeyframeGroupWhenFull) {
+    constexpr int capacity = 12;
+    constexpr int keyframeInterval = 4;
+
+    Nes::VirtualMachine vm([](auto) {});
+    ASSERT_TRUE(vm.loadRom(CoreTestUtils::testRom).has_value());
+
+    Nes::RewindBuffer rewindBuffer(capacity, keyframeInterval);
+    std::vector<std::vector<Nes::Byte>> expectedStates;
+    for (auto i = 0; i < capacity * 3; i++) {
+        expectedStates.push_back(CoreTestUtils::captureState(vm));
+        rewindBuffer.capture(vm);
+        vm.tick();
+
+        ASSERT_LE(rewindBuffer.size(), capacity);
+        if (i >= capacity) {
+            ASSERT_GT(rewindBuffer.size(), capacity - keyframeInterval);
+        }
+    }
+
+    const auto remaining = rewindBuffer.size();
+    for (std::size_t i = 0; i < remaining; i++) {
+        ASSERT_TRUE(rewindBuffer.rewind(vm));
+        ASSERT_EQ(CoreTestUtils::captureState(vm), expectedStates[expectedStates.size() - 1 - i]);
+    }
+
+    ASSERT_FALSE(rewindBuffer.rewind(vm));
+}
+
+TEST(Core_RewindBuffer, DeltasAreSmallerThanSnapshots) {
+    constexpr int frameCount = 120;
+
+    Nes::VirtualMachine vm([](auto) {});
+    ASSERT_TRUE(vm.loadRom(CoreTestUtils::testRom).has_value());
+
+    Nes::RewindBuffer rewindBuffer(frameCount);
+    for (auto i = 0; i < frameCount; i++) {
+        rewindBuffer.capture(vm);
+        vm.tick();
+    }
+
+    ASSERT_LT(rewindBuffer.memoryUsage(), CoreTestUtils::captureState(vm).size() * frameCount / 4);
+}
+
+TEST(Core_RewindBuffer, Clear) {
+    Nes::VirtualMachine vm([](auto) {});
+    ASSERT_TRUE(vm.loadRom(CoreTestUtils::testRom).has_value());
+
+    Nes::RewindBuffer rewindBuffer(8);
+    rewindBuffer.capture(vm);
+    rewindBuffer.clear();
+
+    ASSERT_EQ(rewindBuffer.size(), 0);
+    ASSERT_EQ(rewindBuffer.capacity(), 8);
+    ASSERT_FALSE(rewindBuffer.rewind(vm));
+}
@@ -0,0 +1,189 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "Core/Cartridge.hpp"
+#include "Core/RomHeader.hpp"
+#include "../Mappers/Mappers.TestUtils.hpp"
+
+TEST(Core_RomHeader, INes) {
+    auto bytes = MapperTestUtils::createMockROMBytes(1, 2, 1);
+    bytes[Nes::Const::AddressOf::flag6] |= 0b0011;
+
+    const auto header = Nes::RomHeader::parse(bytes);
+    ASSERT_TRUE(header.has_value());
+
+    ASSERT_FALSE(header->isNes2);
+    ASSERT_EQ(header->mapperId, 1);
+    ASSERT_EQ(header->mirroring, Nes::Mirroring::Vertical);
+    ASSERT_TRUE(header->hasBattery);
+    ASSERT_EQ(header->prgRomSize, Utils::kilobytesToBytes(32));
+    ASSERT_EQ(header->chrRomSize, Utils::kilobytesToBytes(8));
+    ASSERT_EQ(header->prgNvRamSize, Utils::kilobytesToBytes(8));
+    ASSERT_EQ(header->chrRamSize, 0);
+    ASSERT_EQ(header->prgRom(bytes).data(), bytes.data() + Nes::Const::headerSize);
+    ASSERT_TRUE(header->checkSupported().has_value());
+}
+
+TEST(Core_RomHeader, INes_ArchaicGarbageIgnoresUpperMapperNibble) {
+    auto bytes = MapperTestUtils::createMockROMBytes(0x41, 2, 1);
+    std::copy_n("DiskDude!", 9, bytes.begin() + 7);
+
+    const auto header = Nes::RomHeader::parse(bytes);
+    ASSERT_TRUE(header.has_value());
+    ASSERT_EQ(header->mapperId, 1);
+}
+
+TEST(Core_RomHeader, Nes2) {
+    auto bytes = MapperTestUtils::createMockROMBytes(4, 2, 1);
+    bytes[Nes::Const::AddressOf::flag7]  |= 0b1000;
+    bytes[Nes::Const::AddressOf::flag8]   = 0x31;
+    bytes[Nes::Const::AddressOf::flag10]  = 0x77;
+    bytes[Nes::Const::AddressOf::flag11]  = 0x07;
+    bytes[Nes::Const::AddressOf::flag12]  = 0x03;
+
+    const auto header = Nes::RomHeader::parse(bytes);
+    ASSERT_TRUE(header.has_value());
+
+    ASSERT_TRUE(header->isNes2);
+    ASSERT_EQ(header->mapperId, 0x104);
+    ASSERT_EQ(header->submapper, 3);
+    ASSERT_EQ(header->prgRamSize, Utils::kilobytesToBytes(8));
+    ASSERT_EQ(header->prgNvRamSize, Utils::kilobytesToBytes(8));
+    ASSERT_EQ(header->chrRamSize, Utils::kilobytesToBytes(8));
+    ASSERT_EQ(header->chrNvRamSize, 0);
+    ASSERT_EQ(header->tvSystem, Nes::TVSystem::Dendy);
+    ASSERT_FALSE(header->checkSupported().has_value());
+}
+
+TEST(Core_RomHeader, Nes2_ExponentSize) {
+    auto bytes = MapperTestUtils::createMockROMBytes(0, 2, 1);
+    bytes[Nes::Const::AddressOf::flag7] |= 0b1000;
+
+    // 2^15 * 1 bytes of PRG ROM
+    bytes[Nes::Const::AddressOf::sizeOfPRG] = 15 << 2;
+    bytes[Nes::Const::AddressOf::flag9]     = 0x0F;
+
+    const auto header = Nes::RomHeader::parse(bytes);
+    ASSERT_TRUE(header.has_value());
+    ASSERT_EQ(header->prgRomSize, Utils::kilobytesToBytes(32));
+}
+
+TEST(Core_RomHeader, Nes2_ExponentSizeOfPartialBanks) {
+    auto bytes = MapperTestUtils::createMockROMBytes(4, 1, 1);
+    bytes[Nes::Const::AddressOf::flag7] |= 0b1000;
+
+    // 2^12 * 1 bytes of PRG ROM, half of one of MMC3's 8 KB banks
+    bytes[Nes::Const::AddressOf::sizeOfPRG] = 12 << 2;
+    bytes[Nes::Const::AddressOf::flag9]     = 0x0F;
+
+    auto header = Nes::RomHeader::parse(bytes);
+    ASSERT_TRUE(header.has_value());
+    ASSERT_EQ(header->prgRomSize, Utils::kilobytesToBytes(4));
+    ASSERT_EQ(header->checkSupported().error(), Nes::RomHeaderError::UnsupportedSizes);
+
+    Nes::Cartridge cartridge;
+    ASSERT_FALSE(cartridge.loadRawBytes(bytes).has_value());
+
+    // 2^9 * 1 bytes of CHR ROM, less than a single 1 KB window
+    bytes[Nes::Const::AddressOf::sizeOfPRG] = 1;
+    bytes[Nes::Const::AddressOf::sizeOfCHR] = 9 << 2;
+    bytes[Nes::Const::AddressOf::flag9]     = 0xF0;
+
+    header = Nes::RomHeader::parse(bytes);
+    ASSERT_TRUE(header.has_value());
+    ASSERT_EQ(header->chrRomSize, 512);
+    ASSERT_EQ(header->checkSupported().error(), Nes::RomHeaderError::UnsupportedSizes);
+
+    // Whole 8 KB banks but not whole 16 KB ones, which UxROM switches
+    bytes[Nes::Const::AddressOf::flag6]     = (2 << 4);
+    bytes[Nes::Const::AddressOf::sizeOfCHR] = 0;
+    bytes[Nes::Const::AddressOf::flag9]     = 0x0F;
+    bytes[Nes::Const::AddressOf::sizeOfPRG] = 13 << 2;
+
+    header = Nes::RomHeader::parse(bytes);
+    ASSERT_TRUE(header.has_value());
+    ASSERT_EQ(header->mapperId, 2);
+    ASSERT_EQ(header->checkSupported().error(), Nes::RomHeaderError::UnsupportedSizes);
+}
+
+TEST(Core_RomHeader, Trainer) {
+    auto bytes = MapperTestUtils::createMockROMBytes(0, 1, 1);
+    bytes[Nes::Const::AddressOf::flag6] |= 0b0100;
+    bytes.insert(bytes.begin() + Nes::Const::headerSize, Nes::Const::trainerSize, 0xEA);
+
+    const auto header = Nes::RomHeader::parse(bytes);
+    ASSERT_TRUE(header.has_value());
+
+    ASSERT_EQ(header->trainer(bytes).size(), Nes::Const::trainerSize);
+    ASSERT_EQ(header->trainer(bytes).front(), 0xEA);
+    ASSERT_EQ(header->prgRom(bytes).data(), bytes.data() + Nes::Const::headerSize + Nes::Const::trainerSize);
+}
+
+TEST(Core_RomHeader, Failure_TooSmall) {
+    const std::vector<Nes::Byte> bytes = {'N', 'E', 'S', 0x1A};
+    ASSERT_EQ(Nes::RomHeader::parse(bytes).error(), Nes::RomHeaderError::TooSmall);
+}
+
+TEST(Core_RomHeader, Failure_BadConstant) {
+    auto bytes = MapperTestUtils::createMockROMBytes(0, 1, 1);
+    bytes[0] = 'X';
+    ASSERT_EQ(Nes::RomHeader::parse(bytes).error(), Nes::RomHeaderError::BadConstant);
+}
+
+TEST(Core_RomHeader, Failure_Truncated) {
+    auto bytes = MapperTestUtils::createMockROMBytes(0, 1, 1);
+    bytes.pop_back();
+    ASSERT_EQ(Nes::RomHeader::parse(bytes).error(), Nes::RomHeaderError::Truncated);
+
+    // Trainers are not counted into the PRG size, the file has to be larger
+    bytes = MapperTestUtils::createMockROMBytes(0, 1, 1);
+    bytes[Nes::Const::AddressOf::flag6] |= 0b0100;
+    ASSERT_EQ(Nes::RomHeader::parse(bytes).error(), Nes::RomHeaderError::Truncated);
+}
+
+TEST(Core_RomHeader, CartridgeKeepsTrainer) {
+    auto bytes = MapperTestUtils::createMockROMBytes(0, 1, 1);
+    bytes[Nes::Const::AddressOf::flag6] |= 0b0100;
+    bytes.insert(bytes.begin() + Nes::Const::headerSize, Nes::Const::trainerSize, 0xEA);
+    bytes[Nes::Const::headerSize + Nes::Const::trainerSize] = 0xAB;
+
+    Nes::Cartridge cartridge;
+    ASSERT_TRUE(cartridge.loadRawBytes(bytes).has_value());
+
+    ASSERT_EQ(cartridge.trainer().size(), Nes::Const::trainerSize);
+    ASSERT_EQ(cartridge.trainer().back(), 0xEA);
+    ASSERT_EQ(cartridge.mappedReadPRG(0x0000), 0xAB);
+}
+
+TEST(Core_RomHeader, CartridgeKeepsPreviousRomOnFailure) {
+    auto bytes = MapperTestUtils::createMockROMBytes(0, 1, 1);
+    bytes[Nes::Const::headerSize] = 0xAB;
+
+    Nes::Cartridge cartridge;
+    ASSERT_TRUE(cartridge.loadRawBytes(bytes).has_value());
+
+    ASSERT_EQ(cartridge.loadRawBytes(MapperTestUtils::createMockROMBytes(0xFF, 1, 1)).error(),
+              "Unable to parse ROM: Unsupported mapper with ID 255");
+    ASSERT_EQ(cartridge.loadRawBytes(MapperTestUtils::createMockROMBytes(0, 3, 1)).error(),
+              "Unable to parse ROM: Sanity check failed for mapper with ID 0");
+
+    ASSERT_EQ(cartridge.header().mapperId, 0);
+    ASSERT_EQ(cartridge.mappedReadPRG(0x0000), 0xAB);
+    ASSERT_EQ(cartridge.mappedReadPRG(0x4000), 0xAB);
+}
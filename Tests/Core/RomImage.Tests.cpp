@@ -0,0 +1,150 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include "Core/Cartridge.hpp"
+#include "Core/RomImage.hpp"
+#include "../Mappers/Mappers.TestUtils.hpp"
+#include "Core.TestUtils.hpp"
+
+TEST(Core_RomImage, SharedBetweenLoads) {
+    const auto first  = Nes::RomImageCache::global().load(CoreTestUtils::testRom);
+    const auto second = Nes::RomImageCache::global().load(CoreTestUtils::testRom);
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+
+    ASSERT_EQ(first->get(), second->get());
+}
+
+TEST(Core_RomImage, ReleasedWithLastUser) {
+    Nes::RomImageCache cache;
+    {
+        const auto image = cache.load(CoreTestUtils::testRom);
+        ASSERT_TRUE(image.has_value());
+        ASSERT_EQ(cache.size(), 1);
+    }
+
+    ASSERT_EQ(cache.size(), 0);
+}
+
+TEST(Core_RomImage, CartridgesSharePRG) {
+    Nes::Cartridge first;
+    Nes::Cartridge second;
+    ASSERT_TRUE(first.loadFromFilesystem(CoreTestUtils::testRom).has_value());
+    ASSERT_TRUE(second.loadFromFilesystem(CoreTestUtils::testRom).has_value());
+
+    ASSERT_TRUE(first.isSharingImage());
+    ASSERT_EQ(first.accessPRG().data(), second.accessPRG().data());
+    ASSERT_EQ(first.mappedPRGPointer(0x0000), second.mappedPRGPointer(0x0000));
+    ASSERT_EQ(first.checksum(), second.checksum());
+}
+
+TEST(Core_RomImage, CHRRamIsPrivate) {
+    const auto romPath = (std::filesystem::temp_directory_path() / "caique-nes-chr-ram.nes").string();
+    {
+        const auto bytes = MapperTestUtils::createMockROMBytes(2, 2, 0);
+        std::ofstream file(romPath, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    Nes::Cartridge first;
+    Nes::Cartridge second;
+    ASSERT_TRUE(first.loadFromFilesystem(romPath).has_value());
+    ASSERT_TRUE(second.loadFromFilesystem(romPath).has_value());
+    std::filesystem::remove(romPath);
+
+    ASSERT_TRUE(first.hasCHRRam());
+
+    first.mappedWriteCHR(0x0010, 0xAB);
+
+    ASSERT_EQ(first.mappedReadCHR(0x0010), 0xAB);
+    ASSERT_EQ(second.mappedReadCHR(0x0010), 0x00);
+    ASSERT_TRUE(first.isSharingImage());
+}
+
+TEST(Core_RomImage, DirectWriteCopiesOnWrite) {
+    Nes::Cartridge first;
+    Nes::Cartridge second;
+    ASSERT_TRUE(first.loadFromFilesystem(CoreTestUtils::testRom).has_value());
+    ASSERT_TRUE(second.loadFromFilesystem(CoreTestUtils::testRom).has_value());
+
+    const auto previousVersion = first.prgMappingVersion();
+    const auto original        = second.directReadPRG(0x0000);
+
+    first.directWritePRG(0x0000, original ^ 0xFF);
+
+    ASSERT_FALSE(first.isSharingImage());
+    ASSERT_NE(first.prgMappingVersion(), previousVersion);
+    ASSERT_EQ(first.mappedPRGPointer(0x0000), first.accessPRG().data());
+    ASSERT_EQ(first.directReadPRG(0x0000), original ^ 0xFF);
+    ASSERT_EQ(second.directReadPRG(0x0000), original);
+}
+
+TEST(Core_RomImage, ReloadAfterRelease) {
+    Nes::RomImageCache cache;
+    ASSERT_TRUE(cache.load(CoreTestUtils::testRom).has_value());
+
+    // The entry of the released image is still there until the next prune
+    const auto image = cache.load(CoreTestUtils::testRom);
+    ASSERT_TRUE(image.has_value());
+    ASSERT_NE(image->get(), nullptr);
+    ASSERT_EQ(cache.size(), 1);
+}
+
+TEST(Core_RomImage, CopiesShareImage) {
+    const auto copyPath = (std::filesystem::temp_directory_path() / "caique-nes-image-copy.nes").string();
+    std::filesystem::copy_file(CoreTestUtils::testRom, copyPath, std::filesystem::copy_options::overwrite_existing);
+
+    Nes::RomImageCache cache;
+    const auto original = cache.load(CoreTestUtils::testRom);
+    const auto copy     = cache.load(copyPath);
+    std::filesystem::remove(copyPath);
+
+    ASSERT_TRUE(original.has_value());
+    ASSERT_TRUE(copy.has_value());
+    ASSERT_EQ(original->get(), copy->get());
+    ASSERT_EQ(cache.size(), 1);
+}
+
+TEST(Core_RomImage, ChangedFileIsReloaded) {
+    const auto romPath = (std::filesystem::temp_directory_path() / "caique-nes-changed.nes").string();
+    const auto writeRom = [&](Nes::Byte firstPRGByte, int prgSize) {
+        auto bytes = MapperTestUtils::createMockROMBytes(0, prgSize, 1);
+        bytes[Nes::Const::headerSize] = firstPRGByte;
+
+        std::ofstream file(romPath, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    };
+
+    Nes::RomImageCache cache;
+
+    writeRom(0x11, 1);
+    const auto first = cache.load(romPath);
+
+    writeRom(0x22, 2);
+    const auto second = cache.load(romPath);
+    std::filesystem::remove(romPath);
+
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    ASSERT_NE(first->get(), second->get());
+    ASSERT_EQ((*second)->bytes()[Nes::Const::headerSize], 0x22);
+    ASSERT_NE((*first)->checksum(), (*second)->checksum());
+}
@@ -0,0 +1,109 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include "Core/Cartridge.hpp"
+#include "Core/RomIndex.hpp"
+#include "../Mappers/Mappers.TestUtils.hpp"
+
+namespace {
+    std::string temporaryIndexPath() {
+        return (std::filesystem::temp_directory_path() / "caique-nes-test.cnix").string();
+    }
+
+    Nes::RomIndexEntry createEntry(std::uint32_t checksum, std::uint16_t mapperId, Nes::Mirroring mirroring,
+                                   std::string_view path)
+    {
+        Nes::RomIndexEntry entry;
+        entry.checksum  = checksum;
+        entry.mapperId  = mapperId;
+        entry.mirroring = mirroring;
+        entry.flags     = Nes::RomIndexFlag::runnable | Nes::RomIndexFlag::corrected;
+        entry.path      = path;
+
+        return entry;
+    }
+}
+
+TEST(Core_RomIndex, WriteAndFind) {
+    const auto indexPath = temporaryIndexPath();
+
+    std::vector<Nes::RomIndexEntry> entries;
+    entries.push_back(createEntry(0x30000000, 3, Nes::Mirroring::Vertical, "c.nes"));
+    entries.push_back(createEntry(0x10000000, 1, Nes::Mirroring::Horizontal, "a.nes"));
+    entries.push_back(createEntry(0x20000000, 2, Nes::Mirroring::FourScreen, "b.nes"));
+    entries.push_back(createEntry(0x10000000, 4, Nes::Mirroring::Vertical, "duplicate.nes"));
+    entries[0].sha1[0] = 0xAB;
+    ASSERT_TRUE(Nes::RomIndex::writeToFilesystem(indexPath, entries).has_value());
+
+    const auto index = Nes::RomIndex::loadFromFilesystem(indexPath);
+    std::filesystem::remove(indexPath);
+    ASSERT_TRUE(index.has_value());
+
+    ASSERT_EQ(index->size(), 3);
+    ASSERT_EQ(index->entryAt(0).path, "a.nes");
+
+    const auto found = index->find(0x30000000);
+    ASSERT_TRUE(found.has_value());
+    ASSERT_EQ(found->mapperId, 3);
+    ASSERT_EQ(found->mirroring, Nes::Mirroring::Vertical);
+    ASSERT_EQ(found->sha1[0], 0xAB);
+    ASSERT_EQ(found->path, "c.nes");
+    ASSERT_TRUE(found->isRunnable());
+
+    ASSERT_EQ(index->find(0x10000000)->mapperId, 1);
+    ASSERT_FALSE(index->find(0x25000000).has_value());
+}
+
+TEST(Core_RomIndex, Failure_NotAnIndex) {
+    const auto indexPath = temporaryIndexPath();
+    {
+        std::ofstream file(indexPath, std::ios::binary);
+        file << "NES\x1A";
+    }
+
+    const auto index = Nes::RomIndex::loadFromFilesystem(indexPath);
+    std::filesystem::remove(indexPath);
+    ASSERT_FALSE(index.has_value());
+}
+
+TEST(Core_RomIndex, CartridgeAppliesCorrections) {
+    // The header claims NROM with horizontal mirroring, the index knows better
+    const auto bytes = MapperTestUtils::createMockROMBytes(0, 2, 1);
+    const auto header = Nes::RomHeader::parse(bytes);
+    ASSERT_TRUE(header.has_value());
+
+    const auto indexPath = temporaryIndexPath();
+    ASSERT_TRUE(Nes::RomIndex::writeToFilesystem(indexPath, {
+        createEntry(header->checksum(bytes), 3, Nes::Mirroring::Vertical, "game.nes")
+    }).has_value());
+
+    auto index = Nes::RomIndex::loadFromFilesystem(indexPath);
+    std::filesystem::remove(indexPath);
+    ASSERT_TRUE(index.has_value());
+
+    Nes::Cartridge cartridge;
+    cartridge.setRomIndex(std::make_shared<const Nes::RomIndex>(std::move(index.value())));
+    ASSERT_TRUE(cartridge.loadRawBytes(bytes).has_value());
+
+    ASSERT_EQ(cartridge.header().mapperId, 3);
+    ASSERT_EQ(cartridge.mirroring(), Nes::Mirroring::Vertical);
+    ASSERT_EQ(cartridge.checksum(), header->checksum(bytes));
+}
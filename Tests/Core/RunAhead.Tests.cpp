@@ -0,0 +1,129 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <vector>
+#include "Core/VirtualMachine.hpp"
+#include "Core.TestUtils.hpp"
+
+static void checkRunAhead(int frames, bool useSecondInstance) {
+    constexpr int frameCount = 30;
+
+    Nes::VirtualMachine reference([](auto) {});
+    ASSERT_TRUE(reference.loadRom(CoreTestUtils::testRom).has_value());
+
+    int framesDrawn = 0;
+    Nes::VirtualMachine vm([&](auto) { framesDrawn++; });
+    ASSERT_TRUE(vm.loadRom(CoreTestUtils::testRom).has_value());
+    ASSERT_TRUE(vm.setRunAhead(frames, useSecondInstance).has_value());
+
+    for (auto i = 0; i < frameCount; i++) {
+        reference.tick();
+        vm.tick();
+    }
+
+    // Running ahead never changes the emulated state, only what gets presented
+    ASSERT_EQ(CoreTestUtils::captureState(vm), CoreTestUtils::captureState(reference));
+    ASSERT_LE(framesDrawn, frameCount);
+
+    for (auto i = 0; i < frames; i++) {
+        reference.tick();
+    }
+
+    ASSERT_TRUE(CoreTestUtils::framesMatch(vm.frameBuffer(), reference.frameBuffer()));
+}
+
+TEST(Core_RunAhead, SameInstance) {
+    checkRunAhead(1, false);
+    checkRunAhead(3, false);
+}
+
+TEST(Core_RunAhead, SecondInstance) {
+    checkRunAhead(1, true);
+    checkRunAhead(3, true);
+}
+
+// Input arrives from the host thread at any point of a tick, also while the lookahead is being rolled back
+static void checkInputSurvivesRollback(bool useSecondInstance) {
+    Nes::VirtualMachine* target = nullptr;
+    bool pressDuringTick = false;
+
+    Nes::VirtualMachine vm([&](auto) {
+        if (pressDuringTick) {
+            target->handleKeyPress(Nes::JoypadButton::A);
+        }
+    });
+    target = &vm;
+
+    ASSERT_TRUE(vm.loadRom(CoreTestUtils::testRom).has_value());
+    ASSERT_TRUE(vm.setRunAhead(1, useSecondInstance).has_value());
+
+    vm.tick();
+    vm.handleKeyPress(Nes::JoypadButton::Start);
+    vm.tick();
+    ASSERT_TRUE(vm.isKeyPressed(Nes::JoypadButton::Start));
+
+    pressDuringTick = true;
+    vm.tick();
+    pressDuringTick = false;
+    ASSERT_TRUE(vm.isKeyPressed(Nes::JoypadButton::A));
+
+    vm.handleKeyRelease(Nes::JoypadButton::Start);
+    vm.tick();
+    ASSERT_FALSE(vm.isKeyPressed(Nes::JoypadButton::Start));
+    ASSERT_TRUE(vm.isKeyPressed(Nes::JoypadButton::A));
+}
+
+TEST(Core_RunAhead, InputSurvivesRollback) {
+    checkInputSurvivesRollback(false);
+    checkInputSurvivesRollback(true);
+}
+
+TEST(Core_RunAhead, SecondInstanceLoadFailureDisables) {
+    const auto romPath = (std::filesystem::temp_directory_path() / "caique-nes-run-ahead.nes").string();
+    std::filesystem::copy_file(CoreTestUtils::testRom, romPath, std::filesystem::copy_options::overwrite_existing);
+
+    int framesDrawn = 0;
+    Nes::VirtualMachine vm([&](auto) { framesDrawn++; });
+    ASSERT_TRUE(vm.loadRom(romPath).has_value());
+
+    // The second instance loads the ROM from the path again, which is gone by now
+    std::filesystem::remove(romPath);
+    ASSERT_FALSE(vm.setRunAhead(1, true).has_value());
+
+    for (auto i = 0; i < 10; i++) {
+        vm.tick();
+    }
+
+    ASSERT_EQ(framesDrawn, 10);
+}
+
+TEST(Core_RunAhead, Disable) {
+    int framesDrawn = 0;
+    Nes::VirtualMachine vm([&](auto) { framesDrawn++; });
+    ASSERT_TRUE(vm.loadRom(CoreTestUtils::testRom).has_value());
+
+    ASSERT_TRUE(vm.setRunAhead(2, true).has_value());
+    ASSERT_TRUE(vm.setRunAhead(0).has_value());
+    for (auto i = 0; i < 10; i++) {
+        vm.tick();
+    }
+
+    ASSERT_GE(framesDrawn, 9);
+}
@@ -0,0 +1,124 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+#include "Core/VirtualMachine.hpp"
+#include "Core.TestUtils.hpp"
+
+static const std::string otherSaveStateRom = std::string(TEST_DIR_BLARGG) + "Instructions/Roms/02-implied.nes";
+
+static void runFrames(Nes::VirtualMachine& vm, int frameCount) {
+    for (auto i = 0; i < frameCount; i++) {
+        vm.tick();
+    }
+}
+
+TEST(Core_SaveState, RestoreIsDeterministic) {
+    constexpr int frameCount = 20;
+
+    Nes::VirtualMachine vm([](auto) {});
+    ASSERT_TRUE(vm.loadRom(CoreTestUtils::testRom).has_value());
+    runFrames(vm, frameCount);
+
+    std::vector<Nes::Byte> snapshot;
+    vm.saveState(snapshot);
+
+    runFrames(vm, frameCount);
+    const auto expectedRAM = std::vector<Nes::Byte>(vm.internalRAM().begin(), vm.internalRAM().end());
+    const Nes::FrameBuffer expectedFrame = vm.frameBuffer();
+
+    ASSERT_TRUE(vm.loadState(snapshot).has_value());
+    runFrames(vm, frameCount);
+
+    ASSERT_TRUE(std::ranges::equal(vm.internalRAM(), expectedRAM));
+    ASSERT_TRUE(CoreTestUtils::framesMatch(vm.frameBuffer(), expectedFrame));
+}
+
+TEST(Core_SaveState, RestoreIntoAnotherInstance) {
+    Nes::VirtualMachine first([](auto) {});
+    Nes::VirtualMachine second([](auto) {});
+    ASSERT_TRUE(first.loadRom(CoreTestUtils::testRom).has_value());
+    ASSERT_TRUE(second.loadRom(CoreTestUtils::testRom).has_value());
+    runFrames(first, 10);
+
+    std::vector<Nes::Byte> snapshot;
+    first.saveState(snapshot);
+    ASSERT_TRUE(second.loadState(snapshot).has_value());
+
+    std::vector<Nes::Byte> secondSnapshot;
+    second.saveState(secondSnapshot);
+    ASSERT_EQ(snapshot, secondSnapshot);
+}
+
+TEST(Core_SaveState, SaveReusesBuffer) {
+    Nes::VirtualMachine vm([](auto) {});
+    ASSERT_TRUE(vm.loadRom(CoreTestUtils::testRom).has_value());
+
+    std::vector<Nes::Byte> snapshot;
+    vm.saveState(snapshot);
+    const auto* data = snapshot.data();
+    const auto size  = snapshot.size();
+
+    runFrames(vm, 1);
+    vm.saveState(snapshot);
+
+    ASSERT_EQ(snapshot.data(), data);
+    ASSERT_EQ(snapshot.size(), size);
+}
+
+TEST(Core_SaveState, Failure_Truncated) {
+    Nes::VirtualMachine vm([](auto) {});
+    ASSERT_TRUE(vm.loadRom(CoreTestUtils::testRom).has_value());
+    runFrames(vm, 5);
+
+    std::vector<Nes::Byte> snapshot;
+    vm.saveState(snapshot);
+
+    snapshot.pop_back();
+    runFrames(vm, 5);
+    const auto ramAfter = std::vector<Nes::Byte>(vm.internalRAM().begin(), vm.internalRAM().end());
+
+    ASSERT_FALSE(vm.loadState(snapshot).has_value());
+    ASSERT_FALSE(vm.loadState({}).has_value());
+    ASSERT_TRUE(std::ranges::equal(vm.internalRAM(), ramAfter));
+}
+
+TEST(Core_SaveState, Failure_BadMagic) {
+    Nes::VirtualMachine vm([](auto) {});
+    ASSERT_TRUE(vm.loadRom(CoreTestUtils::testRom).has_value());
+
+    std::vector<Nes::Byte> snapshot;
+    vm.saveState(snapshot);
+    snapshot[0] ^= 0xFF;
+
+    ASSERT_FALSE(vm.loadState(snapshot).has_value());
+}
+
+TEST(Core_SaveState, Failure_DifferentRom) {
+    Nes::VirtualMachine first([](auto) {});
+    Nes::VirtualMachine second([](auto) {});
+    ASSERT_TRUE(first.loadRom(CoreTestUtils::testRom).has_value());
+    ASSERT_TRUE(second.loadRom(otherSaveStateRom).has_value());
+
+    std::vector<Nes::Byte> snapshot;
+    first.saveState(snapshot);
+
+    ASSERT_FALSE(second.loadState(snapshot).has_value());
+}
@@ -0,0 +1,144 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "Core/Scheduler.hpp"
+#include "Utils/Types.hpp"
+
+TEST(Core_Scheduler, NothingDueInitially) {
+    Nes::Scheduler scheduler;
+
+    ASSERT_EQ(scheduler.now(), 0);
+    ASSERT_EQ(scheduler.batchEnd(), Nes::Const::Scheduler::never);
+    ASSERT_FALSE(scheduler.popDueEvent().has_value());
+}
+
+TEST(Core_Scheduler, EventBecomesDueAtItsTimestamp) {
+    Nes::Scheduler scheduler;
+    scheduler.schedule(Nes::EventType::PpuCatchUp, 10);
+
+    scheduler.advance(9);
+    ASSERT_FALSE(scheduler.isDue(Nes::EventType::PpuCatchUp));
+    ASSERT_FALSE(scheduler.popDueEvent().has_value());
+
+    scheduler.advance(1);
+    ASSERT_TRUE(scheduler.isDue(Nes::EventType::PpuCatchUp));
+    ASSERT_EQ(scheduler.popDueEvent(), Nes::EventType::PpuCatchUp);
+    ASSERT_FALSE(scheduler.popDueEvent().has_value());
+}
+
+TEST(Core_Scheduler, DueEventsPopInTimestampOrder) {
+    Nes::Scheduler scheduler;
+    scheduler.schedule(Nes::EventType::PpuCatchUp, 7);
+    scheduler.schedule(Nes::EventType::Nmi, 3);
+    scheduler.advance(10);
+
+    std::vector<Nes::EventType> popped;
+    while (const auto event = scheduler.popDueEvent()) {
+        popped.push_back(*event);
+    }
+
+    ASSERT_EQ(popped, (std::vector{Nes::EventType::Nmi, Nes::EventType::PpuCatchUp}));
+}
+
+TEST(Core_Scheduler, SimultaneousEventsPopInPriorityOrder) {
+    Nes::Scheduler scheduler;
+    scheduler.schedule(Nes::EventType::Nmi, 5);
+    scheduler.schedule(Nes::EventType::PpuCatchUp, 5);
+    scheduler.advance(5);
+
+    ASSERT_EQ(scheduler.popDueEvent(), Nes::EventType::PpuCatchUp);
+    ASSERT_EQ(scheduler.popDueEvent(), Nes::EventType::Nmi);
+}
+
+TEST(Core_Scheduler, CancelledEventNeverFires) {
+    Nes::Scheduler scheduler;
+    scheduler.schedule(Nes::EventType::Nmi, 5);
+    scheduler.cancel(Nes::EventType::Nmi);
+    scheduler.advance(100);
+
+    ASSERT_FALSE(scheduler.popDueEvent().has_value());
+    ASSERT_EQ(scheduler.batchEnd(), Nes::Const::Scheduler::never);
+}
+
+TEST(Core_Scheduler, BatchEndsAtEarliestOfEventAndRunLimit) {
+    Nes::Scheduler scheduler;
+    scheduler.schedule(Nes::EventType::PpuCatchUp, 50);
+
+    scheduler.setRunLimit(20);
+    ASSERT_EQ(scheduler.batchEnd(), 20);
+
+    scheduler.setRunLimit(80);
+    ASSERT_EQ(scheduler.batchEnd(), 50);
+
+    scheduler.schedule(Nes::EventType::Nmi, 30);
+    ASSERT_EQ(scheduler.batchEnd(), 30);
+}
+
+TEST(Core_Scheduler, SaveStateRoundTrip) {
+    Nes::Scheduler scheduler;
+    scheduler.schedule(Nes::EventType::PpuCatchUp, 1234);
+    scheduler.advance(1000);
+
+    std::vector<Nes::Byte> snapshot;
+    Utils::StateWriter writer(snapshot);
+    scheduler.saveState(writer);
+
+    Nes::Scheduler restored;
+    Utils::StateReader reader(snapshot);
+    restored.loadState(reader);
+
+    ASSERT_FALSE(reader.failed());
+    ASSERT_EQ(restored.now(), 1000);
+    ASSERT_EQ(restored.batchEnd(), 1234);
+}
+
+TEST(Core_Scheduler, DispatchRunsHandlersOfDueEvents) {
+    Nes::Scheduler scheduler;
+    std::vector<Nes::EventType> dispatched;
+
+    scheduler.setHandler(Nes::EventType::PpuCatchUp, [&] { dispatched.push_back(Nes::EventType::PpuCatchUp); });
+    scheduler.setHandler(Nes::EventType::ApuFrameCounter, [&] {
+        dispatched.push_back(Nes::EventType::ApuFrameCounter);
+        scheduler.schedule(Nes::EventType::ApuFrameCounter, scheduler.now() + 100);
+    });
+
+    scheduler.schedule(Nes::EventType::PpuCatchUp, 20);
+    scheduler.schedule(Nes::EventType::ApuFrameCounter, 10);
+    scheduler.advance(50);
+    scheduler.dispatchDueEvents();
+
+    ASSERT_EQ(dispatched, (std::vector{Nes::EventType::ApuFrameCounter, Nes::EventType::PpuCatchUp}));
+    ASSERT_EQ(scheduler.batchEnd(), 150);
+}
+
+TEST(Core_Scheduler, IrqStaysAssertedUntilEverySourceAcknowledges) {
+    Nes::Scheduler scheduler;
+
+    scheduler.raiseIrq(Nes::IrqSource::FrameCounter);
+    scheduler.raiseIrq(Nes::IrqSource::Dmc);
+    ASSERT_TRUE(scheduler.isDue(Nes::EventType::Irq));
+
+    scheduler.acknowledgeIrq(Nes::IrqSource::FrameCounter);
+    ASSERT_TRUE(scheduler.isIrqAsserted());
+    ASSERT_FALSE(scheduler.isIrqAsserted(Nes::IrqSource::FrameCounter));
+
+    scheduler.acknowledgeIrq(Nes::IrqSource::Dmc);
+    ASSERT_FALSE(scheduler.isIrqAsserted());
+}
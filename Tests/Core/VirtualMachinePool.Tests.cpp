@@ -0,0 +1,63 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include "Core/VirtualMachinePool.hpp"
+#include "Core.TestUtils.hpp"
+
+TEST(Core_VirtualMachinePool, MatchesSequentialExecution) {
+    constexpr int frameCount = 30;
+
+    Nes::VirtualMachine reference([](auto) {});
+    ASSERT_TRUE(reference.loadRom(CoreTestUtils::testRom).has_value());
+    for (auto i = 0; i < frameCount; i++) {
+        reference.tick();
+    }
+
+    Nes::VirtualMachinePool pool(6, 3);
+    ASSERT_TRUE(pool.loadRom(CoreTestUtils::testRom).has_value());
+
+    pool.runFrames(frameCount / 2);
+    pool.runFrames(frameCount / 2);
+
+    const auto expectedRAM = reference.internalRAM();
+    for (std::size_t i = 0; i < pool.size(); i++) {
+        const auto ram = pool.internalRAM(i);
+
+        ASSERT_EQ(ram.size(), expectedRAM.size());
+        ASSERT_TRUE(std::equal(ram.begin(), ram.end(), expectedRAM.begin()));
+        ASSERT_TRUE(CoreTestUtils::framesMatch(pool.frameBuffer(i), reference.frameBuffer()));
+    }
+}
+
+TEST(Core_VirtualMachinePool, ViewsAreNotCopies) {
+    Nes::VirtualMachinePool pool(2, 1);
+    ASSERT_TRUE(pool.loadRom(CoreTestUtils::testRom).has_value());
+
+    const auto ramBefore = pool.internalRAM(1);
+    pool.runFrames(1);
+
+    ASSERT_EQ(ramBefore.data(), pool.internalRAM(1).data());
+    ASSERT_EQ(&pool.frameBuffer(1), &pool.accessInstance(1).frameBuffer());
+}
+
+TEST(Core_VirtualMachinePool, LoadRom_Failure) {
+    Nes::VirtualMachinePool pool(2, 1);
+    ASSERT_FALSE(pool.loadRom("invalid/path.nes").has_value());
+}
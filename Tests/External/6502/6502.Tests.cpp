@@ -58,12 +58,13 @@ std::pair<bool, std::string> testOpcodes(const std::vector<Nes::Byte>& opcodes)
 
             Nes::Cartridge mockCartridge;
             Nes::MMU mmu(mockCartridge);
-            Nes::PPU ppu(mmu, [](auto){});
+            Nes::Scheduler scheduler;
+            Nes::PPU ppu(mmu, scheduler, [](auto){});
 
             mmu.clearMemoryRegions();
             mmu.addMemoryRegion(Utils::Range<Nes::Addr>{0x0000, 0xFFFF});
 
-            Nes::CPU cpu(mmu, ppu);
+            Nes::CPU cpu(mmu, ppu, scheduler);
 
             mmu.loadState(test.initial);
             cpu.loadState(test.initial);
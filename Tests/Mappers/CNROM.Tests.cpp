@@ -0,0 +1,51 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include "Mappers/CNROM.hpp"
+#include "Mappers.TestUtils.hpp"
+
+TEST(Nes_Mapper_CNROM, Creation) {
+    Nes::Cartridge cartridge;
+    const auto result = cartridge.loadRawBytes(MapperTestUtils::createMockROMBytes(3, 2, 4));
+
+    ASSERT_TRUE(result.has_value());
+}
+
+TEST(Nes_Mapper_CNROM, Creation_BadPRGSize) {
+    Nes::Cartridge cartridge;
+    const auto result = cartridge.loadRawBytes(MapperTestUtils::createMockROMBytes(3, 4, 4));
+
+    ASSERT_FALSE(result.has_value());
+    ASSERT_EQ(result.error(), "Unable to parse ROM: Sanity check failed for mapper with ID 3");
+}
+
+TEST(Nes_Mapper_CNROM, SwitchCHR) {
+    Nes::Cartridge cartridge;
+    auto bytes = MapperTestUtils::createMockROMBytes(3, 1, 4);
+    MapperTestUtils::markBanks(bytes, Nes::Const::CNROM::prgBankSize, Nes::Const::CNROM::chrBankSize);
+    ASSERT_TRUE(cartridge.loadRawBytes(bytes).has_value());
+
+    ASSERT_EQ(cartridge.mappedReadCHR(0x0000), 0);
+
+    cartridge.mappedWritePRG(0x0000, 2);
+
+    ASSERT_EQ(cartridge.mappedReadCHR(0x0000), 2);
+    ASSERT_EQ(cartridge.mappedReadPRG(0x4000), 0);
+}
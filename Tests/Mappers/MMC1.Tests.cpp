@@ -0,0 +1,103 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include "Mappers/MMC1.hpp"
+#include "Mappers.TestUtils.hpp"
+
+namespace {
+    void writeSerially(Nes::Cartridge& cartridge, Nes::Addr addr, Nes::Byte value) {
+        for (auto bit = 0; bit < Nes::Const::MMC1::shiftRegisterWidth; bit++) {
+            cartridge.mappedWritePRG(addr, (value >> bit) & 1);
+        }
+    }
+}
+
+TEST(Nes_Mapper_MMC1, Creation) {
+    Nes::Cartridge cartridge;
+    const auto result = cartridge.loadRawBytes(MapperTestUtils::createMockROMBytes(1, 8, 2));
+
+    ASSERT_TRUE(result.has_value());
+}
+
+TEST(Nes_Mapper_MMC1, PRG_PowerOnFixesLastBank) {
+    Nes::Cartridge cartridge;
+    auto bytes = MapperTestUtils::createMockROMBytes(1, 8, 2);
+    MapperTestUtils::markBanks(bytes, Nes::Const::MMC1::prgBankSize, Nes::Const::MMC1::chrBankSize);
+    ASSERT_TRUE(cartridge.loadRawBytes(bytes).has_value());
+
+    ASSERT_EQ(cartridge.mappedReadPRG(0x0000), 0);
+    ASSERT_EQ(cartridge.mappedReadPRG(0x4000), 7);
+
+    writeSerially(cartridge, 0x6000, 3);
+
+    ASSERT_EQ(cartridge.mappedReadPRG(0x0000), 3);
+    ASSERT_EQ(cartridge.mappedReadPRG(0x4000), 7);
+}
+
+TEST(Nes_Mapper_MMC1, PRG_32KBMode) {
+    Nes::Cartridge cartridge;
+    auto bytes = MapperTestUtils::createMockROMBytes(1, 8, 2);
+    MapperTestUtils::markBanks(bytes, Nes::Const::MMC1::prgBankSize, Nes::Const::MMC1::chrBankSize);
+    ASSERT_TRUE(cartridge.loadRawBytes(bytes).has_value());
+
+    writeSerially(cartridge, 0x0000, 0b00000);
+    writeSerially(cartridge, 0x6000, 5);
+
+    ASSERT_EQ(cartridge.mappedReadPRG(0x0000), 4);
+    ASSERT_EQ(cartridge.mappedReadPRG(0x4000), 5);
+}
+
+TEST(Nes_Mapper_MMC1, CHR_4KBMode) {
+    Nes::Cartridge cartridge;
+    auto bytes = MapperTestUtils::createMockROMBytes(1, 2, 2);
+    MapperTestUtils::markBanks(bytes, Nes::Const::MMC1::prgBankSize, Nes::Const::MMC1::chrBankSize);
+    ASSERT_TRUE(cartridge.loadRawBytes(bytes).has_value());
+
+    writeSerially(cartridge, 0x0000, 0b11100);
+    writeSerially(cartridge, 0x2000, 3);
+    writeSerially(cartridge, 0x4000, 1);
+
+    ASSERT_EQ(cartridge.mappedReadCHR(0x0000), 3);
+    ASSERT_EQ(cartridge.mappedReadCHR(0x1000), 1);
+}
+
+TEST(Nes_Mapper_MMC1, Mirroring) {
+    Nes::Cartridge cartridge;
+    ASSERT_TRUE(cartridge.loadRawBytes(MapperTestUtils::createMockROMBytes(1, 2, 2)).has_value());
+
+    writeSerially(cartridge, 0x0000, 0b01101);
+    ASSERT_EQ(cartridge.mirroring(), Nes::Mirroring::SingleScreenUpper);
+
+    writeSerially(cartridge, 0x0000, 0b01110);
+    ASSERT_EQ(cartridge.mirroring(), Nes::Mirroring::Vertical);
+}
+
+TEST(Nes_Mapper_MMC1, ResetClearsShiftRegister) {
+    Nes::Cartridge cartridge;
+    auto bytes = MapperTestUtils::createMockROMBytes(1, 8, 2);
+    MapperTestUtils::markBanks(bytes, Nes::Const::MMC1::prgBankSize, Nes::Const::MMC1::chrBankSize);
+    ASSERT_TRUE(cartridge.loadRawBytes(bytes).has_value());
+
+    cartridge.mappedWritePRG(0x6000, 1);
+    cartridge.mappedWritePRG(0x6000, Nes::Const::MMC1::resetBit);
+    writeSerially(cartridge, 0x6000, 2);
+
+    ASSERT_EQ(cartridge.mappedReadPRG(0x0000), 2);
+}
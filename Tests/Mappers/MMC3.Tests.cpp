@@ -0,0 +1,91 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include "Mappers/MMC3.hpp"
+#include "Mappers.TestUtils.hpp"
+
+TEST(Nes_Mapper_MMC3, Creation) {
+    Nes::Cartridge cartridge;
+    const auto result = cartridge.loadRawBytes(MapperTestUtils::createMockROMBytes(4, 8, 8));
+
+    ASSERT_TRUE(result.has_value());
+}
+
+TEST(Nes_Mapper_MMC3, SwitchPRG) {
+    Nes::Cartridge cartridge;
+    auto bytes = MapperTestUtils::createMockROMBytes(4, 8, 8);
+    MapperTestUtils::markBanks(bytes, Nes::Const::MMC3::prgBankSize, Nes::Const::MMC3::chrSmallBankSize);
+    ASSERT_TRUE(cartridge.loadRawBytes(bytes).has_value());
+
+    cartridge.mappedWritePRG(0x0000, 6);
+    cartridge.mappedWritePRG(0x0001, 3);
+    cartridge.mappedWritePRG(0x0000, 7);
+    cartridge.mappedWritePRG(0x0001, 4);
+
+    ASSERT_EQ(cartridge.mappedReadPRG(0x0000), 3);
+    ASSERT_EQ(cartridge.mappedReadPRG(0x2000), 4);
+    ASSERT_EQ(cartridge.mappedReadPRG(0x4000), 14);
+    ASSERT_EQ(cartridge.mappedReadPRG(0x6000), 15);
+
+    cartridge.mappedWritePRG(0x0000, 0x40);
+
+    ASSERT_EQ(cartridge.mappedReadPRG(0x0000), 14);
+    ASSERT_EQ(cartridge.mappedReadPRG(0x4000), 3);
+}
+
+TEST(Nes_Mapper_MMC3, SwitchCHR_Inverted) {
+    Nes::Cartridge cartridge;
+    auto bytes = MapperTestUtils::createMockROMBytes(4, 8, 8);
+    MapperTestUtils::markBanks(bytes, Nes::Const::MMC3::prgBankSize, Nes::Const::MMC3::chrSmallBankSize);
+    ASSERT_TRUE(cartridge.loadRawBytes(bytes).has_value());
+
+    cartridge.mappedWritePRG(0x0000, 0x80);
+    cartridge.mappedWritePRG(0x0001, 10);
+    cartridge.mappedWritePRG(0x0000, 0x82);
+    cartridge.mappedWritePRG(0x0001, 33);
+
+    ASSERT_EQ(cartridge.mappedReadCHR(0x1000), 10);
+    ASSERT_EQ(cartridge.mappedReadCHR(0x1400), 11);
+    ASSERT_EQ(cartridge.mappedReadCHR(0x0000), 33);
+}
+
+TEST(Nes_Mapper_MMC3, ScanlineIrq) {
+    Nes::Cartridge cartridge;
+    Nes::Scheduler scheduler;
+    ASSERT_TRUE(cartridge.loadRawBytes(MapperTestUtils::createMockROMBytes(4, 8, 8)).has_value());
+    cartridge.connectPPU(scheduler, {});
+
+    cartridge.mappedWritePRG(0x4000, 3);
+    cartridge.mappedWritePRG(0x4001, 0);
+    cartridge.mappedWritePRG(0x6001, 0);
+    ASSERT_EQ(cartridge.a12RisesUntilIrq(), 4);
+
+    for (auto i = 0; i < 3; i++) {
+        cartridge.handleA12Rise();
+        ASSERT_FALSE(scheduler.isIrqAsserted(Nes::IrqSource::Mapper));
+    }
+
+    cartridge.handleA12Rise();
+    ASSERT_TRUE(scheduler.isIrqAsserted(Nes::IrqSource::Mapper));
+
+    cartridge.mappedWritePRG(0x6000, 0);
+    ASSERT_FALSE(scheduler.isIrqAsserted(Nes::IrqSource::Mapper));
+    ASSERT_FALSE(cartridge.a12RisesUntilIrq().has_value());
+}
@@ -19,32 +19,48 @@
 #ifndef CAIQUE_NES_MAPPERS_TESTUTILS_HPP
 #define CAIQUE_NES_MAPPERS_TESTUTILS_HPP
 
+#include <cassert>
 #include "Core/Cartridge.hpp"
 
 namespace MapperTestUtils {
-    std::vector<Nes::Byte> createMockROMBytes(Nes::Byte mapperId, int prgSize, int chrSize) {
+    // Sizes are given in header units, 16 KB for PRG and 8 KB for CHR
+    inline std::vector<Nes::Byte> createMockROMBytes(Nes::Byte mapperId, int prgSize, int chrSize) {
         // To make sure sizes are not confused with kilobytes
         assert(prgSize < 10 && chrSize < 10);
 
         std::vector<Nes::Byte> bytes;
 
-        const auto prgSizeInBytes = Utils::kilobytesToBytes(prgSize);
-        const auto chrSizeInBytes = Utils::kilobytesToBytes(chrSize);
+        const auto prgSizeInBytes = Utils::kilobytesToBytes(prgSize * Nes::Const::prgSizeMultiplier);
+        const auto chrSizeInBytes = Utils::kilobytesToBytes(chrSize * Nes::Const::chrSizeMultiplier);
 
         bytes.resize(prgSizeInBytes + chrSizeInBytes + Nes::Const::headerSize, 0x00);
 
-        if (mapperId != 0) {
-            throw std::logic_error("Unimplemented test utils for other mappers");
-        }
-
         bytes[0x0] = 'N';
         bytes[0x1] = 'E';
         bytes[0x2] = 'S';
         bytes[0x4] = prgSize;
         bytes[0x5] = chrSize;
+        bytes[0x6] = (mapperId & 0x0F) << 4;
+        bytes[0x7] = mapperId & 0xF0;
 
         return bytes;
     }
+
+    // Marks the first byte of every PRG and CHR ROM bank of the given size with the bank's number
+    inline void markBanks(std::vector<Nes::Byte>& bytes, std::size_t prgBankSize, std::size_t chrBankSize) {
+        const auto prgSizeInBytes = Utils::kilobytesToBytes(bytes[0x4] * Nes::Const::prgSizeMultiplier);
+        const auto chrSizeInBytes = Utils::kilobytesToBytes(bytes[0x5] * Nes::Const::chrSizeMultiplier);
+
+        const auto prg = std::span(bytes).subspan(Nes::Const::headerSize, prgSizeInBytes);
+        for (std::size_t offset = 0; offset < prg.size(); offset += prgBankSize) {
+            prg[offset] = offset / prgBankSize;
+        }
+
+        const auto chr = std::span(bytes).subspan(Nes::Const::headerSize + prgSizeInBytes, chrSizeInBytes);
+        for (std::size_t offset = 0; offset < chr.size(); offset += chrBankSize) {
+            chr[offset] = offset / chrBankSize;
+        }
+    }
 }
 
 #endif //CAIQUE_NES_MAPPERS_TESTUTILS_HPP
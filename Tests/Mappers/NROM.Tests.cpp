@@ -77,4 +77,24 @@ TEST(Nes_Mapper_NROM, ReadWrite_CHR) {
     ASSERT_EQ(cartridge.mappedReadCHR(0x1FFF), 0xAB);
 }
 
+TEST(Nes_Mapper_NROM, BankPointers_SingleBankMirrored) {
+    Nes::Cartridge cartridge;
+    const auto result = cartridge.loadRawBytes(MapperTestUtils::createMockROMBytes(0, 1, 1));
+
+    ASSERT_TRUE(result.has_value());
 
+    ASSERT_EQ(cartridge.mappedPRGPointer(0x0000), cartridge.accessPRG().data());
+    ASSERT_EQ(cartridge.mappedPRGPointer(0x4000), cartridge.accessPRG().data());
+    ASSERT_EQ(cartridge.mappedPRGPointer(0x7FFF), cartridge.accessPRG().data() + 0x3FFF);
+}
+
+TEST(Nes_Mapper_NROM, Write_CHR_ROMIsReadOnly) {
+    Nes::Cartridge cartridge;
+    const auto result = cartridge.loadRawBytes(MapperTestUtils::createMockROMBytes(0, 2, 1));
+
+    ASSERT_TRUE(result.has_value());
+
+    cartridge.mappedWriteCHR(0x0010, 0xAB);
+
+    ASSERT_EQ(cartridge.mappedReadCHR(0x0010), 0x00);
+}
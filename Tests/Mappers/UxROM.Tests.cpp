@@ -0,0 +1,62 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include "Mappers/UxROM.hpp"
+#include "Mappers.TestUtils.hpp"
+
+TEST(Nes_Mapper_UxROM, Creation) {
+    Nes::Cartridge cartridge;
+    const auto result = cartridge.loadRawBytes(MapperTestUtils::createMockROMBytes(2, 8, 0));
+
+    ASSERT_TRUE(result.has_value());
+    ASSERT_TRUE(cartridge.hasCHRRam());
+}
+
+TEST(Nes_Mapper_UxROM, Creation_BadCHRSize) {
+    Nes::Cartridge cartridge;
+    const auto result = cartridge.loadRawBytes(MapperTestUtils::createMockROMBytes(2, 8, 2));
+
+    ASSERT_FALSE(result.has_value());
+    ASSERT_EQ(result.error(), "Unable to parse ROM: Sanity check failed for mapper with ID 2");
+}
+
+TEST(Nes_Mapper_UxROM, SwitchPRG) {
+    Nes::Cartridge cartridge;
+    auto bytes = MapperTestUtils::createMockROMBytes(2, 8, 0);
+    MapperTestUtils::markBanks(bytes, Nes::Const::UxROM::bankSize, Nes::Const::chrRamSize);
+    ASSERT_TRUE(cartridge.loadRawBytes(bytes).has_value());
+
+    ASSERT_EQ(cartridge.mappedReadPRG(0x0000), 0);
+    ASSERT_EQ(cartridge.mappedReadPRG(0x4000), 7);
+
+    cartridge.mappedWritePRG(0x1234, 5);
+
+    ASSERT_EQ(cartridge.mappedReadPRG(0x0000), 5);
+    ASSERT_EQ(cartridge.mappedReadPRG(0x4000), 7);
+}
+
+TEST(Nes_Mapper_UxROM, ReadWrite_CHRRam) {
+    Nes::Cartridge cartridge;
+    ASSERT_TRUE(cartridge.loadRawBytes(MapperTestUtils::createMockROMBytes(2, 2, 0)).has_value());
+
+    cartridge.mappedWriteCHR(0x1FFF, 0xAB);
+
+    ASSERT_EQ(cartridge.mappedReadCHR(0x1FFF), 0xAB);
+}
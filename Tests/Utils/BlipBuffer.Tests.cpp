@@ -0,0 +1,90 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+#include "Utils/BlipBuffer.hpp"
+
+static constexpr double testClockRate = 1789773.0;
+static constexpr int testSampleRate   = 48000;
+
+static std::vector<Utils::AudioSample> readAll(Utils::BlipBuffer& buffer) {
+    std::vector<Utils::AudioSample> samples(buffer.samplesAvailable());
+    samples.resize(buffer.readSamples(samples));
+
+    return samples;
+}
+
+TEST(Utils_BlipBuffer, ResamplesFrameLength) {
+    Utils::BlipBuffer buffer(testClockRate, testSampleRate, 4096);
+
+    buffer.endFrame(29829);
+    ASSERT_EQ(buffer.samplesAvailable(), 799);
+
+    // The fraction carries over into the next frame
+    ASSERT_EQ(readAll(buffer).size(), 799);
+    buffer.endFrame(29829);
+    ASSERT_EQ(buffer.samplesAvailable(), 800);
+}
+
+TEST(Utils_BlipBuffer, SilentWithoutDeltas) {
+    Utils::BlipBuffer buffer(testClockRate, testSampleRate, 4096);
+    buffer.endFrame(29830);
+
+    const auto samples = readAll(buffer);
+    ASSERT_TRUE(std::all_of(samples.begin(), samples.end(), [](auto sample) { return sample == 0; }));
+}
+
+TEST(Utils_BlipBuffer, StepSettlesOnDelta) {
+    Utils::BlipBuffer buffer(testClockRate, testSampleRate, 4096);
+
+    buffer.addDelta(100, 10000);
+    buffer.endFrame(2000);
+    const auto samples = readAll(buffer);
+
+    // Past the kernel the level sits right at the delta, only decaying slowly through the high-pass. The ringing of a
+    // band-limited step overshoots by about a tenth.
+    const auto peak = *std::max_element(samples.begin(), samples.end());
+    ASSERT_GT(samples[Utils::Const::Blip::kernelWidth + 2], 9700);
+    ASSERT_LE(peak, 11500);
+}
+
+TEST(Utils_BlipBuffer, HighPassReturnsToZero) {
+    Utils::BlipBuffer buffer(testClockRate, testSampleRate, 65536);
+
+    buffer.addDelta(0, 10000);
+    buffer.endFrame(static_cast<std::uint64_t>(testClockRate));
+    const auto samples = readAll(buffer);
+
+    ASSERT_LT(std::abs(samples.back()), 10);
+}
+
+TEST(Utils_BlipBuffer, Clear) {
+    Utils::BlipBuffer buffer(testClockRate, testSampleRate, 4096);
+
+    buffer.addDelta(10, 10000);
+    buffer.endFrame(1000);
+    buffer.clear();
+
+    ASSERT_EQ(buffer.samplesAvailable(), 0);
+    buffer.endFrame(1000);
+
+    const auto samples = readAll(buffer);
+    ASSERT_TRUE(std::all_of(samples.begin(), samples.end(), [](auto sample) { return sample == 0; }));
+}
@@ -0,0 +1,91 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include <string>
+#include "Utils/Checksum.hpp"
+
+static const std::string checkInput = "123456789";
+
+static const std::uint8_t* asBytes(const std::string& value) {
+    return reinterpret_cast<const std::uint8_t*>(value.data());
+}
+
+TEST(Utils_Checksum, crc32) {
+    ASSERT_EQ(Utils::crc32(asBytes(checkInput), checkInput.size()), 0xCBF43926);
+    ASSERT_EQ(Utils::crc32(nullptr, 0), 0x00000000);
+}
+
+TEST(Utils_Checksum, crc32_Running) {
+    const auto firstHalf = Utils::crc32(asBytes(checkInput), 4);
+    ASSERT_EQ(Utils::crc32(asBytes(checkInput) + 4, checkInput.size() - 4, firstHalf), 0xCBF43926);
+}
+
+TEST(Utils_Checksum, adler32) {
+    const std::string wikipedia = "Wikipedia";
+    ASSERT_EQ(Utils::adler32(asBytes(wikipedia), wikipedia.size()), 0x11E60398);
+}
+
+TEST(Utils_Checksum, fnv1a64) {
+    const std::string singleCharacter = "a";
+    ASSERT_EQ(Utils::fnv1a64(nullptr, 0), 0xCBF29CE484222325);
+    ASSERT_EQ(Utils::fnv1a64(asBytes(singleCharacter), singleCharacter.size()), 0xAF63DC4C8601EC8C);
+}
+
+TEST(Utils_Checksum, crc32_Long) {
+    // Long enough to go through the eight byte steps, with a tail left over
+    std::string input;
+    for (auto i = 0; i < 100; i++) {
+        input += checkInput;
+    }
+
+    auto expected = ~0u;
+    for (const auto character : input) {
+        expected ^= static_cast<std::uint8_t>(character);
+        for (auto bit = 0; bit < 8; bit++) {
+            expected = (expected & 1) ? (expected >> 1) ^ 0xEDB88320 : expected >> 1;
+        }
+    }
+
+    ASSERT_EQ(Utils::crc32(asBytes(input), input.size()), ~expected);
+}
+
+TEST(Utils_Checksum, sha1) {
+    const auto toHex = [](const Utils::Sha1Digest& digest) {
+        std::string hex;
+        for (const auto byte : digest) {
+            constexpr const char* digits = "0123456789abcdef";
+            hex += digits[byte >> 4];
+            hex += digits[byte & 0x0F];
+        }
+
+        return hex;
+    };
+
+    const std::string abc       = "abc";
+    const std::string twoBlocks = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+
+    ASSERT_EQ(toHex(Utils::sha1(nullptr, 0)), "da39a3ee5e6b4b0d3255bfef95601890afd80709");
+    ASSERT_EQ(toHex(Utils::sha1(asBytes(abc), abc.size())), "a9993e364706816aba3e25717850c26c9cd0d89d");
+    ASSERT_EQ(toHex(Utils::sha1(asBytes(twoBlocks), twoBlocks.size())), "84983e441c3bd26ebaae4aa1f95129e5e54670f1");
+
+    Utils::Sha1 pieces;
+    pieces.update(asBytes(twoBlocks), 5);
+    pieces.update(asBytes(twoBlocks) + 5, twoBlocks.size() - 5);
+    ASSERT_EQ(toHex(pieces.digest()), "84983e441c3bd26ebaae4aa1f95129e5e54670f1");
+}
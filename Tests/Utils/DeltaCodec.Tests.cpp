@@ -0,0 +1,103 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "Utils/DeltaCodec.hpp"
+
+static std::vector<std::uint8_t> createBase(std::size_t size) {
+    std::vector<std::uint8_t> base(size);
+    for (std::size_t i = 0; i < size; i++) {
+        base[i] = static_cast<std::uint8_t>(i * 31 + 7);
+    }
+
+    return base;
+}
+
+TEST(Utils_DeltaCodec, RoundTrip) {
+    const auto base = createBase(1000);
+    auto target = base;
+    target[0]   = 0x00;
+    target[1]  ^= 0xFF;
+    target[500] = 0x42;
+    target[999] ^= 0x01;
+
+    std::vector<std::uint8_t> delta;
+    Utils::encodeDelta(base, target, delta);
+
+    std::vector<std::uint8_t> decoded(base.size());
+    ASSERT_TRUE(Utils::decodeDelta(base, delta, decoded));
+    ASSERT_EQ(decoded, target);
+}
+
+TEST(Utils_DeltaCodec, IdenticalInputIsTiny) {
+    const auto base = createBase(10000);
+
+    std::vector<std::uint8_t> delta;
+    Utils::encodeDelta(base, base, delta);
+    ASSERT_LE(delta.size(), 4);
+
+    std::vector<std::uint8_t> decoded(base.size());
+    ASSERT_TRUE(Utils::decodeDelta(base, delta, decoded));
+    ASSERT_EQ(decoded, base);
+}
+
+TEST(Utils_DeltaCodec, FullyDifferentInput) {
+    const auto base = createBase(300);
+    auto target = base;
+    for (auto& value : target) {
+        value = ~value;
+    }
+
+    std::vector<std::uint8_t> delta;
+    Utils::encodeDelta(base, target, delta);
+
+    std::vector<std::uint8_t> decoded(base.size());
+    ASSERT_TRUE(Utils::decodeDelta(base, delta, decoded));
+    ASSERT_EQ(decoded, target);
+}
+
+TEST(Utils_DeltaCodec, ReusesOutputCapacity) {
+    const auto base = createBase(256);
+    auto target = base;
+    target[10] ^= 0x10;
+
+    std::vector<std::uint8_t> delta;
+    delta.reserve(64);
+    const auto* data = delta.data();
+    Utils::encodeDelta(base, target, delta);
+
+    ASSERT_EQ(delta.data(), data);
+}
+
+TEST(Utils_DeltaCodec, Failure_Malformed) {
+    const auto base = createBase(16);
+    std::vector<std::uint8_t> decoded(base.size());
+
+    const std::vector<std::uint8_t> overrun = {0x20, 0x00};
+    ASSERT_FALSE(Utils::decodeDelta(base, overrun, decoded));
+
+    const std::vector<std::uint8_t> missingLiterals = {0x00, 0x04, 0x01};
+    ASSERT_FALSE(Utils::decodeDelta(base, missingLiterals, decoded));
+
+    const std::vector<std::uint8_t> unterminatedVarint = {0x80};
+    ASSERT_FALSE(Utils::decodeDelta(base, unterminatedVarint, decoded));
+
+    std::vector<std::uint8_t> wrongSize(base.size() + 1);
+    ASSERT_FALSE(Utils::decodeDelta(base, {}, wrongSize));
+}
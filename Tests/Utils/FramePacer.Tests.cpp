@@ -0,0 +1,100 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include <numeric>
+#include <thread>
+#include "Utils/FramePacer.hpp"
+
+using namespace std::chrono_literals;
+
+static std::chrono::nanoseconds timeFrames(Utils::FramePacer& pacer, int frameCount) {
+    const auto start = Utils::FramePacer::Clock::now();
+    for (auto i = 0; i < frameCount; i++) {
+        pacer.waitForNextFrame();
+    }
+
+    return Utils::FramePacer::Clock::now() - start;
+}
+
+TEST(Utils_FramePacer, PacesToFrameRate) {
+    Utils::FramePacer pacer(100.0);
+
+    // The first frame only sets the starting deadline
+    const auto elapsed = timeFrames(pacer, 11);
+
+    ASSERT_GE(elapsed, 99ms);
+    ASSERT_LT(elapsed, 250ms);
+}
+
+TEST(Utils_FramePacer, SpeedMultiplier) {
+    Utils::FramePacer pacer(50.0);
+    pacer.setSpeedMultiplier(2.0);
+
+    const auto elapsed = timeFrames(pacer, 11);
+
+    ASSERT_GE(elapsed, 99ms);
+    ASSERT_LT(elapsed, 250ms);
+}
+
+TEST(Utils_FramePacer, Unthrottled) {
+    Utils::FramePacer pacer(1.0);
+    pacer.setSpeedMultiplier(0.0);
+
+    ASSERT_LT(timeFrames(pacer, 100), 50ms);
+}
+
+TEST(Utils_FramePacer, Statistics) {
+    Utils::FramePacer pacer(200.0);
+    timeFrames(pacer, 21);
+
+    const auto statistics = pacer.statistics();
+    ASSERT_EQ(statistics.frameCount, 20);
+    ASSERT_EQ(std::accumulate(statistics.histogram.begin(), statistics.histogram.end(), std::uint64_t{0}), 20);
+    ASSERT_LE(statistics.minimumFrameTime, statistics.averageFrameTime);
+    ASSERT_GE(statistics.maximumFrameTime, statistics.averageFrameTime);
+    ASSERT_GE(statistics.averageFrameTime, 4ms);
+
+    pacer.reset();
+    ASSERT_EQ(pacer.statistics().frameCount, 0);
+}
+
+TEST(Utils_FramePacer, ResynchronisesAfterStall) {
+    Utils::FramePacer pacer(100.0);
+    pacer.waitForNextFrame();
+
+    std::this_thread::sleep_for(100ms);
+
+    // Catching up would release the next frames back to back, dropping the backlog keeps the normal spacing
+    const auto start = Utils::FramePacer::Clock::now();
+    pacer.waitForNextFrame();
+    pacer.waitForNextFrame();
+    const auto elapsed = Utils::FramePacer::Clock::now() - start;
+
+    ASSERT_GE(elapsed, 9ms);
+    ASSERT_GT(pacer.statistics().droppedTime, 50ms);
+}
+
+TEST(Utils_FramePacer, RefreshRates) {
+    Utils::FramePacer pacer;
+    pacer.setRefreshRate(Utils::RefreshRate::PAL);
+    pacer.waitForNextFrame();
+
+    const auto elapsed = timeFrames(pacer, 5);
+    ASSERT_GE(elapsed, 99ms);
+}
@@ -0,0 +1,51 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include "Utils/Host.hpp"
+#include "Utils/MappedFile.hpp"
+
+static const std::string mappedTestFile = std::string(TEST_DIR_BLARGG) + "Instructions/Roms/01-basics.nes";
+
+TEST(Utils_MappedFile, MatchesFileContents) {
+    const auto mapped = Utils::MappedFile::open(mappedTestFile);
+    ASSERT_TRUE(mapped.has_value());
+
+    const auto loaded = Utils::loadExternalFileToVector(mappedTestFile);
+    ASSERT_TRUE(loaded.has_value());
+
+    ASSERT_FALSE(mapped->bytes().empty());
+    ASSERT_TRUE(std::ranges::equal(mapped->bytes(), loaded.value()));
+}
+
+TEST(Utils_MappedFile, MissingFile) {
+    ASSERT_FALSE(Utils::MappedFile::open(mappedTestFile + ".missing").has_value());
+}
+
+TEST(Utils_MappedFile, MoveKeepsMapping) {
+    auto mapped = Utils::MappedFile::open(mappedTestFile);
+    ASSERT_TRUE(mapped.has_value());
+
+    const auto bytes = mapped->bytes();
+
+    Utils::MappedFile moved = std::move(mapped.value());
+    ASSERT_EQ(moved.bytes().data(), bytes.data());
+    ASSERT_EQ(moved.bytes().size(), bytes.size());
+    ASSERT_TRUE(mapped->bytes().empty());
+}
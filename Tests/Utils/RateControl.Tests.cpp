@@ -0,0 +1,59 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "Utils/RateControl.hpp"
+
+TEST(Utils_DynamicRateControl, NeutralAtTarget) {
+    Utils::DynamicRateControl rateControl(2048);
+
+    ASSERT_DOUBLE_EQ(rateControl.ratio(2048), 1.0);
+}
+
+TEST(Utils_DynamicRateControl, SpeedsUpWhenDraining) {
+    Utils::DynamicRateControl rateControl(2048);
+
+    ASSERT_GT(rateControl.ratio(1024), 1.0);
+    ASSERT_GT(rateControl.ratio(0), rateControl.ratio(1024));
+    ASSERT_DOUBLE_EQ(rateControl.ratio(0), 1.0 + Utils::Const::RateControl::maximumDeviation);
+}
+
+TEST(Utils_DynamicRateControl, SlowsDownWhenFilling) {
+    Utils::DynamicRateControl rateControl(2048);
+
+    ASSERT_LT(rateControl.ratio(3072), 1.0);
+    ASSERT_DOUBLE_EQ(rateControl.ratio(8192), 1.0 - Utils::Const::RateControl::maximumDeviation);
+}
+
+TEST(Utils_DynamicRateControl, UpdateAveragesMeasurements) {
+    Utils::DynamicRateControl rateControl(2048);
+
+    // A single burst barely moves the ratio, a queue that stays low pushes it all the way
+    const auto afterBurst = rateControl.update(0);
+    ASSERT_GT(afterBurst, 1.0);
+    ASSERT_LT(afterBurst, rateControl.ratio(1024));
+
+    for (auto i = 0; i < 200; i++) {
+        rateControl.update(0);
+    }
+
+    ASSERT_NEAR(rateControl.update(0), rateControl.ratio(0), 1e-6);
+
+    rateControl.reset();
+    ASSERT_DOUBLE_EQ(rateControl.update(2048), 1.0);
+}
@@ -0,0 +1,94 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include <array>
+#include <numeric>
+#include <thread>
+#include <vector>
+#include "Utils/RingBuffer.hpp"
+
+TEST(Utils_RingBuffer, CapacityRoundsUpToPowerOfTwo) {
+    Utils::RingBuffer<int> buffer(100);
+    ASSERT_EQ(buffer.capacity(), 128);
+}
+
+TEST(Utils_RingBuffer, PopsInPushOrder) {
+    Utils::RingBuffer<int> buffer(8);
+
+    const std::array<int, 5> values = {1, 2, 3, 4, 5};
+    ASSERT_EQ(buffer.push(values), 5);
+    ASSERT_EQ(buffer.size(), 5);
+
+    std::array<int, 8> popped{};
+    ASSERT_EQ(buffer.pop(popped), 5);
+    ASSERT_TRUE(std::equal(values.begin(), values.end(), popped.begin()));
+    ASSERT_EQ(buffer.size(), 0);
+}
+
+TEST(Utils_RingBuffer, PushKeepsOnlyWhatFits) {
+    Utils::RingBuffer<int> buffer(4);
+
+    const std::array<int, 6> values = {1, 2, 3, 4, 5, 6};
+    ASSERT_EQ(buffer.push(values), 4);
+    ASSERT_EQ(buffer.push(values), 0);
+
+    std::array<int, 6> popped{};
+    ASSERT_EQ(buffer.pop(popped), 4);
+    ASSERT_EQ(popped[3], 4);
+}
+
+TEST(Utils_RingBuffer, WrapsAround) {
+    Utils::RingBuffer<int> buffer(4);
+    std::array<int, 3> popped{};
+
+    for (auto round = 0; round < 10; round++) {
+        const std::array<int, 3> values = {round, round + 1, round + 2};
+        ASSERT_EQ(buffer.push(values), 3);
+        ASSERT_EQ(buffer.pop(popped), 3);
+        ASSERT_EQ(popped, values);
+    }
+}
+
+TEST(Utils_RingBuffer, ProducerAndConsumerThreads) {
+    constexpr int valueCount = 100000;
+    Utils::RingBuffer<int> buffer(256);
+
+    std::thread producer([&] {
+        auto next = 0;
+        while (next < valueCount) {
+            const std::array<int, 1> value = {next};
+            next += static_cast<int>(buffer.push(value));
+        }
+    });
+
+    std::vector<int> received;
+    received.reserve(valueCount);
+
+    std::array<int, 64> chunk{};
+    while (received.size() < valueCount) {
+        const auto count = buffer.pop(chunk);
+        received.insert(received.end(), chunk.begin(), chunk.begin() + count);
+    }
+
+    producer.join();
+
+    std::vector<int> expected(valueCount);
+    std::iota(expected.begin(), expected.end(), 0);
+    ASSERT_EQ(received, expected);
+}
@@ -0,0 +1,68 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include "Utils/ThreadPool.hpp"
+
+TEST(Utils_ThreadPool, RunsAllTasks) {
+    Utils::ThreadPool pool(4);
+    std::atomic<int> counter = 0;
+
+    for (auto i = 0; i < 1000; i++) {
+        pool.submit([&] { counter++; });
+    }
+
+    pool.wait();
+    ASSERT_EQ(counter, 1000);
+}
+
+TEST(Utils_ThreadPool, WaitsForNestedTasks) {
+    Utils::ThreadPool pool(4);
+    std::atomic<int> counter = 0;
+
+    std::function<void(int)> chain = [&](int remaining) {
+        counter++;
+        if (remaining > 1) {
+            pool.submit([&, remaining] { chain(remaining - 1); });
+        }
+    };
+
+    for (auto i = 0; i < 8; i++) {
+        pool.submit([&] { chain(100); });
+    }
+
+    pool.wait();
+    ASSERT_EQ(counter, 800);
+}
+
+TEST(Utils_ThreadPool, RethrowsTaskException) {
+    Utils::ThreadPool pool(2);
+    std::atomic<int> counter = 0;
+
+    pool.submit([] { throw std::runtime_error("task failed"); });
+    pool.submit([&] { counter++; });
+
+    ASSERT_THROW(pool.wait(), std::runtime_error);
+    ASSERT_EQ(counter, 1);
+
+    pool.submit([&] { counter++; });
+    ASSERT_NO_THROW(pool.wait());
+    ASSERT_EQ(counter, 2);
+}
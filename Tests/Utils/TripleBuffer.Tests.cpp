@@ -0,0 +1,88 @@
+/***********************************************************************************************************************
+*
+*   Copyright 2023 CaiqueNES
+*
+*   Licensed under the Apache License, Version 2.0 (the "License");
+*   you may not use this file except in compliance with the License.
+*   You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+*   Unless required by applicable law or agreed to in writing, software
+*   distributed under the License is distributed on an "AS IS" BASIS,
+*   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*   See the License for the specific language governing permissions and
+*   limitations under the License.
+*
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <thread>
+#include "Utils/TripleBuffer.hpp"
+
+TEST(Utils_TripleBuffer, ConsumeWithoutPublish) {
+    Utils::TripleBuffer<int> buffer;
+    ASSERT_FALSE(buffer.consume());
+}
+
+TEST(Utils_TripleBuffer, ConsumeLatest) {
+    Utils::TripleBuffer<int> buffer;
+
+    buffer.writeBuffer() = 1;
+    buffer.publish();
+    buffer.writeBuffer() = 2;
+    buffer.publish();
+
+    ASSERT_TRUE(buffer.consume());
+    ASSERT_EQ(buffer.readBuffer(), 2);
+    ASSERT_FALSE(buffer.consume());
+    ASSERT_EQ(buffer.readBuffer(), 2);
+
+    buffer.writeBuffer() = 3;
+    buffer.publish();
+
+    ASSERT_TRUE(buffer.consume());
+    ASSERT_EQ(buffer.readBuffer(), 3);
+}
+
+TEST(Utils_TripleBuffer, WriterNeverGetsReadBuffer) {
+    Utils::TripleBuffer<int> buffer;
+
+    for (auto i = 0; i < 10; i++) {
+        buffer.writeBuffer() = i;
+        buffer.publish();
+        ASSERT_TRUE(buffer.consume());
+        ASSERT_NE(&buffer.writeBuffer(), &buffer.readBuffer());
+    }
+}
+
+TEST(Utils_TripleBuffer, NoTornFrames) {
+    constexpr int frameCount = 20000;
+    using Frame = std::array<int, 256>;
+
+    Utils::TripleBuffer<Frame> buffer;
+
+    std::thread producer([&]() {
+        for (auto i = 1; i <= frameCount; i++) {
+            buffer.writeBuffer().fill(i);
+            buffer.publish();
+        }
+    });
+
+    auto lastFrame = 0;
+    while (lastFrame < frameCount) {
+        if (!buffer.consume()) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        const auto& frame = buffer.readBuffer();
+        ASSERT_TRUE(std::ranges::all_of(frame, [&](int value) { return value == frame.front(); }));
+        ASSERT_GT(frame.front(), lastFrame);
+        lastFrame = frame.front();
+    }
+
+    producer.join();
+}